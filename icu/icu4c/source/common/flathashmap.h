@@ -0,0 +1,352 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  flathashmap.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   A typed, open-addressing hash map for internal use.
+*/
+
+#ifndef __FLATHASHMAP_H__
+#define __FLATHASHMAP_H__
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+#include "unicode/uobject.h"
+#include "cmemory.h"
+#include "cstring.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Key traits for NUL-terminated char * keys, compared by content.
+ * The map does not copy the strings; they must outlive their entries.
+ *
+ * Key traits provide static hash() and equals() functions.
+ * The map mixes the hash values, so they need not be well distributed.
+ */
+struct CharsKeyTraits {
+    static inline uint32_t hash(const char *key) {
+        // FNV-1a
+        uint32_t h = 0x811c9dc5;
+        uint8_t c;
+        while ((c = (uint8_t)*key++) != 0) {
+            h = (h ^ c) * 0x1000193;
+        }
+        return h;
+    }
+    static inline UBool equals(const char *a, const char *b) {
+        return a == b || uprv_strcmp(a, b) == 0;
+    }
+};
+
+/**
+ * A hash map from K to V, for hot internal lookup tables that used UHashtable.
+ *
+ * Unlike UHashtable, keys and values are stored unboxed in one flat array of
+ * entries, and hashing and key comparison are inlined through the KeyTraits.
+ * Collisions are resolved by probing groups of 8 slots, in the style of
+ * "Swiss tables": A separate array has one control byte per slot, with 7 bits
+ * of the key's hash for a full slot. A lookup loads a group of control bytes
+ * as one 64-bit word and compares all 8 at once with bitwise operations,
+ * so that it usually compares only the one matching key.
+ *
+ * K and V must be trivially copyable types like pointers and integers.
+ * An empty map does not allocate memory. Entries are not moved when others are
+ * removed, but they are moved when the map grows.
+ *
+ * Not thread-safe; callers synchronize like for UHashtable.
+ *
+ * Iteration:
+ * \code
+ * for (int32_t pos = map.nextPosition(-1); pos >= 0; pos = map.nextPosition(pos)) {
+ *     ... map.keyAt(pos) ... map.valueAt(pos) ...
+ *     map.removeAt(pos);  // optional, does not disturb the iteration
+ * }
+ * \endcode
+ *
+ * @internal
+ */
+template<typename K, typename V, typename KeyTraits>
+class FlatHashMap : public UMemory {
+public:
+    FlatHashMap() {}
+    ~FlatHashMap() {
+        uprv_free(fCtrl);
+        uprv_free(fEntries);
+    }
+
+    FlatHashMap(const FlatHashMap &other) = delete;
+    FlatHashMap &operator=(const FlatHashMap &other) = delete;
+
+    /** @return the number of entries */
+    int32_t count() const { return fCount; }
+
+    /**
+     * Makes room for the given number of entries, so that adding up to
+     * that many does not allocate memory.
+     */
+    void reserve(int32_t minCount, UErrorCode &errorCode) {
+        if (U_FAILURE(errorCode)) { return; }
+        if (minCount > maxLoad(fCapacity) - fDeleted) {
+            rehash(minCount, errorCode);
+        }
+    }
+
+    /** @return a pointer to the value for the key, or nullptr if there is none */
+    V *find(const K &key) {
+        int32_t i = findIndex(key);
+        return i >= 0 ? &fEntries[i].value : nullptr;
+    }
+
+    /** @return a pointer to the value for the key, or nullptr if there is none */
+    const V *find(const K &key) const {
+        int32_t i = findIndex(key);
+        return i >= 0 ? &fEntries[i].value : nullptr;
+    }
+
+    /** @return the value for the key, or a value-initialized V (e.g., nullptr) if there is none */
+    V get(const K &key) const {
+        int32_t i = findIndex(key);
+        return i >= 0 ? fEntries[i].value : V();
+    }
+
+    /** @return true if the map contains the key */
+    UBool containsKey(const K &key) const { return findIndex(key) >= 0; }
+
+    /**
+     * Adds or replaces the entry for the key.
+     * When replacing, the old key is replaced as well.
+     * Sets U_MEMORY_ALLOCATION_ERROR if the map needed to grow but could not;
+     * the map is then unchanged.
+     */
+    void put(const K &key, const V &value, UErrorCode &errorCode) {
+        if (U_FAILURE(errorCode)) { return; }
+        uint32_t h = mixHash(KeyTraits::hash(key));
+        int32_t i = findIndex(key, h);
+        if (i < 0) {
+            if ((fCount + fDeleted) >= maxLoad(fCapacity)) {
+                rehash(fCount + 1, errorCode);
+                if (U_FAILURE(errorCode)) { return; }
+            }
+            i = findFreeIndex(h);
+            if (fCtrl[i] == CTRL_DELETED) {
+                --fDeleted;
+            }
+            fCtrl[i] = (uint8_t)(h & 0x7f);
+            ++fCount;
+        }
+        fEntries[i].key = key;
+        fEntries[i].value = value;
+    }
+
+    /** Removes the entry for the key, if there is one. @return true if there was one */
+    UBool remove(const K &key) {
+        int32_t i = findIndex(key);
+        if (i < 0) { return false; }
+        removeAt(i);
+        return true;
+    }
+
+    /** Removes all entries, keeping the allocated memory. */
+    void removeAll() {
+        if (fCapacity > 0) {
+            uprv_memset(fCtrl, CTRL_EMPTY, fCapacity);
+        }
+        fCount = fDeleted = 0;
+    }
+
+    /**
+     * Iteration: Returns the position of the next entry after pos,
+     * or -1 if there is none. Start with pos=-1.
+     */
+    int32_t nextPosition(int32_t pos) const {
+        while (++pos < fCapacity) {
+            if (isFull(fCtrl[pos])) { return pos; }
+        }
+        return -1;
+    }
+
+    /** @return the key of the entry at a position from nextPosition() */
+    const K &keyAt(int32_t pos) const { return fEntries[pos].key; }
+
+    /** @return the value of the entry at a position from nextPosition() */
+    V &valueAt(int32_t pos) { return fEntries[pos].value; }
+    const V &valueAt(int32_t pos) const { return fEntries[pos].value; }
+
+    /** Removes the entry at a position from nextPosition(). */
+    void removeAt(int32_t pos) {
+        // A lookup stops at the first group with an empty slot.
+        // Once a group has no empty slot, it gets one again only from a rehash,
+        // so if this group has one now, then no probe sequence has ever passed it,
+        // and the slot can become empty rather than a tombstone.
+        if (matchEmpty(loadGroup(pos & ~(GROUP_SIZE - 1))) != 0) {
+            fCtrl[pos] = CTRL_EMPTY;
+        } else {
+            fCtrl[pos] = CTRL_DELETED;
+            ++fDeleted;
+        }
+        --fCount;
+    }
+
+private:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    static constexpr int32_t GROUP_SIZE = 8;
+    static constexpr uint8_t CTRL_EMPTY = 0x80;
+    static constexpr uint8_t CTRL_DELETED = 0xfe;
+    static constexpr uint64_t LSBS = 0x0101010101010101ULL;
+    static constexpr uint64_t MSBS = 0x8080808080808080ULL;
+
+    static inline UBool isFull(uint8_t ctrl) { return ctrl < 0x80; }
+
+    /** At most 7/8 of the slots are full or deleted, so that every probe ends. */
+    static inline int32_t maxLoad(int32_t capacity) { return capacity - capacity / 8; }
+
+    static inline uint32_t mixHash(uint32_t h) {
+        h ^= h >> 16;
+        h *= 0x85ebca6b;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35;
+        h ^= h >> 16;
+        return h;
+    }
+
+    /** Loads 8 control bytes, with the byte at the lowest index in the least significant byte. */
+    inline uint64_t loadGroup(int32_t start) const {
+        uint64_t group;
+        uprv_memcpy(&group, fCtrl + start, 8);
+#if U_IS_BIG_ENDIAN
+        group = ((group & 0x00ff00ff00ff00ffULL) << 8) | ((group >> 8) & 0x00ff00ff00ff00ffULL);
+        group = ((group & 0x0000ffff0000ffffULL) << 16) | ((group >> 16) & 0x0000ffff0000ffffULL);
+        group = (group << 32) | (group >> 32);
+#endif
+        return group;
+    }
+
+    /**
+     * @return a mask with the high bit set for each byte that equals h2.
+     * May also set it for a byte above a matching one; callers compare keys anyway.
+     */
+    static inline uint64_t matchByte(uint64_t group, uint8_t h2) {
+        uint64_t x = group ^ (LSBS * h2);
+        return (x - LSBS) & ~x & MSBS;
+    }
+
+    /** @return a mask with the high bit set for each empty slot (exact) */
+    static inline uint64_t matchEmpty(uint64_t group) {
+        // Empty 0x80 has bit 1 clear, deleted 0xfe has it set, full bytes have bit 7 clear.
+        return group & ~(group << 6) & MSBS;
+    }
+
+    /** @return the index within the group of the lowest byte marked in the mask */
+    static inline int32_t lowestByte(uint64_t mask) {
+#if defined(__GNUC__) || UPRV_HAS_BUILTIN(__builtin_ctzll)
+        return __builtin_ctzll(mask) >> 3;
+#else
+        int32_t i = 0;
+        while ((mask & 0x80) == 0) {
+            mask >>= 8;
+            ++i;
+        }
+        return i;
+#endif
+    }
+
+    int32_t findIndex(const K &key) const {
+        if (fCount == 0) { return -1; }
+        return findIndex(key, mixHash(KeyTraits::hash(key)));
+    }
+
+    int32_t findIndex(const K &key, uint32_t h) const {
+        if (fCapacity == 0) { return -1; }
+        int32_t groupMask = fCapacity / GROUP_SIZE - 1;
+        int32_t g = (int32_t)(h >> 7) & groupMask;
+        // Triangular probing over the power-of-2 number of groups visits each group.
+        for (int32_t step = 1;; ++step) {
+            int32_t start = g * GROUP_SIZE;
+            uint64_t group = loadGroup(start);
+            for (uint64_t m = matchByte(group, (uint8_t)(h & 0x7f)); m != 0; m &= m - 1) {
+                int32_t i = start + lowestByte(m);
+                if (isFull(fCtrl[i]) && KeyTraits::equals(fEntries[i].key, key)) {
+                    return i;
+                }
+            }
+            if (matchEmpty(group) != 0) { return -1; }
+            g = (g + step) & groupMask;
+        }
+    }
+
+    /** @return the first empty or deleted slot in the probe sequence for h */
+    int32_t findFreeIndex(uint32_t h) const {
+        int32_t groupMask = fCapacity / GROUP_SIZE - 1;
+        int32_t g = (int32_t)(h >> 7) & groupMask;
+        for (int32_t step = 1;; ++step) {
+            int32_t start = g * GROUP_SIZE;
+            uint64_t m = loadGroup(start) & MSBS;
+            if (m != 0) {
+                return start + lowestByte(m);
+            }
+            g = (g + step) & groupMask;
+        }
+    }
+
+    /** Re-inserts all entries into new arrays with room for at least twice minCount entries. */
+    void rehash(int32_t minCount, UErrorCode &errorCode) {
+        int32_t newCapacity = 2 * GROUP_SIZE;
+        while (maxLoad(newCapacity) < 2 * minCount) {
+            if (newCapacity > (INT32_MAX / 2) / (int32_t)sizeof(Entry)) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            newCapacity *= 2;
+        }
+        uint8_t *newCtrl = (uint8_t *)uprv_malloc(newCapacity);
+        Entry *newEntries = (Entry *)uprv_malloc((size_t)newCapacity * sizeof(Entry));
+        if (newCtrl == nullptr || newEntries == nullptr) {
+            uprv_free(newCtrl);
+            uprv_free(newEntries);
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        uprv_memset(newCtrl, CTRL_EMPTY, newCapacity);
+        uint8_t *oldCtrl = fCtrl;
+        Entry *oldEntries = fEntries;
+        int32_t oldCapacity = fCapacity;
+        fCtrl = newCtrl;
+        fEntries = newEntries;
+        fCapacity = newCapacity;
+        fDeleted = 0;
+        for (int32_t i = 0; i < oldCapacity; ++i) {
+            if (isFull(oldCtrl[i])) {
+                uint32_t h = mixHash(KeyTraits::hash(oldEntries[i].key));
+                int32_t j = findFreeIndex(h);
+                fCtrl[j] = (uint8_t)(h & 0x7f);
+                fEntries[j] = oldEntries[i];
+            }
+        }
+        uprv_free(oldCtrl);
+        uprv_free(oldEntries);
+    }
+
+    uint8_t *fCtrl = nullptr;
+    Entry *fEntries = nullptr;
+    int32_t fCapacity = 0;  // 0 or a power of 2 >= GROUP_SIZE
+    int32_t fCount = 0;
+    int32_t fDeleted = 0;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_SHOW_CPLUSPLUS_API
+
+#endif  // __FLATHASHMAP_H__
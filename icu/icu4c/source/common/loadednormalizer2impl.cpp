@@ -33,7 +33,7 @@ U_NAMESPACE_BEGIN
 
 class LoadedNormalizer2Impl : public Normalizer2Impl {
 public:
-    LoadedNormalizer2Impl() : memory(NULL), ownedTrie(NULL) {}
+    LoadedNormalizer2Impl() : memory(NULL), ownedTrie(NULL), ownedCanonIterTrie(NULL) {}
     virtual ~LoadedNormalizer2Impl();
 
     void load(const char *packageName, const char *name, UErrorCode &errorCode);
@@ -44,11 +44,13 @@ class LoadedNormalizer2Impl : public Normalizer2Impl {
 
     UDataMemory *memory;
     UCPTrie *ownedTrie;
+    UCPTrie *ownedCanonIterTrie;
 };
 
 LoadedNormalizer2Impl::~LoadedNormalizer2Impl() {
     udata_close(memory);
     ucptrie_close(ownedTrie);
+    ucptrie_close(ownedCanonIterTrie);
 }
 
 UBool U_CALLCONV
@@ -105,9 +107,24 @@ LoadedNormalizer2Impl::load(const char *packageName, const char *name, UErrorCod
 
     // smallFCD: new in formatVersion 2
     offset=nextOffset;
+    nextOffset=inIndexes[IX_CANON_ITER_TRIE_OFFSET];
     const uint8_t *inSmallFCD=inBytes+offset;
 
-    init(inIndexes, ownedTrie, inExtraData, inSmallFCD);
+    // Optional precomputed CanonicalIterator data: new in formatVersion 4.1
+    offset=nextOffset;
+    nextOffset=inIndexes[IX_CANON_START_SETS_OFFSET];
+    const uint16_t *inCanonStartSets=NULL;
+    if(offset<nextOffset) {
+        ownedCanonIterTrie=ucptrie_openFromBinary(UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32,
+                                                  inBytes+offset, nextOffset-offset, NULL,
+                                                  &errorCode);
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+        inCanonStartSets=(const uint16_t *)(inBytes+nextOffset);
+    }
+
+    init(inIndexes, ownedTrie, inExtraData, inSmallFCD, ownedCanonIterTrie, inCanonStartSets);
 }
 
 // instance cache ---------------------------------------------------------- ***
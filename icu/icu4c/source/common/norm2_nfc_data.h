@@ -9,11 +9,11 @@
 
 #ifdef INCLUDED_FROM_NORMALIZER2_CPP
 
-static const UVersionInfo norm2_nfc_data_formatVersion={4,0,0,0};
+static const UVersionInfo norm2_nfc_data_formatVersion={4,1,0,0};
 static const UVersionInfo norm2_nfc_data_dataVersion={0xf,0,0,0};
 
 static const int32_t norm2_nfc_data_indexes[Normalizer2Impl::IX_COUNT]={
-0x50,0x4cb8,0x8920,0x8a20,0x8a20,0x8a20,0x8a20,0x8a20,0xc0,0x300,0xae2,0x29e0,0x3c66,0xfc00,0x1288,0x3b9c,
+0x50,0x4cb8,0x8920,0x8a20,0x16190,0x16738,0x16738,0x16738,0xc0,0x300,0xae2,0x29e0,0x3c66,0xfc00,0x1288,0x3b9c,
 0x3c34,0x3c66,0x300,0
 };
 
@@ -1151,4 +1151,1082 @@ static const uint8_t norm2_nfc_data_smallFCD[256]={
 0,0,0,0,0,0,0,0,0,0,0,7,0,0,2,0
 };
 
+static const uint16_t norm2_nfc_data_canonIter_trieIndex[4794]={
+0,0x40,0x7b,0xb5,0xee,0xef,0xf7,0xee,0xee,0xee,0x11c,0xee,0x15c,0x18d,0x1bd,0x1fd,
+0x237,0x272,0x2af,0x2d7,0xee,0xee,0x306,0x344,0x377,0x3af,0xee,0x3ee,0x41d,0x452,0xee,0x467,
+0x4a5,0x4d3,0x4fb,0x531,0x571,0x5ae,0x5cd,0x60c,0x64b,0x688,0x696,0x688,0x6d3,0x712,0x740,0x77f,
+0x696,0x7b9,0x7d0,0x810,0x827,0x77f,0xee,0x866,0x886,0x8c1,0x886,0x8c1,0x8e9,0x929,0x969,0x68f,
+0x1189,0x11a9,0x11c9,0x11df,0x11ff,0x120f,0x1227,0x1246,0x1266,0x1286,0x12a6,0,0x10,0x20,0x30,0x40,
+0x50,0x60,0x70,0x7b,0x8b,0x9b,0xab,0xb5,0xc5,0xd5,0xe5,0xee,0xfe,0x10e,0x11e,0xef,
+0xff,0x10f,0x11f,0xf7,0x107,0x117,0x127,0xee,0xfe,0x10e,0x11e,0xee,0xfe,0x10e,0x11e,0x11c,
+0x12c,0x13c,0x14c,0xee,0xfe,0x10e,0x11e,0x15c,0x16c,0x17c,0x18c,0x18d,0x19d,0x1ad,0x1bd,0x1bd,
+0x1cd,0x1dd,0x1ed,0x1fd,0x20d,0x21d,0x22d,0x237,0x247,0x257,0x267,0x272,0x282,0x292,0x2a2,0x2af,
+0x2bf,0x2cf,0x2df,0x2d7,0x2e7,0x2f7,0x307,0xee,0xfe,0x10e,0x11e,0xee,0xfe,0x10e,0x11e,0x306,
+0x316,0x326,0x336,0x344,0x354,0x364,0x374,0x377,0x387,0x397,0x3a7,0x3af,0x3bf,0x3cf,0x3df,0xee,
+0xfe,0x10e,0x11e,0x3ee,0x3fe,0x40e,0x41e,0x41d,0x42d,0x43d,0x44d,0x452,0x462,0x472,0x482,0xee,
+0xfe,0x10e,0x11e,0x467,0x477,0x487,0x497,0x4a5,0x4b5,0x4c5,0x4d5,0x4d3,0x4e3,0x4f3,0x503,0x4fb,
+0x50b,0x51b,0x52b,0x531,0x541,0x551,0x561,0x571,0x581,0x591,0x5a1,0x5ae,0x5be,0x5ce,0x5de,0x5cd,
+0x5dd,0x5ed,0x5fd,0x60c,0x61c,0x62c,0x63c,0x64b,0x65b,0x66b,0x67b,0x688,0x698,0x6a8,0x6b8,0x696,
+0x6a6,0x6b6,0x6c6,0x688,0x698,0x6a8,0x6b8,0x6d3,0x6e3,0x6f3,0x703,0x712,0x722,0x732,0x742,0x740,
+0x750,0x760,0x770,0x77f,0x78f,0x79f,0x7af,0x696,0x6a6,0x6b6,0x6c6,0x7b9,0x7c9,0x7d9,0x7e9,0x7d0,
+0x7e0,0x7f0,0x800,0x810,0x820,0x830,0x840,0x827,0x837,0x847,0x857,0x77f,0x78f,0x79f,0x7af,0xee,
+0xfe,0x10e,0x11e,0x866,0x876,0x886,0x896,0x8a6,0x8b6,0x8c1,0x8d1,0x8e1,0x8f1,0x886,0x896,0x8a6,
+0x8b6,0x8c1,0x8d1,0x8e1,0x8f1,0x8e9,0x8f9,0x909,0x919,0x929,0x939,0x949,0x959,0x969,0x979,0x989,
+0x999,0x68f,0x69f,0x6af,0x6bf,0xee,0xee,0x9a4,0x9ab,0xee,0xee,0xee,0xee,0x3d2,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x61,0x78,0xee,0xee,0xee,0xee,0x19c,0x1b7,0xee,0xee,0x30f,
+0x170,0x1ba,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x30a,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x724,0xee,0x3db,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x9b9,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x3d6,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x4e3,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x721,0xee,0xee,0xee,0xee,0x1bc,0x9c7,0xee,0xee,0xee,0x18e,
+0x18d,0xee,0xee,0xee,0x9d7,0xba,0xee,0x9e5,0x9f5,0xee,0x30c,0x1b9,0xee,0xee,0x8f7,0xee,
+0xee,0xee,0x3d9,0x726,0xee,0xee,0xee,0x3d8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x199,0xa05,0xa0e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x170,0x170,0x170,0x170,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xbe,
+0xee,0xee,0xee,0xbf,0xa1c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x1b0,0xa2b,0x1bc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xa3b,0xee,0xee,
+0xee,0xa3b,0xee,0xee,0xa48,0xee,0xa55,0xc1,0xa62,0xee,0xa6e,0xa7c,0xa8a,0x2ee,0xa98,0xaa6,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xaac,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x308,0x1bb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x308,0xee,0xee,0xee,0xee,0xee,0xee,0x170,0x170,0xaba,0xee,0x30d,0xee,0xac4,0xace,0xadc,
+0xae9,0xee,0xaf5,0xac4,0xace,0xadc,0xae9,0xbe,0xb05,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xb13,0xee,0xb22,0xee,0xb2e,0xee,0xee,
+0xee,0xb3e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xb44,0xb53,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xb62,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xb64,0xee,0xee,0xee,0xb74,0xb78,0xee,0xee,0xee,0xee,0xb85,0xee,0xb92,0xee,
+0xee,0xb96,0xee,0xba3,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xbae,0xee,0xee,0xee,0xbbd,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xbca,0xee,0xbd2,0xbdb,
+0xee,0xee,0xbe5,0xee,0xee,0xee,0xee,0xbef,0xee,0xee,0xee,0xee,0xee,0xee,0xbfd,0xee,
+0xee,0xc06,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xc15,0xee,0xee,0xee,0xee,0xee,0xc1f,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xc26,0xc33,0xee,0xee,0xee,0xee,0xee,0xc3c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xc48,0xc55,0xc5e,0xee,0xc67,0xc71,0xee,0xee,0xee,0xee,
+0xc7b,0xee,0xee,0xee,0xee,0xc88,0xee,0xee,0xee,0xc8c,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xc9c,0xee,0xca5,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xcb5,0xee,0xee,0xee,0xee,0xee,0xcc4,0xee,0xee,0xcd0,0xee,0xcd7,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xce2,0xee,0xee,0xcec,0xee,0xee,0xee,0xee,0xee,0xcf8,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xd04,0xee,0xee,0xd10,0xd1f,0xee,0xee,
+0xee,0xee,0xee,0xee,0xd2b,0xee,0xd33,0xee,0xee,0xee,0xd3e,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xd44,0xd53,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xd5e,0xee,0xee,
+0xee,0xee,0xd68,0xee,0xee,0xee,0xee,0xee,0xee,0xd6f,0xd7e,0xee,0xee,0xee,0xd8c,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xd99,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xd9d,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xdac,0xee,0xdbb,0xdc9,
+0xee,0xee,0xee,0xee,0xee,0xdd3,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xdda,0xee,0xde8,0xdf6,0xe05,0xee,0xee,0xee,0xe13,0xee,0xe1a,0xee,0xe2a,0xee,0xe37,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xe47,0xee,0xe57,0xee,0xe63,0xe72,0xee,0xee,0xee,0xee,
+0xe82,0xee,0xe87,0xee,0xee,0xee,0xee,0xe93,0xee,0xe9e,0xee,0xee,0xea8,0xeb8,0xec3,0xee,
+0xee,0xee,0xee,0xee,0xed3,0xee1,0xeed,0xefb,0xf0b,0xf19,0xf25,0xf32,0xf3a,0xf47,0xee,0xf56,
+0xf63,0xf6c,0xf74,0xf7e,0xf8a,0xee,0xee,0xf98,0xfa0,0xfaa,0xfb7,0xfc4,0xfcd,0xfdb,0xfea,0xff5,
+0x1000,0x1009,0xee,0x1011,0x1021,0x1030,0xee,0x103d,0xee,0xee,0xee,0xee,0x104d,0x1058,0x1068,0x1077,
+0x1081,0x1091,0xee,0x109f,0x10ad,0xee,0x10b6,0xee,0xee,0x10bf,0x10ce,0x10d1,0xee,0xee,0xee,0x10df,
+0xee,0x10ef,0xee,0xee,0xee,0x10fc,0x1109,0xee,0x1115,0x111d,0x112b,0x1138,0x1148,0xee,0x1156,0xee,
+0x1160,0xee,0xee,0xee,0xee,0x116f,0x1177,0x1183,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x118a,
+0xee,0x1194,0xee,0xee,0xee,0xee,0xee,0xee,0x119c,0xee,0xee,0xee,0x11a8,0xee,0xee,0x11b7,
+0x11bc,0xee,0xee,0x11cb,0x11db,0x11e1,0xee,0xee,0xee,0xee,0x11f0,0x11fd,0xee,0x1205,0x1215,0x1224,
+0x122e,0x1235,0x1243,0xee,0x124f,0x125e,0x126c,0x1279,0xee,0xee,0xee,0xee,0xee,0x1281,0x128a,0xee,
+0x1297,0x12a3,0xee,0xee,0xee,0x12b1,0xee,0xee,0xee,0xee,0x12bc,0xee,0xee,0xee,0xee,0x12c4,
+0xee,0x12cd,0x12d6,0xee,0xee,0xee,0xee,0x12e5,0xee,0xee,0xee,0x12f2,0x12fa,0x1303,0x1312,0x1322,
+0xee,0x1330,0x1333,0xee,0xee,0x1343,0xee,0x1352,0xee,0xee,0xee,0x1362,0xee,0xee,0xee,0xee,
+0x1369,0xee,0xee,0x1376,0x1386,0x138b,0x139a,0xee,0xee,0xee,0x13a8,0xee,0xee,0x13b7,0x13ba,0xee,
+0xee,0x13c8,0x13d1,0xee,0xee,0x13df,0x13eb,0xee,0xee,0x13f5,0x1405,0x140c,0x141a,0x1424,0x1431,0x1440,
+0xee,0x144e,0xee,0xee,0x145b,0x1469,0xee,0x1475,0x1481,0x148c,0xee,0x149a,0x14a8,0xee,0x14b3,0xee,
+0x14c1,0xee,0xee,0xee,0xee,0xee,0x14ce,0x14dd,0x14e9,0xee,0xee,0x14f2,0x14fa,0x1509,0xee,0x1511,
+0xee,0xee,0xee,0x151d,0xee,0x152d,0x1536,0x1541,0x1551,0x155d,0x156d,0xee,0x1570,0xee,0x157f,0x158f,
+0x159f,0x15ab,0x15ba,0xee,0x15bf,0xee,0xee,0xee,0xee,0xee,0x15ce,0x15d5,0x15e5,0xee,0x15ea,0xee,
+0xee,0xee,0x15f9,0xee,0x1609,0x1611,0x161a,0x1627,0xee,0x1637,0xee,0x1643,0xee,0x164f,0xee,0x1654,
+0x1662,0xee,0xee,0x1670,0x1677,0x1681,0xee,0x1690,0xee,0xee,0x169e,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x16a3,0x16b3,0x16ba,0x16c7,0xee,0x16d0,0xee,0xee,0x16db,0xee,0x16e9,0xee,0x16f6,0xee,
+0xee,0x16fd,0xee,0xee,0x1709,0x1711,0x1720,0xee,0x172d,0x1737,0xee,0xee,0x1743,0x1753,0x175c,0x176b,
+0xee,0x176d,0x177c,0xee,0x178b,0x1797,0x17a0,0xee,0xee,0xee,0xee,0xee,0x17ad,0xee,0x17b8,0xee,
+0xee,0xee,0x17c8,0xee,0xee,0x17d7,0xee,0x17e6,0xee,0xee,0xee,0xee,0xee,0xee,0x17f2,0xee,
+0xee,0x1800,0xee,0xee,0xee,0xee,0xee,0x180d,0xee,0xee,0xee,0x1813,0xee,0x1821,0x182e,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x1836,0xee,0xee,0x1843,0xee,0xee,0x184f,0xee,0x185e,
+0xee,0xee,0x186a,0xee,0x1878,0xee,0x1882,0x1892,0x18a1,0xee,0xee,0xee,0xee,0x18ad,0xee,0x18bc,
+0xee,0x18c4,0xee,0xee,0x18cd,0x18dd,0xee,0x18eb,0xee,0xee,0x18f5,0xee,0x1904,0x1913,0xee,0x191a,
+0x1925,0x1930,0xee,0xee,0xee,0x1936,0x1942,0x194d,0x1958,0xee,0x1962,0x196d,0xee,0xee,0xee,0x197d,
+0xee,0xee,0x198c,0xee,0x1999,0x19a4,0x19b3,0xee,0xee,0x19bf,0xee,0x19cf,0xee,0xee,0xee,0x19d3,
+0xee,0xee,0xee,0xee,0xee,0x19e2,0xee,0x19e9,0x19f5,0xee,0x1a04,0xee,0x1a13,0x1a1d,0xee,0xee,
+0x1a2d,0xee,0x1a3b,0x1a45,0xee,0x1a53,0x1a5c,0xee,0xee,0xee,0xee,0xee,0xee,0x1a67,0xee,0x1a71,
+0xee,0xee,0x1a80,0xee,0xee,0x1a8d,0x1a9d,0xee,0xee,0x1aad,0x1ab9,0x1ac5,0xee,0x1ad5,0x1ae3,0xee,
+0x1af3,0x1afe,0x1b04,0xee,0x1b14,0xee,0xee,0x1b18,0xee,0xee,0x1b25,0xee,0xee,0xee,0xee,0x1b30,
+0x1b3b,0xee,0x1b47,0x1b55,0xee,0x1b58,0xee,0xee,0x1b67,0xee,0x1b75,0xee,0x1b7e,0x1b86,0x1b93,0x1ba2,
+0x1bad,0x1bb7,0xee,0xee,0x1bc0,0xee,0xee,0xee,0x1bcb,0xee,0x1bd7,0x1bdc,0xee,0x1beb,0x1bf6,0x1c06,
+0xee,0xee,0xee,0xee,0xee,0xee,0x1c14,0xee,0x1c24,0xee,0xee,0x1c34,0xee,0x1c3b,0xee,0xee,
+0xee,0xee,0xee,0x1c45,0x1c50,0x1c5c,0x1c68,0x1c77,0x1c79,0xee,0xee,0x1c89,0xee,0xee,0xee,0x1c94,
+0xee,0x1ca0,0xee,0xee,0xee,0xee,0xee,0x1ca8,0xee,0x1cb7,0xee,0x1cc3,0x1cd2,0xee,0xee,0x1cd8,
+0xee,0xee,0x1ce5,0xee,0xee,0x1cf1,0x1cfc,0x1d0b,0x1d1b,0x1d2a,0x1d30,0x1d40,0xee,0x1d50,0xee,0x1d5f,
+0xee,0x1d6a,0xee,0x1d76,0xee,0xee,0x1d86,0xee,0xee,0xee,0x1d96,0xee,0xee,0x1da5,0x1daa,0xee,
+0x1db6,0xee,0xee,0xee,0x1dc6,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x1dd6,0xee,
+0xee,0xee,0x1de0,0xee,0xee,0x1df0,0x1df5,0xee,0x1e03,0xee,0x1e06,0xee,0x1e15,0x1e22,0xee,0x1e32,
+0x1e42,0x1e50,0xee,0xee,0x1e60,0x1e6d,0xee,0xee,0xee,0x1e7d,0x1e7f,0x1e8e,0xee,0xee,0x1e9a,0x1ea8,
+0xee,0xee,0x1eb2,0x1ec1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x1ec7,0xee,0xee,0xee,0x1ed6,0x1ee1,0x1eec,0xee,0x1ef7,0xee,0xee,0xee,0x1f05,0x1f14,
+0xee,0xee,0xee,0x1f1e,0xee,0x1f2e,0x1f3e,0x1f4d,0xee,0x1f59,0x1f67,0xee,0xee,0xee,0xee,0x1f74,
+0xee,0xee,0x1f78,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x1f87,0x1f90,0xee,0x1f9f,
+0x1fa7,0xee,0xee,0xee,0xee,0x1fb0,0x1fc0,0x1fca,0x1fd9,0xee,0x1fe8,0xee,0xee,0x1ff6,0xee,0xee,
+0x1ffd,0x200b,0x2015,0xee,0x2023,0x2030,0xee,0xee,0xee,0x2034,0x2042,0x2050,0x205d,0x206a,0x207a,0xee,
+0xee,0xee,0x207d,0x208b,0x2095,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x209d,0x20ac,0xee,
+0x20b9,0xee,0xee,0xee,0xee,0x20c5,0xee,0xee,0xee,0xee,0xee,0x20ca,0xee,0xee,0x20d8,0x20e3,
+0x20f1,0x20f4,0x2102,0xee,0x2112,0x211f,0xee,0x2129,0xee,0x2132,0xee,0xee,0xee,0x2140,0xee,0x2143,
+0xee,0x2152,0xee,0xee,0xee,0x215b,0x2167,0x2171,0xee,0xee,0x2178,0xee,0xee,0x2187,0xee,0x2196,
+0x2198,0xee,0xee,0x21a8,0xee,0x21b8,0xee,0xee,0xee,0xee,0xee,0x21c6,0x21d6,0x21e5,0x21ed,0xee,
+0x21fd,0xee,0xee,0x220c,0xee,0x2218,0xee,0x2222,0x222e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x223e,0x2249,0x2259,0x2267,0x226e,0x227c,0x228b,0xee,0xee,0x2292,0xee,0x229c,0xee,
+0xee,0x22ac,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x22b7,0x22c2,0xee,0xee,0xee,0xee,0x22c8,
+0xee,0x22d7,0x22e4,0xee,0xee,0x22ec,0x22f5,0xee,0xee,0xee,0xee,0xee,0x2301,0xee,0xee,0xee,
+0x2309,0x2316,0xee,0x2322,0x2332,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2338,0x2344,0xee,0xee,0xee,0xee,0x234e,0x2359,0xee,0xee,0x2367,0xee,0xee,0x236a,0xee,
+0x237a,0xee,0xee,0xee,0xee,0x2387,0x238f,0xee,0xee,0xee,0x239d,0x23aa,0x23ba,0xee,0xee,0x23bf,
+0x23ce,0xee,0x23dd,0xee,0x23ec,0xee,0xee,0xee,0xee,0x23f8,0xee,0xee,0x2403,0xee,0x240f,0x2414,
+0x2424,0xee,0xee,0xee,0x2430,0xee,0xee,0xee,0x243a,0xee,0xee,0xee,0xee,0xee,0x2447,0xee,
+0xee,0x2453,0xee,0xee,0xee,0x2459,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x2464,0xee,0x246f,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2475,0xee,0x2481,0x248f,0xee,0xee,0xee,
+0xee,0x2497,0xee,0x24a6,0xee,0xee,0x24b4,0x24c1,0xee,0x24ce,0x24d7,0x24e4,0xee,0x24f2,0x24fc,0xee,
+0xee,0x2509,0x2517,0x251f,0x2529,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2530,0x2540,0x2541,0x2551,
+0x255d,0x2566,0x2570,0xee,0x257c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x258b,0x259b,0xee,
+0xee,0x25a8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x25b2,0xee,0x25c0,0xee,0xee,0x25cf,0xee,
+0xee,0xee,0xee,0xee,0xee,0x25de,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x25ec,0xee,0xee,0xee,0xee,0x25ef,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x25ff,
+0x2608,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2610,0xee,0xee,0xee,0xee,0xee,
+0xee,0x261e,0xee,0xee,0xee,0xee,0x262a,0xee,0xee,0xee,0x2630,0xee,0x263b,0xee,0xee,0xee,
+0xee,0xee,0x264a,0xee,0x265a,0xee,0x266a,0x2676,0xee,0xee,0x2685,0x2694,0x26a4,0xee,0x26ab,0x26b8,
+0xee,0xee,0xee,0x26bc,0x26cb,0xee,0xee,0xee,0xee,0xee,0xee,0x308,0x26d8,0xee,0x309,0xee,
+0xee,0xee,0xee,0xee,0x1bb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x3d9,0xee,0x3d3,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x3db,0xee,0x170,0x1bb,0xee,0xee,0x4e1,0xee,0xee,0x3dc,0xee,0xee,0xee,0xee,0xee,
+0x3dc,0x1bc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x26e8,0x3de,0xee,
+0xee,0x3d9,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x3d2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x3d1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x170,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x3d2,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x1bc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2ac,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x702,0xee,0xee,0x26f8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x723,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x8c5,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x8f6,0xee,0xee,0xee,0xee,0x30a,0xee,0xee,0xee,0xee,0x311,0x1bc,0xee,0xee,0x5bd,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x3d9,0xee,0xee,0x2707,0xee,0x2717,0xb6,0x8f8,0xee,
+0xee,0xee,0xee,0x1ba,0xee,0x3d8,0x2726,0xee,0xee,0xee,0x3dc,0xee,0xee,0xee,0xee,0x49a,
+0xee,0xee,0xee,0x723,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x8f8,0xee,
+0xee,0xee,0xee,0x857,0x60c,0x3d8,0x2730,0x1b8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x273e,0x3d1,0xee,0xee,0xee,0xee,0xee,0x274e,0x726,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x308,0x275c,0x1bc,0xee,0xee,0xee,0x308,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x722,0xee,0xee,0xee,0xee,0xee,0xee,0x3d4,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x8f8,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x276b,0x3dc,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x1bc,0xee,0xee,0xee,0x3db,0x3d8,0xee,0xee,0xee,0xee,0x3d6,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x308,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x277a,0xee,0xee,0xee,0xee,0x3d8,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x727,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x1b8,0xee,0xee,0xee,0x1b6,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x1bb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x3d1,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2783,0x278e,0x279b,0x27a8,0xee,0x27b4,0x27c2,0xee,0xee,0xee,0xee,
+0x4ea,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x195,0x27d2,0x27e0,0xee,
+0xee,0xee,0xee,0xee,0x308,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x1b6,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x3d1,0xee,0xee,0xee,
+0x30b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x30b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x1b6,0xee,0xee,0xee,0xee,0xee,0xee,0x27ec,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x27fa,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x27fe,0x280b,0xee,0x2811,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x281d,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2829,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x282e,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x283d,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x284a,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2856,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x285e,0xee,0xee,0xee,0x2867,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2872,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x287b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2884,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2890,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x289d,0x28a1,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x28b1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28bd,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x28c9,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28d4,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28e3,0x28e9,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28f4,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x28fd,0xee,0xee,0xee,0x290d,0xee,0xee,0x291a,
+0x2925,0xee,0xee,0xee,0xee,0xee,0xee,0x292b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2939,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2942,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x294a,0xee,0xee,
+0xee,0xee,0xee,0xee,0x2958,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2963,0xee,0xee,0xee,0xee,0xee,0x2970,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x297f,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2981,0xee,0xee,0x2990,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x299f,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x29a3,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x29b2,0xee,0xee,0xee,0xee,0xee,0x29be,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x29c9,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x29d5,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x29df,0xee,0xee,0xee,0xee,0xee,0x29ed,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x29fc,0x2a04,0xee,0xee,0xee,0xee,0x2a10,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a1e,0xee,0x2a25,0xee,0x2a32,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a39,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2a43,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x2a51,0xee,0xee,0xee,0xee,0xee,0xee,0x2a58,0xee,0xee,0x2a63,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2a69,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2a76,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2a7e,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2a8e,0xee,0xee,0xee,0xee,0x2a9e,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2aa8,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0x2aaf,0xee,0xee,0x2aba,0xee,0x2ac3,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x2acb,0xee,0xee,0xee,0xee,0xee,0x2ad5,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2ae4,0xee,0xee,0xee,0xee,0x2af1,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2af9,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0x2b02,0x2b0d,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2b13,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2b20,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b2b,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2b31,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b3d,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2b4c,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b5a,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b60,0xee,0xee,0xee,
+0xee,0xee,0xee,0x2b6b,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b73,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b82,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x2b8a,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2b97,0xee,0xee,0xee,0xee,0x2b9b,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2bab,0x2bae,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2bbc,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0x2bcb,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2bd6,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2be1,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2be7,0xee,0xee,0x2bf7,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2c02,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2c0d,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0x2c17,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2c27,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x2c29,0xee,0xee,0xee,0x2c38,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x2c3e,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2c4d,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x2c5b,0xee,0xee,0xee,0xee,0xee,0xee,0x2c6b,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x4b,0x67,0x87,0xa7,0xc7,0xe7,0x107,
+0x125,0x145,0x162,0x178,0x187,0x1a5,0x1c4,0x1e4,0x204,0x224,0x244,0x178,0x178,0x178,0x257,0x269,
+0x178,0x289,0x178,0x2a0,0x2b2,0x2d0,0x2ee,0x30d,0x327,0x347,0x367,0x387,0x3a7,0x3b4,0x3d3,0x3f0,
+0x410,0x430,0x450,0x470,0x490,0x4b0,0x4cf,0x4ef,0x50f,0x52f,0x54f,0x56e,0x58d,0x5ad,0x5cd,0x5e9,
+0x609,0x629,0x648,0x668,0x687,0x6a3,0x6c2,0x6df,0x6ff,0x71f,0x73f,0x75f,0x77f,0x79f,0x7b9,0x7d5,
+0x7f5,0x813,0x831,0x851,0x86f,0x88f,0x8af,0x8cb,0x8eb,0x178,0x178,0x178,0x905,0x925,0x942,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x961,0x178,0x97f,0x982,
+0x9a2,0x178,0x178,0x178,0x9c2,0x9d1,0x9e7,0xa03,0xa20,0xa3c,0xa59,0xa76,0xa95,0xab2,0xacc,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0xae1,0x178,0xaf5,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0x178,0xb15,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0x178,0xb20,0xb3c,
+0x178,0x178,0x178,0x178,0x178,0x178,0xb5c,0xb72,0xb84,0x178,0xb97,0x178,0x178,0x178,0x178,0x178,
+0x178,0x178,0x178,0x178,0x178,0x178,0xbac,0x178,0xbbf,0xbdc,0xbfc,0xc1a,0x178,0x178,0x178,0x178,
+0xc31,0xc47,0xc56,0xc73,0xc85,0x178,0xca4,0xcbe,0x178,0xcd2,0xcee,0xcfe,0x178,0x178,0xd1e,0xd33,
+0xd51,0xd67,0xd7d,0xd95,0xdaa,0xdbd,0x178,0xdd7,0x178,0xdf7,0xe16,0x178,0xe33,0xe3d,0xe59,0xe75,
+0xe94,0xeb2,0xebf,0xed7,0xef2,0xf00,0xf19,0xf37,0xf4b,0xf66,0x178,0xf82,0xf9f,0xfb6,0xfd2,0xfe0,
+0x178,0xffd,0x1013,0x178,0x102a,0x103d,0x178,0x178,0x1050,0x106f,0x178,0x1082,0x10a2,0x178,0x10ba,0x10d9,
+0x10f9,0x178,0x178,0x1115,0x178,0x178,0x1129,0x1149,0x178,0x1169
+};
+
+static const uint32_t norm2_nfc_data_canonIter_trieData[11387]={
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x37e,0x40000000,0x40000000,0x40000000,0,
+0,0x4000212b,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x4000212a,0x40000000,0x40000000,0x40000000,0x40000000,
+0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0,0,0,0,0,
+0x1fef,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,
+0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0x40000000,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x40001fee,0,0,0,0,0,0,0,0,0,0,0,0x1ffd,
+0,0,0x387,0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x374,0,0,0,0,0,0,0x80000340,0x80000341,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000344,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000343,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40001fbb,0,
+0,0,0x40001fc9,0,0x40001fcb,0,0x40001fdb,0,0,0,0,0,0x40001ff9,0,0x40000000,0,
+0,0,0x40001feb,0,0,0,0x40200000,0,0,0,0,0,0,0,0x40001f71,0,
+0,0,0x40001f73,0,0x40001f75,0,0x40200005,0,0,0,0,0,0x40001f79,0,0x40000000,0,
+0,0,0x4020000c,0,0,0,0x40001f7d,0,0,0,0,0,0,0,0,0x40000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,
+0,0,0,0,0,0,0,0x40000000,0,0,0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,
+0,0x40000000,0,0,0,0x40000000,0,0,0,0,0x40000000,0,0,0,0x40000000,0,
+0,0,0x40000000,0,0x40000000,0,0,0x40000000,0,0,0x40000000,0,0x40000000,0x40000000,0x40000000,0x40000000,
+0,0x40000000,0,0,0,0x40000000,0,0,0,0x40000000,0,0,0,0x40000000,0,0x40000000,
+0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x40000000,0x40000000,0,0,0,0,0,0,0,0,
+0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,
+0x40000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,
+0x40000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0,0x80000000,0x80000000,0,0x80000000,0,0,0,0,
+0,0,0,0,0x200011,0x200014,0xfb32,0xfb33,0xfb34,0x200019,0xfb36,0,0xfb38,0x20001e,0xfb3a,0x200023,
+0xfb3c,0,0xfb3e,0,0xfb40,0xfb41,0,0xfb43,0x200028,0,0xfb46,0xfb47,0xfb48,0x20002d,0xfb4a,0,
+0,0,0,0,0,0,0xfb1f,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x40000000,0,0x40000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x40000000,0,0,0x40000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0,0,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,
+0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x958,0x959,0x95a,0,0,0,0,0x95b,0,0,
+0,0,0x95c,0x95d,0,0,0,0,0,0x40000000,0,0,0x95e,0,0,0,
+0x95f,0x40000000,0,0,0x40000000,0,0,0,0,0,0,0,0,0x80000000,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,0,0,0x80000000,
+0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x9dc,0x9dd,
+0,0,0,0,0,0,0,0,0,0,0,0,0x9df,0,0,0,
+0,0,0,0,0,0,0,0,0,0x80000000,0,0x80000000,0,0,0,0,
+0,0,0,0x40000000,0,0,0,0,0,0x80000000,0,0,0,0,0,0,
+0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x80000000,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xa59,0xa5a,0,0,0,0,0xa5b,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xa5e,0,0,0,0,0,0,0xa33,0,0,
+0,0,0,0xa36,0,0,0,0x80000000,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xb5c,0xb5d,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,
+0,0x80000000,0,0,0,0,0,0,0,0x40000000,0,0,0,0,0,0x80000000,
+0,0,0,0,0,0,0,0,0x80000000,0x80000000,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x40000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,
+0,0,0,0,0,0x40000000,0x40000000,0,0,0,0,0,0x80000000,0,0,0,
+0,0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x40000000,
+0,0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0x80000000,0x80000000,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,0,0x40000000,
+0,0,0x80000000,0,0,0,0x40000000,0,0,0,0,0,0,0x80000000,0,0,
+0,0,0,0,0,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x80000000,0x80000000,0,0x80000000,0,0,0,0,0,0,0,0,0,0,
+0x80000000,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0x40000000,
+0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,
+0x80000000,0,0,0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,
+0x80000000,0,0x80000000,0,0,0,0,0,0,0xf69,0,0xf43,0,0,0,0,
+0,0,0,0,0,0xf4d,0,0,0,0,0xf52,0,0,0,0,0xf57,
+0,0,0,0,0xf5c,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x80200032,0x80000000,0,0x80000000,0,0,
+0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0,0x80000000,0x80000000,0x80000000,0,0x80000000,
+0x80000000,0,0,0,0,0,0,0,0,0xfb9,0,0xf93,0,0,0,0,
+0,0,0,0,0,0xf9d,0,0,0,0,0xfa2,0,0,0,0,0xfa7,
+0,0,0,0,0xfac,0,0,0,0,0,0,0xf76,0xf78,0,0x80000000,0,
+0x80000000,0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,0,0,
+0,0,0x80000000,0,0x80000000,0x80000000,0,0,0,0,0,0x80000000,0,0,0,0,
+0,0,0,0,0,0,0x80000000,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0,0,0,0,0,0x40000000,0,0x40000000,0,
+0x40000000,0,0x40000000,0,0x40000000,0,0,0,0,0x80000000,0x80000000,0,0,0,0,0x40000000,
+0,0x40000000,0,0x40000000,0x40000000,0,0,0x40000000,0,0x80000000,0,0,0,0,0,0,
+0,0,0,0,0,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,
+0,0,0x80000000,0,0,0,0x80000000,0x80000000,0,0,0,0,0,0,0x2000,0x2001,
+0,0,0,0,0,0,0,0,0,0,0,0,0x80000000,0,0,0,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x40000000,0,0x40000000,0,0x40000000,
+0,0,0,0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,
+0x40000000,0,0,0x40000000,0,0,0,0,0x40000000,0,0x40000000,0,0,0,0,0,
+0,0,0,0,0,0x40000000,0,0x40000000,0,0,0x40000000,0,0,0,0,0x40000000,
+0,0,0x40000000,0x40000000,0,0,0,0,0,0,0,0,0,0,0x40000000,0x40000000,
+0,0,0x40000000,0x40000000,0,0,0x40000000,0x40000000,0x40000000,0x40000000,0,0,0x40000000,0x40000000,0,0,
+0x40000000,0x40000000,0,0,0,0,0,0,0,0,0x40000000,0,0,0,0,0,
+0x40000000,0x40000000,0,0x40000000,0,0,0,0,0x40000000,0x40000000,0x40000000,0x40000000,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2adc,0,0,0,0,0,0,
+0,0,0x2329,0x232a,0,0,0,0,0,0,0x40000000,0,0,0,0,0x40000000,
+0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0x40000000,0,0,
+0x40000000,0,0x40000000,0,0x40000000,0,0,0,0,0,0,0x40000000,0,0,0x40000000,0,
+0,0x40000000,0,0,0x40000000,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,
+0,0,0x40000000,0,0,0x40000000,0x40000000,0x40000000,0,0,0,0,0,0,0,0,
+0,0,0x40000000,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f80c,0,0,0,0,0,0,0,0,0,0x2f813,0,0x2f9ca,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f81f,0,0,
+0,0,0,0x2f824,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f867,0,0,0,0,0,0,0,0,0,0,0,0,0x2f868,
+0,0,0,0x2f876,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f883,0,0,0x2f888,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f88a,0,0,0,0,0,0,0,0x2f896,0,0,0,
+0,0,0,0,0,0x2f89b,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f8a2,0,0,0,0,0,0,0,0,0,0,0x2f8a1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f8c2,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8c7,0,0,0,0,0x2f8d1,0,
+0,0,0,0,0,0,0,0,0,0,0x2f8d0,0,0,0,0,0,
+0,0,0,0,0x2f8ce,0,0,0,0,0,0,0,0,0,0x2f8de,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x200039,0,0,0,
+0,0,0,0,0,0x2f8ee,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f8f2,0,0,0,0x2f90a,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f916,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f92a,0,0,0,0,0,0,0,0,0x200041,0,0,0,0,
+0,0,0,0,0,0,0,0x2f933,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f93e,0,0,0,0,0,0,0,0,0x2f93f,0,0,
+0,0,0,0,0,0,0xfad3,0,0,0,0,0,0,0,0,0,
+0x200047,0,0,0,0,0,0,0x2f94b,0,0,0,0,0,0,0,0,
+0,0x2f94c,0,0,0,0,0,0,0,0,0,0x2f951,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f958,0,0,0x2f960,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f964,0,0,0,
+0,0,0,0,0,0x2f967,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f96d,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f971,0,0,0,0,0,0,0,0,0,0,0,
+0x2f974,0,0,0,0,0,0,0x2f981,0,0,0,0x2f8d7,0,0,0,0,
+0,0,0,0,0,0,0,0x2f984,0,0,0,0,0,0,0,0,
+0,0,0,0x2f98e,0,0,0,0,0,0,0,0,0,0,0,0x2f9a7,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9ae,0,0,
+0x2f9af,0,0,0,0,0,0,0,0,0,0x2f9b2,0,0,0,0,0,
+0,0,0x2f9bf,0,0,0,0,0,0,0,0,0,0x2f9c2,0,0,0,
+0,0,0,0x2f9c8,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f9cd,0,0,0,0,0,0,0,0x2f9ce,0,0,0,0,0,
+0,0,0,0x2f9ef,0,0,0,0,0,0,0,0,0,0,0x2f9f2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f9f8,0,0,
+0,0,0,0,0x2f9f9,0,0,0,0,0,0,0,0,0,0x2f9fc,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2fa03,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2fa08,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2fa0d,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2fa0e,0,0,0,0,0,0,0,
+0,0x2fa11,0,0,0,0,0,0,0,0x2fa16,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf967,0,0,0,0,0,0,0xfa70,0,
+0,0,0,0,0,0,0,0,0xf905,0,0,0,0,0,0x2f801,0xf95e,
+0,0,0,0x2f800,0,0,0x2f802,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf91b,0,0,0,0xf9ba,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf977,0,0xf9fd,0,0,0,0,0,
+0,0,0,0,0,0,0x2f819,0,0,0,0,0xf9a8,0,0,0,0,
+0,0,0,0,0,0,0,0x2f804,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xfa73,0,0,0,0,0,0xf92d,0,0,
+0,0,0xf9b5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x20004f,0,0,0,0,0,0,0,0,0,0,0,0x2f806,0,0,
+0,0xf965,0,0,0x2f807,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf9d4,0,0,0,0,0,0,0,0,0,0,0x2f808,0,0,
+0,0,0,0,0,0,0,0x2f809,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f80b,0,0,0,0,0,0,0,0,
+0,0,0xf9bb,0,0,0,0,0,0,0,0x200057,0,0,0,0,0,
+0,0,0,0xfa0c,0,0,0,0,0xfa74,0,0,0,0,0,0,0,
+0x20005f,0,0,0,0,0x2f80f,0,0,0,0,0,0,0,0,0,0,
+0,0x2f810,0,0,0x2f814,0xfa72,0xf978,0,0,0,0xf9d1,0,0,0,0,0,
+0,0,0x2f811,0,0,0,0,0,0,0,0,0xfa75,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f815,0,0,0x2f8d2,0,0,0x2f8d3,0,
+0x2f817,0,0,0,0,0,0,0,0,0x2f818,0,0,0,0,0,0,
+0,0x2f81a,0,0,0,0,0,0x200067,0,0xf92e,0,0,0,0,0,0,
+0,0,0,0xf979,0,0,0xf955,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf954,0,0xfa15,0,0,0,0,0,0x2f81d,0,0,0,0,
+0,0,0,0,0,0,0x2f81e,0,0,0,0x20006f,0,0,0,0,0,
+0,0,0,0xf99c,0,0,0,0,0,0,0,0,0,0xf9dd,0,0,
+0,0,0,0,0,0,0,0,0xf9ff,0x2f820,0,0,0,0,0,0,
+0x2f821,0,0,0,0,0,0,0,0,0,0x2f822,0,0,0,0,0x2f823,
+0,0,0,0,0,0,0,0,0,0xf9c7,0,0,0,0,0,0,
+0,0,0,0,0,0xf98a,0,0,0,0,0xf99d,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f992,0,0,0,0,0,0,0,0,
+0,0,0,0,0x200077,0,0x20007f,0,0,0,0,0,0,0xf952,0,0,
+0,0,0,0,0,0,0,0,0,0xf92f,0,0,0,0,0x200087,0,
+0,0,0,0,0,0,0,0,0,0,0xf97f,0,0,0,0,0x20008f,
+0,0,0,0,0,0x2f829,0x2f82a,0,0,0,0,0,0,0,0,0,
+0x200097,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf9eb,0,0,0,0,0,0,0,0,0,0x2f82c,0,0,0,0,0,
+0,0x20009f,0,0,0,0,0,0,0,0,0x2f82e,0,0,0,0,0,
+0x2f82f,0,0xf91c,0,0,0,0,0,0,0,0x2f830,0,0x2000a7,0,0,0,
+0xf96b,0,0,0,0,0,0,0x2f836,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f837,0,0,0,0,0,0xf906,0,0,
+0,0,0,0x2f839,0,0,0,0,0x2f83a,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f83b,0,0,0,0,0,0,0,0,
+0xf9de,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf9ed,0,
+0,0,0,0,0,0,0,0x2f83d,0,0,0,0,0,0,0,0xf980,
+0,0,0,0,0,0x2f83e,0,0,0,0,0,0,0,0,0x2f83f,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f83c,0,0,
+0x2f840,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf99e,0,
+0,0,0,0,0,0x2f841,0,0,0,0,0,0,0,0,0,0x2f842,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f843,
+0,0xfa79,0,0,0,0,0,0,0,0,0,0,0x2f844,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2000ad,0,0,0xf90b,0,0,0,
+0,0,0,0,0,0,0x2000b3,0,0,0,0x2000bb,0,0,0,0,0,
+0,0,0,0,0,0,0x2f848,0,0,0,0,0x2f849,0,0,0,0,
+0,0,0,0,0,0,0,0,0xfa0d,0,0x2f84a,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xfa7b,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2000c0,0,0,0,0,0,0,0,0,0,
+0x2f84e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xfa38,
+0,0,0,0,0,0,0,0x2f84f,0,0,0,0,0,0,0,0,
+0,0,0,0xf9a9,0,0,0,0,0,0,0x2f84b,0x2f84d,0,0,0,0,
+0,0,0,0,0,0,0,0x2f855,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f852,0,0,0,0,0x2f853,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f854,0,0,0x2f857,0x2f856,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xfa39,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2000c8,0,0,0,0xf96c,
+0,0,0,0,0,0,0,0,0xfa3a,0,0,0,0x2f858,0,0,0,
+0xfa7d,0,0,0,0,0,0,0,0,0,0,0,0,0xf94a,0,0,
+0,0,0,0,0xf942,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f851,0,0,0x2f85a,0,0,0,0,0x2f85b,0,0,0,0,
+0,0,0,0,0x2f85c,0,0,0,0,0,0,0,0,0,0,0x2f85d,
+0,0,0,0,0,0x2f85e,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xfa7e,0,0,0,0xf90c,0,0,0,0,0,0,0,0xf909,
+0,0,0xfa7f,0,0,0,0,0,0,0,0,0,0,0,0x2f85f,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf981,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f865,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f862,0,0,0,0,0,0,0,0,0,
+0,0,0x2f863,0,0,0,0,0,0,0,0x2f864,0,0,0,0,0,
+0,0,0,0xfa80,0,0,0,0x2f866,0,0,0,0,0,0,0,0,
+0,0x2f986,0,0,0,0,0,0,0,0,0,0,0x2f869,0,0,0,
+0,0,0,0,0,0xfa81,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2000cd,0,0,0,0,0,0xfa04,0,0,0,0,0,
+0,0,0,0,0,0x2f86d,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f86e,0,0,0,0,0,0,0,0x2000d3,0,0,0,0,0,
+0,0xf9bc,0,0,0,0x2f870,0,0,0,0,0,0,0,0,0,0,
+0,0x2f872,0,0,0,0,0,0,0x2f873,0,0,0,0,0,0,0,
+0,0,0x2f875,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf9bd,0x2f877,0,0xf94b,0,0xfa3b,0xf9df,0,0,0,0,0,0,0,
+0,0x2000dd,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f87a,
+0,0,0x2f879,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf9d5,0,0,0,0,0,0,0x2f87c,0,0,0,0,0,0,
+0,0,0,0,0,0,0xf921,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f87f,0,0,0x2f87e,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f880,0,0,0,0x2f9f4,0,0,0,0,0,
+0,0,0xf9ab,0,0,0,0,0,0x2f881,0x2f882,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f884,0,0,0,0,0,0,0,0,
+0x2f885,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f886,0,
+0,0,0,0,0,0,0,0,0x2f887,0,0,0,0,0,0,0xf98e,
+0,0,0,0,0,0,0,0,0,0,0,0xfa01,0,0,0,0,
+0,0,0,0,0,0x2f88b,0,0,0x2f88c,0,0,0x2f88d,0,0,0,0,
+0,0,0,0,0,0xf9a2,0x2000e5,0,0,0,0,0,0xfa82,0xfa0b,0,0,
+0,0,0,0xfa83,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf982,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f890,
+0,0,0,0,0xf943,0,0,0,0,0,0,0,0,0,0,0,
+0x2000ed,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f874,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f899,0,0,0,0,
+0,0,0xfa84,0,0x2f89a,0,0,0,0,0,0,0,0,0,0,0,
+0xf9d8,0,0,0,0,0,0,0,0,0,0,0x2f89c,0,0,0,0,
+0,0,0,0,0,0xf966,0,0,0,0xfa85,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f89d,0,0,0,0,0,0,0,0x2f89e,
+0,0,0,0,0,0,0,0,0xf9a3,0,0,0,0x2f89f,0,0,0,
+0,0,0,0xf960,0,0,0,0,0,0,0,0,0,0xf9ac,0,0,
+0,0,0,0xfa6b,0,0,0,0,0,0,0,0,0,0,0x2f8a0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2000f3,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8a5,0,0,0,0,0,0,
+0,0,0xfa86,0,0,0,0,0,0,0,0xf9b9,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xfa88,0,0,0,0,0,0,
+0,0xf9d9,0,0,0,0x2f8a6,0,0,0,0x2000fb,0,0x200105,0,0xfa8a,0,0,
+0,0,0,0,0,0xfa3e,0,0,0,0,0,0,0,0,0,0,
+0x2f8aa,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x20010d,
+0,0xf98f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f8ad,0,0,0,0,0,0,0,0,0,0,0x2f8ae,0,0,0x2f8ac,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8af,0,
+0,0x200117,0,0,0,0x200121,0,0,0,0,0,0,0,0,0,0xf990,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8b2,
+0,0,0,0,0,0,0,0,0,0,0x2f8b3,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf9d2,0,0,0,0,0xfa8c,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f8b4,0,0,0x2f8b5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf925,0,
+0,0,0,0,0xf95b,0,0,0,0xfa02,0x2f8b6,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f8ba,0,0xf973,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f8b9,0,0,0x2f8b7,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8bb,0,0,0,0,0,0,
+0,0,0,0,0,0xf9a4,0,0,0,0,0x2f8bc,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf975,0,0,0,0,0,0,0,0,
+0x2f8c1,0,0,0,0,0,0,0xfa8d,0x2f8c0,0,0,0,0,0,0,0,
+0,0,0,0x2f8bd,0,0,0,0,0,0,0,0,0,0,0,0,
+0xfa8e,0,0,0,0x2f8bf,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xfa8f,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f8c3,0,0,0,0,0,0,0,0x2f8c6,0,0,0,0,0,0,0x2f8c4,
+0,0,0,0,0,0,0,0,0,0,0xf991,0,0,0x2f8c5,0,0,
+0,0,0xf930,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x200129,0,0,0,0,0,0,0xfa90,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f8c9,0,0,0,0,0,0,0,0,0xf969,
+0,0,0,0,0,0,0,0,0,0xf9be,0,0,0,0,0,0,
+0xf983,0,0,0,0,0,0,0,0,0,0,0xfa42,0x2f8cb,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf9e0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f8cd,0,0,0,0,0,0,0x200131,0,0,
+0,0,0,0,0,0,0,0,0,0xf9c5,0,0,0,0,0,0,
+0,0x200136,0,0,0,0,0,0,0,0,0,0,0x2f8d5,0,0,0,
+0,0xfa06,0,0,0,0,0,0,0,0,0,0,0,0xf98b,0,0,
+0,0,0,0,0,0,0,0xf901,0,0,0,0x2f8cc,0,0,0,0,
+0,0,0,0x2f8d4,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x20013e,0,0,0,0x200148,0,0,0,0,0x2f8da,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf9e1,0,0,0,0x2f8dc,
+0,0,0xfa94,0,0,0,0,0,0,0,0x2f8db,0,0,0,0,0,
+0,0,0,0,0,0,0xf9c8,0,0,0,0,0,0x2f8e0,0,0,0,
+0,0,0,0,0,0,0,0xf9f4,0,0,0,0,0,0,0,0,
+0xf9c9,0,0,0,0,0,0,0x2f8df,0,0,0,0,0,0,0,0xf9da,
+0,0,0,0,0,0,0,0x2f8e5,0,0,0x2f8e1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf97a,0,0,0,0x200150,0,0,0,
+0,0,0,0,0,0x2f8e4,0,0,0,0,0,0,0,0,0xf9e2,0,
+0,0,0,0,0,0,0x2f8e6,0,0,0,0,0,0,0,0,0,
+0,0,0x2f8e8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f8e9,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8ea,0,0,
+0,0,0,0x200158,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf94c,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8eb,0,
+0,0,0,0,0,0,0xf931,0,0,0,0,0,0,0,0x2f8ed,0,
+0,0,0,0xf91d,0,0,0,0,0,0,0,0,0,0,0,0x2f8ef,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8f1,0,
+0,0,0,0,0,0,0,0,0,0,0x2f8f3,0,0,0,0,0xf98c,
+0,0xfa95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f8f4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf9a5,0,0,0,0,0,0,0,0,0,0,0x20015f,0x2f8f6,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f8fa,0,0,0,0,
+0,0,0,0x2f8fe,0,0,0,0,0,0,0,0,0xf972,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f8fc,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf968,0x2f8fd,0,0,0,0,0,
+0xf9e3,0,0,0,0,0,0,0,0,0,0,0x2f8ff,0,0,0,0,
+0xf915,0,0,0xfa05,0,0,0,0,0x2f907,0,0,0,0,0,0,0,
+0,0,0x2f900,0,0x200169,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f903,0xf92a,0,0,0,0,0,0,0,0x200173,0x2f904,0,0,
+0,0,0,0,0,0x2f905,0,0,0,0,0,0,0,0,0,0,
+0,0xf9f5,0,0,0,0,0,0,0,0,0,0,0xf94d,0,0,0,
+0,0,0,0,0,0,0,0xf9d6,0,0,0,0,0,0,0,0,
+0,0x2f90e,0,0,0,0,0,0,0,0,0,0,0xfa46,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f908,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f909,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf9cb,0,0,0,0,0,0,0,
+0,0,0,0xf9ec,0,0,0,0,0,0,0,0x2f90c,0,0,0,0x20017b,
+0,0,0,0,0xf904,0,0,0,0,0,0,0,0,0,0xfa98,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf94e,0,
+0,0x200183,0xf992,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f90f,0,0,0,0,0,0,0x2f912,0,0,0,0,0,0,0,
+0,0,0,0,0xf922,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xf984,0,0,0,0,0,0,0,0,0,0,0,0x2f915,
+0,0,0x200188,0,0,0,0,0,0,0,0,0,0x2f913,0,0,0,
+0,0,0,0,0,0,0,0x2f917,0,0,0,0,0,0x2f835,0,0,
+0,0,0,0,0x2f919,0,0,0,0,0,0x2f918,0,0,0,0,0,
+0,0,0,0,0xf9fb,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f91a,0,0,0,0,0,0,0,0,0xf99f,0,0,0,0,
+0,0,0,0,0,0xf916,0,0,0,0,0,0,0x2f91c,0,0,0,
+0xf993,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x200190,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f91e,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf9c0,0,0xf9ee,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf932,0,0,
+0,0,0,0,0,0,0,0,0xf91e,0,0,0,0,0,0,0,
+0,0x2f920,0,0,0xfa49,0,0,0,0,0,0x200195,0,0,0,0,0,
+0,0,0,0,0,0x2f922,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf946,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f924,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f925,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0xfa9f,0xf9fa,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf92b,0,0,0,0,0,0,0,0,0,0,0x20019d,
+0,0,0,0,0,0xf9a7,0,0,0,0,0x2f928,0,0,0,0,0,
+0,0,0x2001a2,0,0,0,0x2f929,0,0,0,0,0,0x2f92b,0,0,0,
+0,0,0,0,0,0,0,0xf9ad,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xf917,0,0,0,0,0,0,0xf9e4,0,0,
+0xf9cc,0,0,0,0,0,0,0xfa4a,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f92e,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f92f,0,0,0,0,0,0,0,0,0,0xf9ae,0,0,0,
+0,0,0,0x2001a7,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x2f931,0,0,0,0xf994,0,0,0,0,0,0,0,0,0xf9ef,
+0,0,0,0,0,0,0,0,0,0,0x2f932,0,0,0,0,0,
+0,0xfaa2,0,0,0,0,0,0,0,0,0,0x2f934,0,0,0,0,
+0,0,0,0,0,0,0,0xfaa3,0,0,0x2f936,0,0,0,0,0,
+0,0,0,0,0xf9cd,0,0,0,0,0,0,0xf976,0,0,0,0,
+0,0,0,0,0,0,0x2001af,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xf9e5,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f93a,0,0,0,0,0,0,0,0,0,0,0,
+0,0xfaa4,0,0xfaa5,0,0,0xf9c1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf90e,0,0,0,0,0,0,0,0,0,0,0x2001b7,
+0,0,0,0,0,0,0,0,0,0,0,0xfaa7,0,0,0,0,
+0,0,0,0xf933,0,0,0,0,0,0,0,0,0x2001bc,0,0,0,
+0,0,0,0,0,0,0,0,0xf96d,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f945,0x2001c4,0xfaaa,0,0,0,0,0,0,
+0,0,0,0x2001ca,0,0,0,0,0,0,0,0,0,0,0,0x2f94a,
+0,0,0,0,0,0,0,0xfa9d,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f94e,0,0,0,0,0,0,0,0,0,
+0,0,0xf9ce,0,0,0,0,0,0,0,0,0,0,0,0,0x2001d2,
+0,0,0,0xfa4b,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf947,0,0x2001da,0,0,0,0,0,0,0,0,0,0,0,
+0xf964,0,0,0,0,0,0,0,0,0,0,0xf985,0,0,0,0,
+0,0,0,0,0,0,0,0,0xfa18,0,0xfa4c,0,0,0,0,0,
+0,0,0,0xfa4e,0xfa4d,0,0,0,0,0,0,0xfa4f,0,0,0,0,
+0,0x2001e2,0,0,0,0,0,0,0xfa51,0xfa19,0,0,0,0,0,0xfa1a,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf93c,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xfa52,0xfa53,0x2001ea,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf9b6,0,
+0,0,0,0,0,0,0,0,0,0xf995,0,0,0,0,0,0,
+0,0,0,0,0,0x2f957,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf956,0,0,0,0x2001f2,0,0,0,0,0,0,0,0,0,
+0x2f95a,0,0,0,0,0x2f95b,0,0xfa55,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0xfaac,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9f7,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0x2f95f,0,0xf9f8,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2001fa,0,0,0,0,0,0x2f962,0,0,0x2f963,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf9a6,0,
+0xf944,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xfaae,0,0,0,0,0xf9f9,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xfa1d,0,0,0x2f966,0,0,0,0xfa03,0,0,0,0,
+0,0,0,0,0,0x2f969,0,0,0,0xf97b,0x2f968,0,0,0,0,0,
+0,0,0x2f96a,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf9cf,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf96a,0,0,0,0,0,0,0,0,0,0,0,0,0xf94f,
+0,0,0,0,0,0,0,0,0,0,0,0xfaaf,0,0,0,0,
+0x2f96c,0,0,0,0,0,0,0,0,0,0,0,0,0xf93d,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf957,0,0,
+0,0,0,0,0,0x2f96e,0,0,0,0,0,0,0,0,0x2001ff,0,
+0,0,0,0,0,0,0,0,0,0,0x2f96f,0,0,0,0,0,
+0,0xfa58,0,0,0,0,0,0,0,0xf950,0,0,0,0,0,0,
+0,0,0xfa59,0,0,0,0x2f970,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xfab1,0,0,0xfa5a,0,0,0,0,0,0,0xf9e6,
+0x2f976,0,0,0,0,0,0xf90f,0,0,0,0,0,0,0,0,0,
+0,0x2f978,0,0,0,0,0xf9af,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xfa1e,0,0,0,0,0,0,0,0,0,0,0x2f979,
+0,0,0,0,0,0xf934,0,0,0,0x200206,0,0,0,0,0,0,
+0,0,0,0,0xf9b0,0,0,0,0,0,0,0,0,0,0x2f97d,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf997,0x2f97f,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf945,0,0,0,
+0,0,0,0,0,0,0,0,0xf953,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f8d6,0,0,0x2f982,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f983,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f985,0,0,0,0,0,0,0,0,0xf926,
+0,0,0,0,0,0,0,0,0xf9f6,0,0,0,0,0xfa5c,0,0,
+0x200210,0,0,0x2f98c,0,0,0,0,0,0,0,0,0,0,0,0xfa6d,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf97c,
+0,0,0,0,0,0,0,0,0,0x20021a,0,0,0,0,0,0,
+0,0,0,0,0,0x2f990,0,0,0,0,0x2f98f,0,0,0,0,0,
+0,0,0,0,0,0,0x2f991,0,0,0x2f993,0,0x2f994,0,0,0,0,
+0,0,0,0,0,0x2f995,0,0,0,0,0,0x20021d,0x2f996,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f999,0,0,0,0x2f99c,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf9fe,0,0,0,0,
+0,0,0,0,0,0xfab3,0x2f9a0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f99a,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f99b,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f99d,
+0,0,0,0,0,0,0,0,0,0xf93e,0x2f9a1,0,0x2f9a2,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f9a3,0,0,0,0,0,0,
+0,0x2f99e,0,0,0,0,0,0,0,0xfab4,0,0xf958,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0xf918,0,0,0,0,0,
+0,0,0,0,0xf96e,0,0,0,0,0,0,0,0x200225,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0xf999,0,0x2f9a8,0,0x2f9a9,
+0,0,0,0,0,0,0,0,0xf9c2,0,0,0,0,0,0,0x2f9aa,
+0,0,0,0,0,0,0,0,0,0x2f9ac,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf923,0,0,0,0,0,0,0,0,
+0,0,0xf9f0,0,0,0,0,0,0,0xf935,0,0,0,0,0,0,
+0,0,0,0xfa20,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf91f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf910,0x2f9b3,0,0,0,0,0,0,0,0,0,0,0,0x20022d,0,
+0,0,0,0,0,0,0x2f9b5,0,0x2f9b6,0,0,0,0,0,0,0,
+0,0x2f9b8,0,0,0,0,0,0,0,0,0,0x2f9b7,0,0,0,0,
+0,0,0x2f9ba,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f9b9,0,0,0,0,0,0,0,0,0x2f9bc,0,0,0,0,0,
+0,0,0,0,0,0,0x2f9bd,0,0,0,0,0,0,0,0,0,
+0x200235,0,0,0,0,0,0,0x2f9be,0,0,0,0,0,0,0,0,
+0,0,0xf911,0,0,0,0,0,0x2f9c0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f9c1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf927,0,0,0,0,0,0,0,0,
+0,0,0,0,0xfa08,0,0,0,0x2f9c3,0,0,0x2f9c4,0,0,0,0,
+0,0,0,0,0,0,0,0,0xf9a0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9e7,0,0,0,0,0,0,0,0x2f9c6,0,0,
+0,0,0,0,0x2f9c7,0,0xf9e8,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf912,0,0x2f9c9,0,0,0,0,0,0xfa60,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xfab6,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xf924,0,0,0,
+0,0,0,0,0,0,0,0,0xfab7,0,0,0,0,0xfa0a,0,0,
+0,0,0,0,0x20023d,0,0,0,0,0,0,0,0,0,0x2f9cf,0,
+0,0,0,0,0,0,0,0,0x200242,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0xfab9,0,0,0,0,0,0,0,
+0,0,0,0,0xfabb,0,0,0,0,0xf97d,0,0,0,0xf941,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x200247,0,0,0,0,
+0,0,0,0,0x20024f,0,0,0,0,0,0x200254,0,0x200259,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x20025e,0,0,0,0,
+0,0,0,0,0xf9fc,0,0,0,0,0,0,0,0xf95a,0,0,0,
+0,0,0,0,0,0,0x200263,0,0,0,0,0,0,0,0,0xf900,
+0,0,0,0,0,0,0,0x2f9d2,0,0,0,0,0,0,0,0,
+0,0,0,0x2f9d4,0,0,0,0,0x2f9d5,0xf948,0,0,0,0,0,0xf903,
+0,0,0,0,0,0,0,0xfa64,0,0,0,0,0,0,0,0,
+0,0,0,0,0x20026b,0,0,0,0,0,0,0,0,0,0,0,
+0x2f9d6,0,0,0,0,0,0,0,0x2f9d7,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f9db,0,0,0,0,0,0,0,0,0,0,
+0,0x2f9da,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xf937,0x2f9dc,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf902,0,0,0,0,0,0x2f9de,0,0,0,0,0,0,0,
+0,0,0,0,0xf998,0,0,0,0xf9d7,0,0,0,0,0,0,0,
+0,0x200270,0,0,0xfa07,0,0,0,0,0xf98d,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f98d,0,0xf971,0,0,0,0,0,
+0xfa66,0,0,0,0,0,0,0,0,0,0xf99a,0,0,0,0,0,
+0,0,0,0,0,0,0,0x200278,0,0,0,0,0,0,0,0xfac3,
+0,0,0,0,0,0,0,0,0,0xf9c3,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf913,0,0,0,0,0x2f9e2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0xf92c,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0xfa2e,0,0x2f9e3,0,
+0,0,0,0,0,0,0,0,0,0,0xfa26,0,0,0x2f9e4,0,0,
+0,0,0,0,0,0,0,0x2f9e6,0,0,0,0,0,0,0,0,
+0,0,0xf919,0,0,0,0,0,0,0,0,0,0xfac4,0,0,0,
+0,0,0,0xf9b7,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf9e9,0,0,0xf97e,0,0xf90a,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf9b1,0,0,0,0x2f9e7,0,0,0,0,0,0,0,
+0xfac5,0,0,0,0,0,0x2f9ea,0,0,0,0,0,0,0,0x2f9e8,0x2f9e9,
+0,0,0,0,0,0,0,0xf93f,0,0,0,0,0,0,0,0,
+0,0,0,0xf99b,0,0,0,0,0,0,0,0,0,0x2f9eb,0,0,
+0,0,0,0,0x2f9ec,0,0,0,0,0,0,0,0,0,0,0,
+0x2f9ee,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf986,0,
+0,0,0,0,0,0,0x2f9f0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0xf9c6,0,0,0,0,0,0,0,0,0,0,
+0,0xf951,0,0xfa09,0,0,0,0,0,0xf959,0,0,0xf9d3,0,0,0,
+0xfac6,0,0,0,0,0,0,0xf9dc,0,0,0,0,0,0,0,0,
+0,0xf9f1,0,0,0,0,0,0,0,0,0,0,0,0,0xfa2f,0xf9b8,
+0,0,0,0,0,0,0,0x2f9f3,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf9ea,0x20027d,0,0,0,0,0,0,0,0,0,0,
+0,0,0xf9b2,0xf949,0,0,0,0,0,0,0,0,0x2f9f5,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf938,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xf9b3,0,0,0,0,0,0,0,0x200282,
+0,0,0,0,0,0,0,0,0,0,0,0xfac9,0,0,0,0,
+0x2f9fa,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x200287,0,0,0,0,0,0,0,0,0,0,0,0x20028c,0,0,0,
+0,0,0,0,0,0xf9b4,0,0,0,0,0,0,0,0,0,0x2fa00,
+0,0,0,0,0,0,0,0,0,0,0,0x200294,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0xf9d0,0,0,0x2fa02,0,0,
+0,0,0,0,0,0,0,0,0,0,0xfa2a,0,0,0,0,0,
+0,0,0,0,0,0,0,0xfa2b,0,0,0,0,0,0,0,0,
+0xfa2c,0x2fa04,0,0,0,0,0,0,0,0x2fa05,0,0,0,0,0,0,
+0,0,0x2fa06,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0xf91a,0,0,0,0,0,0,0,0,0,0,0,0,0x2fa07,0,0,
+0,0,0,0,0,0,0,0,0xf987,0,0,0,0,0,0x200299,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf939,0x2fa0b,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf9f2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2fa0c,0,0,
+0,0,0,0,0,0x2fa0f,0,0,0,0,0,0,0,0,0xfa2d,0,
+0,0,0,0,0,0,0,0,0,0,0xf93a,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf920,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf940,0,0,0,0,0,0,
+0,0xf988,0,0,0,0,0,0,0,0xf9f3,0,0,0,0,0,0,
+0,0,0,0,0,0x2fa15,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0xf989,0,0,0,0,0,0,0,0,0,0x2fa17,0,
+0,0,0,0x2fa18,0,0,0,0,0,0x2fa19,0,0,0,0,0,0,
+0,0,0,0x2fa1a,0,0,0,0,0,0,0x2fa1b,0,0,0,0,0,
+0,0,0,0,0,0,0x2fa1c,0,0,0,0,0xfad8,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0xf9c4,0xfad9,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2002a1,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0,0x80000000,0x80000000,0x80000000,0,0,0x80000000,
+0x80000000,0,0,0,0,0,0x80000000,0x80000000,0,0,0,0,0,0,0,0,
+0x80000000,0x80000000,0x80000000,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,
+0x40000000,0,0x40000000,0,0,0,0,0x40000000,0x40000000,0x80000000,0x80000000,0,0,0,0,0,
+0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,
+0x80000000,0,0,0,0x80000000,0,0,0,0,0,0,0,0,0,0x80000000,0,
+0,0,0,0,0,0,0,0x40000000,0x80000000,0,0,0x80000000,0,0,0,0,
+0,0,0,0,0x40000000,0x40000000,0,0,0,0,0,0x80000000,0,0,0,0,
+0x40000000,0,0,0,0,0,0,0,0x80000000,0x80000000,0,0,0x80000000,0,0x80000000,0x80000000,
+0,0,0,0,0,0,0,0,0,0,0x1d15e,0x2002a6,0,0,0,0,
+0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0x80000000,0x80000000,0x80000000,0,0,
+0,0,0,0,0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0,0x80000000,0x80000000,
+0x80000000,0x80000000,0,0,0,0,0,0,0,0,0,0x2002ac,0x2002ba,0,0,0,
+0,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0x80000000,0x80000000,0x80000000,
+0x80000000,0x80000000,0,0x80000000,0x80000000,0,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,
+0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0,0,0,0,0,0x2f803,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f812,0,0,0,0,0,
+0x2f91b,0,0,0,0,0,0,0,0,0,0,0,0x2f816,0,0,0,
+0,0,0,0,0,0,0,0x2f80d,0,0,0,0,0,0x2f9d9,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f9dd,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f834,0,0,0,0x2f838,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f859,0,0,0,0,0,
+0,0,0,0,0,0,0x2f860,0,0,0,0,0,0,0,0,0,
+0,0x2f861,0,0,0,0,0,0,0,0,0x2f86c,0,0,0,0,0,
+0,0,0,0x2f871,0,0,0,0,0,0,0,0,0,0,0,0x2f8f8,
+0,0,0,0,0x2f87b,0,0x2f87d,0,0,0,0,0,0,0,0,0,
+0x2f889,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f939,0,0x2002c8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f8a4,0,0,0,0,0,0,0,0,0,0,0,0xfad0,0,0,
+0,0,0,0xfacf,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f8b8,0,0,0,0x2f8be,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f8ca,0,0,0,0,0,0,0,0,0x2f897,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f980,0,0,0,
+0x2f989,0,0,0,0,0,0,0,0,0x2f98a,0,0,0,0x2f8dd,0,0,
+0,0,0,0,0,0,0,0,0,0,0xfad1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0x2f8e3,0,0,0,0x2f8ec,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f8f0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2f8f7,0,0,0,0,0,0,0,0,
+0,0,0x2f8f9,0,0,0,0,0,0,0,0,0,0,0,0,0x2f8fb,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f906,0,
+0x2f90d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f910,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f911,0,
+0,0,0x2f91d,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0xfa6c,0,0,0,0,0,0,0,0,0,0,0,0x2f91f,0,0,
+0,0,0,0,0,0,0x2f923,0,0,0,0,0,0,0,0x2f926,0,
+0,0,0,0,0,0,0,0,0,0x2f927,0,0,0,0,0,0,
+0,0,0,0,0,0x2f935,0,0,0,0,0,0,0,0,0,0x2f937,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f93b,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f93c,0,0,0,
+0,0,0,0,0x2f93d,0,0,0,0,0,0,0,0,0,0,0,
+0x2f942,0x2f941,0,0,0,0,0,0,0,0,0,0,0,0,0x2f943,0,
+0,0,0,0,0,0x2f944,0,0,0,0,0,0,0,0,0,0,
+0,0,0xfad5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x2f94d,0,0,0,0,0,0,0x2f952,0,0,0,0,0,0,0,0,
+0,0,0x2f954,0,0,0,0,0,0x2f955,0,0,0,0,0,0,0,
+0,0,0,0,0,0x2f95c,0,0,0,0,0,0,0,0x2002ce,0,0,
+0,0,0,0,0,0,0,0,0,0x2f961,0,0,0,0,0x2f965,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xfad6,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f96b,0,
+0,0,0,0,0,0,0,0,0,0x2f898,0,0,0,0,0,0,
+0,0,0x2f972,0,0,0,0,0,0,0,0x2f973,0,0,0,0,0,
+0,0,0,0,0x2f975,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2f977,0,0,0,0,0,0,0,0,0,0,0x2f97b,0,
+0,0,0,0,0x2f97c,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f97e,0,0,0,0,0,0,0,0x2f987,0,0,0,0,0,0,
+0,0,0x2f988,0,0,0,0,0,0,0,0,0,0,0,0,0x2f997,
+0,0,0,0,0,0,0x2f9a4,0,0,0,0,0,0,0,0,0,
+0x2f9a6,0,0,0,0,0,0,0,0,0,0,0,0x2f9a5,0,0,0,
+0,0,0,0,0,0,0,0,0,0x2f9ad,0,0,0,0x2f9b0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2f9b1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f9ab,0,0,0,0,0,
+0,0,0x2f9c5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x2f9cb,0,0,0,0,0,0,0x2f9cc,0,0,0,0,0,0,0,
+0,0,0x2f9d3,0,0,0,0,0,0,0,0xfad7,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f9d8,0,0,0x2f9e0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2f9e1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x2f9e5,0,0,0,0,0,
+0,0,0,0,0,0x2f9ed,0,0,0,0,0,0,0,0x2f9f1,0,0,
+0,0,0,0,0,0,0x2f9f6,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x2f81c,0,0,0,0,0,0,0,0,0,
+0,0x2f9f7,0,0,0,0,0,0,0,0,0,0,0x2f9fb,0,0,0,
+0,0,0,0x2f9fd,0,0,0,0,0,0,0,0,0,0x2fa01,0,0,
+0,0,0,0,0,0,0,0x2fa09,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0x2fa10,0,0,0,0,0,0x2fa12,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2fa13,0,0x2fa14,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f88f,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x2fa1d,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const UCPTrie norm2_nfc_data_canonIter_trie={
+    norm2_nfc_data_canonIter_trieIndex,
+    { norm2_nfc_data_canonIter_trieData },
+    4794, 11387,
+    0x2a800, 0x2b,
+    1, 1,
+    0, 0,
+    0x178, 0xee,
+    0x0,
+};
+
+static const uint16_t norm2_nfc_data_canonStartSets[724]={
+4,0x1ffb,0x1ffc,0x2126,0x2127,6,0x1f77,0x1f78,0x1fbe,0x1fbf,0x1fd3,0x1fd4,4,0x1f7b,0x1f7c,0x1fe3,
+0x1fe4,2,0xfb2e,0xfb31,4,0xfb31,0xfb32,0xfb4c,0xfb4d,4,0xfb35,0xfb36,0xfb4b,0xfb4c,4,0xfb1d,
+0xfb1e,0xfb39,0xfb3a,4,0xfb3b,0xfb3c,0xfb4d,0xfb4e,4,0xfb44,0xfb45,0xfb4e,0xfb4f,4,0xfb2a,0xfb2e,
+0xfb49,0xfb4a,6,0xf73,0xf74,0xf75,0xf76,0xf81,0xf82,0x8006,2,0xfad2,0xfad3,2,0xf8e7,2,
+0xf8e8,0x8004,0,2,0xf92c,2,0xf92e,0x8006,2,0xfad4,0xfad5,2,0xf949,2,0xf94a,0x8006,
+2,0xfa30,0xfa31,2,0xf805,2,0xf806,0x8006,2,0xfa31,0xfa32,2,0xf80a,2,0xf80b,0x8006,
+2,0xfa32,0xfa33,2,0xf80e,2,0xf80f,0x8006,2,0xfa71,0xfa72,2,0xf81b,2,0xf81c,0x8006,
+2,0xfa00,0xfa01,2,0xf850,2,0xf851,0x8006,2,0xfa76,0xfa77,2,0xf825,2,0xf826,0x8006,
+2,0xfa33,0xfa34,2,0xf826,2,0xf827,0x8006,2,0xfa34,0xfa35,2,0xf827,2,0xf828,0x8006,
+2,0xfa77,0xfa78,2,0xf828,2,0xf829,0x8006,2,0xf963,0xf964,2,0xf82b,2,0xf82c,0x8006,
+2,0xfa35,0xfa36,2,0xf82d,2,0xf82e,0x8004,0,2,0xf831,2,0xf834,0x8004,0,2,
+0xf845,2,0xf847,0x8006,2,0xfa7a,0xfa7b,2,0xf847,2,0xf848,4,0xfa36,0xfa37,0xfa78,0xfa79,
+0x8006,2,0xfa37,0xfa38,2,0xf84c,2,0xf84d,4,0xfa10,0xfa11,0xfa7c,0xfa7d,0x8004,0,2,
+0xf86a,2,0xf86c,0x8008,4,0xf95f,0xf960,0xf9aa,0xf9ab,2,0xf86f,2,0xf870,0x8006,2,0xfa3c,
+0xfa3d,2,0xf878,2,0xf879,0x8006,2,0xf928,0xf929,2,0xf88e,2,0xf88f,0x8004,0,2,
+0xf894,2,0xf896,0x8006,2,0xfa3d,0xfa3e,2,0xf8a3,2,0xf8a4,0x8008,0,2,0xf8a7,2,
+0xf8a8,2,0xf8a9,2,0xf8aa,0x8006,2,0xfa87,0xfa88,2,0xf8a8,2,0xf8a9,0x8008,4,0xfa3f,
+0xfa40,0xfa89,0xfa8a,2,0xf8ab,2,0xf8ac,0x8008,4,0xfa40,0xfa41,0xfa8b,0xfa8c,2,0xf8b0,2,
+0xf8b1,0x8006,2,0xf90d,0xf90e,2,0xf8b1,2,0xf8b2,0x8006,2,0xfa41,0xfa42,2,0xf8c8,2,
+0xf8c9,4,0xfa12,0xfa13,0xfa91,0xfa92,0x8006,2,0xfa43,0xfa44,2,0xf8cf,2,0xf8d0,0x8008,4,
+0xf929,0xf92a,0xfa92,0xfa93,2,0xf8d8,2,0xf8d9,0x8006,2,0xfa93,0xfa94,2,0xf8d9,2,0xf8da,
+0x8006,2,0xfa44,0xfa45,2,0xf8e2,2,0xf8e3,6,0xf914,0xf915,0xf95c,0xf95d,0xf9bf,0xf9c0,0x8008,
+4,0xf970,0xf971,0xfa96,0xfa97,2,0xf8f5,2,0xf8f6,0x8008,4,0xf9ca,0xf9cb,0xfa97,0xfa98,2,
+0xf902,2,0xf903,0x8006,2,0xfa45,0xfa46,2,0xf901,2,0xf902,0x8006,2,0xfa99,0xfa9a,2,
+0xf90b,2,0xf90c,4,0xfa47,0xfa48,0xfa9a,0xfa9b,0x8006,2,0xfa9b,0xfa9c,2,0xf914,2,0xf915,
+4,0xfa48,0xfa49,0xfa9c,0xfa9d,0x8006,2,0xfa9e,0xfa9f,2,0xf921,2,0xf922,4,0xfa16,0xfa17,
+0xfaa0,0xfaa1,4,0xf961,0xf962,0xf9db,0xf9dc,0x8006,2,0xfaa1,0xfaa2,2,0xf930,2,0xf931,0x8006,
+2,0xf962,0xf963,2,0xf938,2,0xf939,4,0xfa17,0xfa18,0xfaa6,0xfaa7,0x8006,2,0xfaa8,0xfaa9,
+2,0xf940,2,0xf941,0x8004,0,2,0xf946,2,0xf948,0x8006,2,0xfaa9,0xfaaa,2,0xf948,
+2,0xf949,0x8006,2,0xf93b,0xf93c,2,0xf94f,2,0xf950,0x8006,2,0xfaab,0xfaac,2,0xf950,
+2,0xf951,0x8006,2,0xfa50,0xfa51,2,0xf953,2,0xf954,0x8006,2,0xfa1b,0xfa1c,2,0xf956,
+2,0xf957,0x8006,2,0xfa54,0xfa55,2,0xf959,2,0xf95a,4,0xfa56,0xfa57,0xfaad,0xfaae,6,
+0xf996,0xf997,0xfa57,0xfa58,0xfab0,0xfab1,0x8008,4,0xfa5b,0xfa5c,0xfab2,0xfab3,2,0xf97a,2,0xf97b,
+0x8008,0,2,0xf893,2,0xf894,2,0xf98b,2,0xf98c,2,0xfa5d,0xfa5f,0x8006,2,0xf974,
+0xf975,2,0xf998,2,0xf999,0x8006,2,0xfa5f,0xfa60,2,0xf99f,2,0xf9a0,0x8006,2,0xf936,
+0xf937,2,0xf9b4,2,0xf9b5,0x8006,2,0xfab5,0xfab6,2,0xf9bb,2,0xf9bc,4,0xfa61,0xfa62,
+0xfab8,0xfab9,4,0xf96f,0xf970,0xf9a1,0xf9a2,0x8006,2,0xfabe,0xfabf,2,0xf9d0,2,0xf9d1,4,
+0xfa22,0xfa23,0xfaba,0xfabb,4,0xf95d,0xf95e,0xfabd,0xfabe,4,0xfa62,0xfa63,0xfabc,0xfabd,4,0xfa63,
+0xfa64,0xfabf,0xfac0,0x8006,2,0xfac0,0xfac1,2,0xf9d1,2,0xf9d2,4,0xfa65,0xfa66,0xfac1,0xfac2,
+0x8006,2,0xfac2,0xfac3,2,0xf9df,2,0xf9e0,4,0xfa25,0xfa26,0xfa67,0xfa68,4,0xfa68,0xfa69,
+0xfac7,0xfac8,4,0xfa1c,0xfa1d,0xfac8,0xfac9,4,0xfa69,0xfa6a,0xfaca,0xfacb,0x8006,2,0xfacb,0xfacc,
+2,0xf9fe,2,0xfa00,4,0xfa6a,0xfa6b,0xfacc,0xfacd,0x8006,2,0xfacd,0xface,2,0xfa0a,2,
+0xfa0b,4,0xf907,0xf909,0xface,0xfacf,0x8004,0,1,0xd15f,1,0xd165,0x800c,0,1,0xd1bb,
+1,0xd1bc,1,0xd1bd,1,0xd1be,1,0xd1bf,1,0xd1c0,0x800c,0,1,0xd1bc,1,0xd1bd,
+1,0xd1be,1,0xd1bf,1,0xd1c0,1,0xd1c1,0x8004,0,2,0xf891,2,0xf893,0x8004,0,
+2,0xf95d,2,0xf95f
+};
+
 #endif  // INCLUDED_FROM_NORMALIZER2_CPP
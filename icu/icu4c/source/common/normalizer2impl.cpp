@@ -29,6 +29,7 @@
 #include "unicode/ucptrie.h"
 #include "unicode/udata.h"
 #include "unicode/umutablecptrie.h"
+#include "unicode/uset.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
 #include "unicode/utf8.h"
@@ -40,6 +41,7 @@
 #include "uassert.h"
 #include "ucptrie_impl.h"
 #include "uset_imp.h"
+#include "usimd.h"
 #include "uvector.h"
 
 U_NAMESPACE_BEGIN
@@ -62,6 +64,26 @@ inline uint8_t leadByteForCP(UChar32 c) {
     }
 }
 
+/**
+ * Skips whole blocks of code units below minimum, which the fast path loops
+ * would otherwise pass one at a time.
+ * Not worth the call for short text, nor when the first block
+ * cannot be skipped because its first or last unit is not below minimum.
+ */
+inline const UChar *skipBelow(const UChar *src, const UChar *limit, UChar minimum) {
+    if ((limit - src) >= 16 && src[0] < minimum && src[15] < minimum) {
+        src += simd::spanBelow(src, (int32_t)(limit - src), minimum);
+    }
+    return src;
+}
+
+inline const uint8_t *skipBelow(const uint8_t *src, const uint8_t *limit, uint8_t minimum) {
+    if ((limit - src) >= 16 && src[0] < minimum && src[15] < minimum) {
+        src += simd::spanBelow(src, (int32_t)(limit - src), minimum);
+    }
+    return src;
+}
+
 /**
  * Returns the code point from one single well-formed UTF-8 byte sequence
  * between cpStart and cpLimit.
@@ -428,7 +450,8 @@ Normalizer2Impl::~Normalizer2Impl() {
 
 void
 Normalizer2Impl::init(const int32_t *inIndexes, const UCPTrie *inTrie,
-                      const uint16_t *inExtraData, const uint8_t *inSmallFCD) {
+                      const uint16_t *inExtraData, const uint8_t *inSmallFCD,
+                      const UCPTrie *inCanonIterTrie, const uint16_t *inCanonStartSets) {
     minDecompNoCP = static_cast<UChar>(inIndexes[IX_MIN_DECOMP_NO_CP]);
     minCompNoMaybeCP = static_cast<UChar>(inIndexes[IX_MIN_COMP_NO_MAYBE_CP]);
     minLcccCP = static_cast<UChar>(inIndexes[IX_MIN_LCCC_CP]);
@@ -450,6 +473,13 @@ Normalizer2Impl::init(const int32_t *inIndexes, const UCPTrie *inTrie,
     extraData=maybeYesCompositions+((MIN_NORMAL_MAYBE_YES-minMaybeYes)>>OFFSET_SHIFT);
 
     smallFCD=inSmallFCD;
+
+    canonIterTrie=inCanonIterTrie;
+    if(inCanonIterTrie!=NULL) {
+        canonStartSets=inCanonStartSets;
+        canonStartSetsLength=
+            (inIndexes[IX_RESERVED5_OFFSET]-inIndexes[IX_CANON_START_SETS_OFFSET])/2;
+    }
 }
 
 U_CDECL_BEGIN
@@ -517,7 +547,7 @@ Normalizer2Impl::addCanonIterPropertyStarts(const USetAdder *sa, UErrorCode &err
     // Currently only used for the SEGMENT_STARTER property.
     UChar32 start = 0, end;
     uint32_t value;
-    while ((end = ucptrie_getRange(fCanonIterData->trie, start, UCPMAP_RANGE_NORMAL, 0,
+    while ((end = ucptrie_getRange(getCanonIterTrie(), start, UCPMAP_RANGE_NORMAL, 0,
                                    segmentStarterMapper, nullptr, &value)) >= 0) {
         sa->add(sa->set, start);
         start = end + 1;
@@ -605,7 +635,9 @@ Normalizer2Impl::decompose(const UChar *src, const UChar *limit,
 
     for(;;) {
         // count code units below the minimum or with irrelevant data for the quick check
-        for(prevSrc=src; src!=limit;) {
+        prevSrc=src;
+        src=skipBelow(src, limit, (UChar)minNoCP);
+        while(src!=limit) {
             if( (c=*src)<minNoCP ||
                 isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
             ) {
@@ -753,6 +785,7 @@ Normalizer2Impl::decomposeUTF8(uint32_t options,
         const uint8_t *prevSrc;
         uint16_t norm16 = 0;
 
+        src = skipBelow(src, limit, minNoLead);
         for (;;) {
             if (src == limit) {
                 if (prevBoundary != limit && sink != nullptr) {
@@ -1466,6 +1499,7 @@ Normalizer2Impl::compose(const UChar *src, const UChar *limit,
         const UChar *prevSrc;
         UChar32 c = 0;
         uint16_t norm16 = 0;
+        src = skipBelow(src, limit, (UChar)minNoMaybeCP);
         for (;;) {
             if (src == limit) {
                 if (prevBoundary != limit && doCompose) {
@@ -1730,6 +1764,7 @@ Normalizer2Impl::composeQuickCheck(const UChar *src, const UChar *limit,
         const UChar *prevSrc;
         UChar32 c = 0;
         uint16_t norm16 = 0;
+        src = skipBelow(src, limit, (UChar)minNoMaybeCP);
         for (;;) {
             if(src==limit) {
                 return src;
@@ -1877,6 +1912,7 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
         // or with (compYes && ccc==0) properties.
         const uint8_t *prevSrc;
         uint16_t norm16 = 0;
+        src = skipBelow(src, limit, minNoMaybeLead);
         for (;;) {
             if (src == limit) {
                 if (prevBoundary != limit && sink != nullptr) {
@@ -2306,7 +2342,12 @@ Normalizer2Impl::makeFCD(const UChar *src, const UChar *limit,
 
     for(;;) {
         // count code units with lccc==0
-        for(prevSrc=src; src!=limit;) {
+        prevSrc=src;
+        src=skipBelow(src, limit, (UChar)minLcccCP);
+        if(src!=prevSrc) {
+            prevFCD16=~*(src-1);
+        }
+        while(src!=limit) {
             if((c=*src)<minLcccCP) {
                 prevFCD16=~c;
                 ++src;
@@ -2644,18 +2685,39 @@ void Normalizer2Impl::makeCanonIterDataFromNorm16(UChar32 start, UChar32 end, co
 }
 
 UBool Normalizer2Impl::ensureCanonIterData(UErrorCode &errorCode) const {
+    if(canonIterTrie!=NULL) {
+        // Precomputed by gennorm2.
+        return U_SUCCESS(errorCode);
+    }
     // Logically const: Synchronized instantiation.
     Normalizer2Impl *me=const_cast<Normalizer2Impl *>(this);
     umtx_initOnce(me->fCanonIterDataInitOnce, &initCanonIterData, me, errorCode);
     return U_SUCCESS(errorCode);
 }
 
+const UCPTrie *Normalizer2Impl::getCanonIterTrie() const {
+    return canonIterTrie!=NULL ? canonIterTrie : fCanonIterData->trie;
+}
+
 int32_t Normalizer2Impl::getCanonValue(UChar32 c) const {
-    return (int32_t)ucptrie_get(fCanonIterData->trie, c);
+    return (int32_t)ucptrie_get(getCanonIterTrie(), c);
 }
 
-const UnicodeSet &Normalizer2Impl::getCanonStartSet(int32_t n) const {
-    return *(const UnicodeSet *)fCanonIterData->canonStartSets[n];
+void Normalizer2Impl::addCanonStartSet(int32_t n, UnicodeSet &set) const {
+    if(canonIterTrie==NULL) {
+        set.addAll(*(const UnicodeSet *)fCanonIterData->canonStartSets[n]);
+        return;
+    }
+    // In the precomputed data, n is the offset of a serialized set.
+    USerializedSet startSet;
+    if(uset_getSerializedSet(&startSet, canonStartSets+n, canonStartSetsLength-n)) {
+        int32_t count=uset_getSerializedRangeCount(&startSet);
+        for(int32_t i=0; i<count; ++i) {
+            UChar32 start, end;
+            uset_getSerializedRange(&startSet, i, &start, &end);
+            set.add(start, end);
+        }
+    }
 }
 
 UBool Normalizer2Impl::isCanonSegmentStarter(UChar32 c) const {
@@ -2670,7 +2732,7 @@ UBool Normalizer2Impl::getCanonStartSet(UChar32 c, UnicodeSet &set) const {
     set.clear();
     int32_t value=canonValue&CANON_VALUE_MASK;
     if((canonValue&CANON_HAS_SET)!=0) {
-        set.addAll(getCanonStartSet(value));
+        addCanonStartSet(value, set);
     } else if(value!=0) {
         set.add(value);
     }
@@ -2794,7 +2856,19 @@ unorm2_swap(const UDataSwapper *ds,
         offset=nextOffset;
 
         /* no need to swap the uint8_t smallFCD[] (new in formatVersion 2) */
-        nextOffset=indexes[Normalizer2Impl::IX_SMALL_FCD_OFFSET+1];
+        nextOffset=indexes[Normalizer2Impl::IX_CANON_ITER_TRIE_OFFSET];
+        offset=nextOffset;
+
+        /* swap the optional canonical iterator trie (new in formatVersion 4.1) */
+        nextOffset=indexes[Normalizer2Impl::IX_CANON_START_SETS_OFFSET];
+        if(offset<nextOffset) {
+            utrie_swapAnyVersion(ds, inBytes+offset, nextOffset-offset, outBytes+offset, pErrorCode);
+        }
+        offset=nextOffset;
+
+        /* swap the uint16_t canonStartSets[] */
+        nextOffset=indexes[Normalizer2Impl::IX_RESERVED5_OFFSET];
+        ds->swapArray16(ds, inBytes+offset, nextOffset-offset, outBytes+offset, pErrorCode);
         offset=nextOffset;
 
         U_ASSERT(offset==size);
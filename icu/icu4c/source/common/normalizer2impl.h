@@ -245,11 +245,18 @@ class U_COMMON_API ReorderingBuffer : public UMemory {
  */
 class U_COMMON_API Normalizer2Impl : public UObject {
 public:
-    Normalizer2Impl() : normTrie(NULL), fCanonIterData(NULL) { }
+    Normalizer2Impl() : normTrie(NULL), canonIterTrie(NULL), canonStartSets(NULL),
+                        canonStartSetsLength(0), fCanonIterData(NULL) { }
     virtual ~Normalizer2Impl();
 
+    /**
+     * inCanonIterTrie and inCanonStartSets are the optional precomputed
+     * CanonicalIterator data. If inCanonIterTrie is NULL, then that data
+     * is built at runtime from the normalization trie when it is first needed.
+     */
     void init(const int32_t *inIndexes, const UCPTrie *inTrie,
-              const uint16_t *inExtraData, const uint8_t *inSmallFCD);
+              const uint16_t *inExtraData, const uint8_t *inSmallFCD,
+              const UCPTrie *inCanonIterTrie, const uint16_t *inCanonStartSets);
 
     void addLcccChars(UnicodeSet &set) const;
     void addPropertyStarts(const USetAdder *sa, UErrorCode &errorCode) const;
@@ -420,8 +427,8 @@ class U_COMMON_API Normalizer2Impl : public UObject {
         IX_NORM_TRIE_OFFSET,
         IX_EXTRA_DATA_OFFSET,
         IX_SMALL_FCD_OFFSET,
-        IX_RESERVED3_OFFSET,
-        IX_RESERVED4_OFFSET,
+        IX_CANON_ITER_TRIE_OFFSET,
+        IX_CANON_START_SETS_OFFSET,
         IX_RESERVED5_OFFSET,
         IX_RESERVED6_OFFSET,
         IX_TOTAL_SIZE,
@@ -704,8 +711,9 @@ class U_COMMON_API Normalizer2Impl : public UObject {
     void makeCanonIterDataFromNorm16(UChar32 start, UChar32 end, const uint16_t norm16,
                                      CanonIterData &newData, UErrorCode &errorCode) const;
 
+    const UCPTrie *getCanonIterTrie() const;
     int32_t getCanonValue(UChar32 c) const;
-    const UnicodeSet &getCanonStartSet(int32_t n) const;
+    void addCanonStartSet(int32_t n, UnicodeSet &set) const;
 
     // UVersionInfo dataVersion;
 
@@ -730,6 +738,11 @@ class U_COMMON_API Normalizer2Impl : public UObject {
     const uint16_t *extraData;  // mappings and/or compositions for yesYes, yesNo & noNo characters
     const uint8_t *smallFCD;  // [0x100] one bit per 32 BMP code points, set if any FCD!=0
 
+    // Precomputed CanonicalIterator data, or NULL if it is built at runtime.
+    const UCPTrie *canonIterTrie;
+    const uint16_t *canonStartSets;  // serialized UnicodeSets
+    int32_t canonStartSetsLength;
+
     UInitOnce       fCanonIterDataInitOnce {};
     CanonIterData  *fCanonIterData;
 };
@@ -785,7 +798,7 @@ unorm_getFCD16(UChar32 c);
 
 /**
  * Format of Normalizer2 .nrm data files.
- * Format version 4.0.
+ * Format version 4.1.
  *
  * Normalizer2 .nrm data files provide data for the Unicode Normalization algorithms.
  * ICU ships with data files for standard Unicode Normalization Forms
@@ -909,6 +922,23 @@ unorm_getFCD16(UChar32 c);
  *
  *      This bit set is most useful for the large blocks of CJK characters with FCD=0.
  *
+ * UCPTrie canonIterTrie; -- new in format version 4.1, optional
+ *
+ *      Precomputed data for the CanonicalIterator and the Segment_Starter property.
+ *      gennorm2 writes it only when requested (--canoniter). If this part is empty,
+ *      then Normalizer2Impl builds the same data at runtime when it is first needed.
+ *      The part starts at a 4-aligned offset; the smallFCD part is padded as necessary.
+ *
+ *      The trie maps each code point to a 32-bit value with the CANON_... bits
+ *      defined in normalizer2impl.h. Unlike in the runtime-built data,
+ *      the CANON_VALUE_MASK bits of a value with CANON_HAS_SET are the
+ *      offset of the code point's start set in the canonStartSets array.
+ *
+ * uint16_t canonStartSets[]; -- new in format version 4.1, optional
+ *
+ *      Serialized UnicodeSets (see uset_serialize() and USerializedSet),
+ *      one after another, in code point order of the characters they belong to.
+ *
  * Changes from format version 1 to format version 2 ---------------------------
  *
  * - Addition of data for raw (not recursively decomposed) mappings.
@@ -981,6 +1011,13 @@ unorm_getFCD16(UChar32 c);
  * gennorm2 now has to reject mappings for surrogate code points.
  * UTS #46 maps unpaired surrogates to U+FFFD in code rather than via its
  * custom normalization data file.
+ *
+ * Changes from format version 4.0 to format version 4.1 (ICU 73) --------------
+ *
+ * Optional canonIterTrie and canonStartSets parts with precomputed data
+ * for the CanonicalIterator, so that it need not be built at runtime.
+ * The byte offsets for the former reserved parts 3 and 4 mark their starts.
+ * Older code ignores these parts.
  */
 
 #endif  /* !UCONFIG_NO_NORMALIZATION */
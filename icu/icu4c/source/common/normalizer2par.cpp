@@ -0,0 +1,290 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*
+*   file name:  normalizer2par.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Normalizer2::normalizeParallel() and normalizeUTF8Parallel():
+*   Normalize long strings in pieces on several threads.
+*   In a separate file so that the rest of the normalization code
+*   does not start threads.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include <thread>
+
+#include "unicode/bytestream.h"
+#include "unicode/edits.h"
+#include "unicode/normalizer2.h"
+#include "unicode/stringoptions.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "putilimp.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Pieces shorter than this are not worth a thread.
+constexpr int32_t MIN_PIECE_LENGTH = 0x10000;
+constexpr int32_t MAX_THREAD_COUNT = 64;
+
+/**
+ * @return the index of the first code point at or after start
+ *         for which norm2.hasBoundaryBefore() is true,
+ *         or -1 if there is none
+ */
+int32_t findBoundary(const Normalizer2 &norm2, const UChar *s, int32_t start, int32_t length) {
+    int32_t i = start;
+    if (0 < i && i < length && U16_IS_TRAIL(s[i]) && U16_IS_LEAD(s[i - 1])) {
+        ++i;
+    }
+    while (i < length) {
+        int32_t cpStart = i;
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if (norm2.hasBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+// Only splits before well-formed sequences,
+// so that an ill-formed one is not cut into two.
+int32_t findBoundary(const Normalizer2 &norm2, const uint8_t *s, int32_t start, int32_t length) {
+    int32_t i = start;
+    while (i < length && U8_IS_TRAIL(s[i])) {
+        ++i;
+    }
+    while (i < length) {
+        int32_t cpStart = i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c >= 0 && norm2.hasBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Splits the source into pieces of roughly equal length at normalization boundaries.
+ * @return the number of pieces; pieceStarts[0..count] are set,
+ *         with pieceStarts[count] == length
+ */
+template<typename CharType>
+int32_t splitAtBoundaries(const Normalizer2 &norm2, const CharType *s, int32_t length,
+                          int32_t threadCount, int32_t pieceStarts[]) {
+    int32_t pieceCount = 1;
+    pieceStarts[0] = 0;
+    if (threadCount > 1 && length >= 2 * MIN_PIECE_LENGTH) {
+        int32_t maxCount = uprv_min(threadCount, MAX_THREAD_COUNT);
+        maxCount = uprv_min(maxCount, length / MIN_PIECE_LENGTH);
+        for (int32_t i = 1; i < maxCount; ++i) {
+            int32_t start = (int32_t)(((int64_t)length * i) / maxCount);
+            start = findBoundary(norm2, s, uprv_max(start, pieceStarts[pieceCount - 1] + 1), length);
+            if (start < 0) {
+                break;
+            }
+            pieceStarts[pieceCount++] = start;
+        }
+    }
+    pieceStarts[pieceCount] = length;
+    return pieceCount;
+}
+
+/** Normalizes one piece of a UTF-16 source into its own output string. */
+struct NormalizePiece16 : public UMemory {
+    void normalize() {
+        norm2->normalize(src, dest, errorCode);
+    }
+
+    const Normalizer2 *norm2 = nullptr;
+    UnicodeString src;
+    UnicodeString dest;
+    UErrorCode errorCode = U_ZERO_ERROR;
+};
+
+/** Normalizes one piece of a UTF-8 source into its own output and edits. */
+struct NormalizePiece8 : public UMemory {
+    void normalize() {
+        CharStringByteSink sink(&dest);
+        norm2->normalizeUTF8(options, src, sink, withEdits ? &edits : nullptr, errorCode);
+    }
+
+    const Normalizer2 *norm2 = nullptr;
+    uint32_t options = 0;
+    StringPiece src;
+    CharString dest;
+    Edits edits;
+    UBool withEdits = false;
+    UErrorCode errorCode = U_ZERO_ERROR;
+};
+
+/**
+ * Starts a thread that normalizes the piece.
+ * @return false if the thread could not be created
+ */
+template<typename Piece>
+bool startThread(std::thread &thread, Piece &piece) {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    // ICU APIs do not throw: Report the failure instead of
+    // the std::system_error. Without exceptions, it is fatal.
+    try {
+        thread = std::thread(&Piece::normalize, &piece);
+    } catch (...) {
+        return false;
+    }
+#else
+    thread = std::thread(&Piece::normalize, &piece);
+#endif
+    return true;
+}
+
+template<typename Piece>
+void normalizePieces(Piece pieces[], int32_t pieceCount) {
+    // The calling thread normalizes the first piece,
+    // and the remaining ones if it runs out of threads.
+    std::thread threads[MAX_THREAD_COUNT];
+    int32_t threadLimit = 1;
+    while (threadLimit < pieceCount && startThread(threads[threadLimit], pieces[threadLimit])) {
+        ++threadLimit;
+    }
+    pieces[0].normalize();
+    for (int32_t i = threadLimit; i < pieceCount; ++i) {
+        pieces[i].normalize();
+    }
+    for (int32_t i = 1; i < threadLimit; ++i) {
+        threads[i].join();
+    }
+}
+
+/** Appends the changes in from, one at a time, so that they merge like in a single run. */
+void appendEdits(const Edits &from, Edits &to) {
+    Edits::Iterator iter = from.getFineIterator();
+    UErrorCode errorCode = U_ZERO_ERROR;
+    while (iter.next(errorCode)) {
+        if (iter.hasChange()) {
+            to.addReplace(iter.oldLength(), iter.newLength());
+        } else {
+            to.addUnchanged(iter.oldLength());
+        }
+    }
+}
+
+}  // namespace
+
+UnicodeString &
+Normalizer2::normalizeParallel(const UnicodeString &src, UnicodeString &dest,
+                               int32_t threadCount, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        dest.setToBogus();
+        return dest;
+    }
+    if (threadCount < 1 || &dest == &src) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        dest.setToBogus();
+        return dest;
+    }
+    const UChar *s = src.getBuffer();
+    int32_t pieceStarts[MAX_THREAD_COUNT + 1];
+    int32_t pieceCount = splitAtBoundaries(*this, s, src.length(), threadCount, pieceStarts);
+    if (pieceCount == 1) {
+        return normalize(src, dest, errorCode);
+    }
+
+    LocalArray<NormalizePiece16> pieces(new NormalizePiece16[pieceCount], errorCode);
+    if (U_FAILURE(errorCode)) {
+        dest.setToBogus();
+        return dest;
+    }
+    for (int32_t i = 0; i < pieceCount; ++i) {
+        NormalizePiece16 &piece = pieces[i];
+        piece.norm2 = this;
+        piece.src.setTo(false, s + pieceStarts[i], pieceStarts[i + 1] - pieceStarts[i]);
+    }
+    normalizePieces(pieces.getAlias(), pieceCount);
+
+    dest.remove();
+    for (int32_t i = 0; i < pieceCount; ++i) {
+        const NormalizePiece16 &piece = pieces[i];
+        if (U_FAILURE(piece.errorCode)) {
+            errorCode = piece.errorCode;
+            dest.setToBogus();
+            return dest;
+        }
+        dest.append(piece.dest);
+    }
+    if (dest.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return dest;
+}
+
+void
+Normalizer2::normalizeUTF8Parallel(uint32_t options, StringPiece src, ByteSink &sink,
+                                   Edits *edits, int32_t threadCount, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (threadCount < 1) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(src.data());
+    int32_t pieceStarts[MAX_THREAD_COUNT + 1];
+    int32_t pieceCount = splitAtBoundaries(*this, s, src.length(), threadCount, pieceStarts);
+    if (pieceCount == 1) {
+        normalizeUTF8(options, src, sink, edits, errorCode);
+        return;
+    }
+
+    LocalArray<NormalizePiece8> pieces(new NormalizePiece8[pieceCount], errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    for (int32_t i = 0; i < pieceCount; ++i) {
+        NormalizePiece8 &piece = pieces[i];
+        piece.norm2 = this;
+        piece.options = options;
+        piece.src = src.substr(pieceStarts[i], pieceStarts[i + 1] - pieceStarts[i]);
+        piece.withEdits = edits != nullptr;
+    }
+    normalizePieces(pieces.getAlias(), pieceCount);
+
+    if (edits != nullptr && (options & U_EDITS_NO_RESET) == 0) {
+        edits->reset();
+    }
+    for (int32_t i = 0; i < pieceCount; ++i) {
+        const NormalizePiece8 &piece = pieces[i];
+        if (U_FAILURE(piece.errorCode)) {
+            errorCode = piece.errorCode;
+            return;
+        }
+        sink.Append(piece.dest.data(), piece.dest.length());
+        if (edits != nullptr) {
+            appendEdits(piece.edits, *edits);
+        }
+    }
+    if (edits != nullptr && edits->copyErrorTo(errorCode)) {
+        return;
+    }
+    sink.Flush();
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
@@ -0,0 +1,262 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*
+*   file name:  normalizer2stream.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   StreamingNormalizer2: Normalizes text that arrives in chunks,
+*   holding back only the text after the last normalization boundary.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/bytestream.h"
+#include "unicode/edits.h"
+#include "unicode/normalizer2.h"
+#include "unicode/stringoptions.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "cmemory.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/**
+ * @return the index of the first complete code point in s
+ *         for which norm2.hasBoundaryBefore() is true,
+ *         or -1 if there is none;
+ *         skips a trail surrogate at index 0 if the previous text ends with a lead surrogate
+ */
+int32_t findFirstBoundary(const Normalizer2 &norm2, const UChar *s, int32_t length,
+                          UBool afterLead) {
+    int32_t i = 0;
+    if (afterLead && length > 0 && U16_IS_TRAIL(s[0])) {
+        i = 1;
+    }
+    while (i < length) {
+        int32_t cpStart = i;
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if (i == length && U16_IS_LEAD(c)) {
+            // The next chunk may continue this code point.
+            break;
+        }
+        if (norm2.hasBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @return the index of the last complete code point in s[start, length[
+ *         for which norm2.hasBoundaryBefore() is true, or start if there is none
+ */
+int32_t findLastBoundary(const Normalizer2 &norm2, const UChar *s, int32_t start, int32_t length) {
+    int32_t i = length;
+    if (i > start && U16_IS_LEAD(s[i - 1])) {
+        // The next chunk may continue this code point.
+        --i;
+    }
+    while (i > start) {
+        UChar32 c;
+        U16_PREV(s, start, i, c);
+        if (norm2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return start;
+}
+
+// In UTF-8, only well-formed sequences are candidates.
+// A sequence cut off at the end of a chunk is ill-formed until the next chunk arrives.
+// Leading trail bytes may continue the previous text.
+
+int32_t findFirstBoundary(const Normalizer2 &norm2, const uint8_t *s, int32_t length) {
+    int32_t i = 0;
+    while (i < length && U8_IS_TRAIL(s[i])) {
+        ++i;
+    }
+    while (i < length) {
+        int32_t cpStart = i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c >= 0 && norm2.hasBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+int32_t findLastBoundary(const Normalizer2 &norm2, const uint8_t *s, int32_t start, int32_t length) {
+    int32_t i = length;
+    while (i > start) {
+        UChar32 c;
+        U8_PREV(s, start, i, c);
+        if (c >= 0 && norm2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return start;
+}
+
+}  // namespace
+
+StreamingNormalizer2::StreamingNormalizer2(const Normalizer2 &n2) :
+        norm2(n2), pending8(nullptr), pending8Length(0), pending8Capacity(0) {}
+
+StreamingNormalizer2::~StreamingNormalizer2() {
+    uprv_free(pending8);
+}
+
+void
+StreamingNormalizer2::reset() {
+    pending.remove();
+    pending8Length = 0;
+}
+
+UnicodeString &
+StreamingNormalizer2::normalizeChunk(const UnicodeString &chunk, UnicodeString &dest,
+                                     UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return dest;
+    }
+    if (&chunk == &dest || chunk.isBogus() || pending8Length != 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return dest;
+    }
+    const UChar *s = chunk.getBuffer();
+    int32_t length = chunk.length();
+    UBool afterLead = !pending.isEmpty() && U16_IS_LEAD(pending[pending.length() - 1]);
+    int32_t first = findFirstBoundary(norm2, s, length, afterLead);
+    if (first < 0) {
+        pending.append(s, 0, length);
+        if (pending.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return dest;
+    }
+    // The held-back text interacts at most with the chunk text before its first boundary.
+    if (!pending.isEmpty() || first > 0) {
+        pending.append(s, 0, first);
+        norm2.normalize(pending, normalized, errorCode);
+        dest.append(normalized);
+    }
+    int32_t last = findLastBoundary(norm2, s, first, length);
+    if (first < last) {
+        norm2.normalize(UnicodeString(false, s + first, last - first), normalized, errorCode);
+        dest.append(normalized);
+    }
+    pending.setTo(s + last, length - last);
+    if (U_SUCCESS(errorCode) && (pending.isBogus() || dest.isBogus())) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return dest;
+}
+
+UnicodeString &
+StreamingNormalizer2::finish(UnicodeString &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return dest;
+    }
+    if (pending8Length != 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return dest;
+    }
+    norm2.normalize(pending, normalized, errorCode);
+    dest.append(normalized);
+    if (U_SUCCESS(errorCode) && dest.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    reset();
+    return dest;
+}
+
+UBool
+StreamingNormalizer2::appendPending8(const char *s, int32_t length, UErrorCode &errorCode) {
+    if (length > pending8Capacity - pending8Length) {
+        if (length > INT32_MAX - pending8Length) {
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return false;
+        }
+        int32_t capacity = pending8Length + length;
+        if (capacity <= INT32_MAX / 2) {
+            capacity *= 2;
+        }
+        char *buffer = static_cast<char *>(uprv_realloc(pending8, capacity));
+        if (buffer == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return false;
+        }
+        pending8 = buffer;
+        pending8Capacity = capacity;
+    }
+    if (length > 0) {
+        uprv_memcpy(pending8 + pending8Length, s, length);
+        pending8Length += length;
+    }
+    return true;
+}
+
+void
+StreamingNormalizer2::normalizeUTF8Chunk(uint32_t options, StringPiece chunk, ByteSink &sink,
+                                         Edits *edits, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    options |= U_EDITS_NO_RESET;
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(chunk.data());
+    int32_t length = chunk.length();
+    int32_t first = findFirstBoundary(norm2, s, length);
+    if (first < 0) {
+        // No boundary: Hold back the whole chunk.
+        appendPending8(chunk.data(), length, errorCode);
+    } else {
+        // The held-back text interacts at most with the chunk text before its first boundary.
+        if ((pending8Length != 0 || first > 0) && appendPending8(chunk.data(), first, errorCode)) {
+            norm2.normalizeUTF8(options, StringPiece(pending8, pending8Length), sink, edits, errorCode);
+            pending8Length = 0;
+        }
+        int32_t last = findLastBoundary(norm2, s, first, length);
+        if (first < last) {
+            norm2.normalizeUTF8(options, chunk.substr(first, last - first), sink, edits, errorCode);
+        }
+        if (U_SUCCESS(errorCode)) {
+            appendPending8(chunk.data() + last, length - last, errorCode);
+        }
+    }
+    sink.Flush();
+}
+
+void
+StreamingNormalizer2::finishUTF8(uint32_t options, ByteSink &sink, Edits *edits,
+                                 UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    // Also for empty text, so that errors are reported as for the whole text.
+    norm2.normalizeUTF8(options | U_EDITS_NO_RESET, StringPiece(pending8, pending8Length),
+                        sink, edits, errorCode);
+    reset();
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
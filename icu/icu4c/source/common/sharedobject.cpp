@@ -59,4 +59,9 @@ SharedObject::deleteIfZeroRefCount() const {
     }
 }
 
+int32_t
+SharedObject::getMemoryUsage() const {
+    return (int32_t)sizeof(SharedObject);
+}
+
 U_NAMESPACE_END
@@ -108,6 +108,17 @@ class U_COMMON_API SharedObject : public UObject {
      */
     void deleteIfZeroRefCount() const;
 
+    /**
+     * Returns the approximate number of bytes of memory used by this object,
+     * including heap memory that it owns. The UnifiedCache uses this to
+     * enforce its memory limit.
+     * This default implementation returns the size of a SharedObject.
+     * Subclasses that own significant amounts of memory should override it.
+     * A rough estimate is enough.
+     * The returned value must not change while the object is in the cache.
+     */
+    virtual int32_t getMemoryUsage() const;
+
         
     /**
      * Returns a writable version of ptr.
@@ -165,9 +176,9 @@ class U_COMMON_API SharedObject : public UObject {
      * The number of references from the UnifiedCache, which is
      * the number of times that the sharedObject is stored as a hash table value.
      * For use by UnifiedCache implementation code only.
-     * All access is synchronized by UnifiedCache's gCacheMutex
+     * Atomic because keys in different cache shards may refer to the same value.
      */
-    mutable int32_t softRefCount;
+    mutable u_atomic_int32_t softRefCount;
     friend class UnifiedCache;
 
     /**
@@ -211,6 +211,21 @@ pointerTOCPrefixBinarySearch(const char *s, const PointerTOCEntry *toc, int32_t
     return -1;
 }
 
+static int32_t
+offsetTOCHashSearch(const char *s, const char *names,
+                    const UDataOffsetTOC *toc) {
+    const UDataOffsetTOCHash *hash=(const UDataOffsetTOCHash *)(toc->entry+toc->count);
+    uint32_t bucketCount=hash->bucketCount;
+    uint64_t h=udata_hashTOCEntryName(s);
+    uint32_t seed=hash->values[udata_mixTOCHash(h, 0)%bucketCount];
+    uint32_t number=hash->values[bucketCount+udata_mixTOCHash(h, seed)%hash->slotCount];
+    /* The slot of a name that is not in the TOC may hold any entry, or none. */
+    if(number<toc->count && 0==uprv_strcmp(s, names+toc->entry[number].nameOffset)) {
+        return (int32_t)number;
+    }
+    return -1;
+}
+
 U_CDECL_BEGIN
 static uint32_t U_CALLCONV
 offsetTOCEntryCount(const UDataMemory *pData) {
@@ -269,6 +284,55 @@ offsetTOCLookupFn(const UDataMemory *pData,
 }
 
 
+static const DataHeader * U_CALLCONV
+offsetTOCHashLookupFn(const UDataMemory *pData,
+                      const char *tocEntryName,
+                      int32_t *pLength,
+                      UErrorCode *pErrorCode) {
+    (void)pErrorCode;
+    /* only used when udata_checkCommonData() found a usable hash table */
+    const UDataOffsetTOC  *toc = (UDataOffsetTOC *)pData->toc;
+    const char *base=(const char *)toc;
+    int32_t number=offsetTOCHashSearch(tocEntryName, base, toc);
+    if(number>=0) {
+        /* found it */
+        const UDataOffsetTOCEntry *entry=toc->entry+number;
+#ifdef UDATA_DEBUG
+        fprintf(stderr, "%s: Found.\n", tocEntryName);
+#endif
+        if((uint32_t)(number+1) < toc->count) {
+            *pLength = (int32_t)(entry[1].dataOffset - entry->dataOffset);
+        } else {
+            *pLength = -1;
+        }
+        return (const DataHeader *)(base+entry->dataOffset);
+    } else {
+#ifdef UDATA_DEBUG
+        fprintf(stderr, "%s: Not found.\n", tocEntryName);
+#endif
+        return NULL;
+    }
+}
+
+
+static const DataHeader * U_CALLCONV
+offsetTOCGetEntryFn(const UDataMemory *pData,
+                    int32_t index,
+                    const char **pName,
+                    int32_t *pLength) {
+    const UDataOffsetTOC  *toc = (UDataOffsetTOC *)pData->toc;
+    const char *base=(const char *)toc;
+    const UDataOffsetTOCEntry *entry=toc->entry+index;
+    *pName=base+entry->nameOffset;
+    if((uint32_t)(index+1) < toc->count) {
+        *pLength = (int32_t)(entry[1].dataOffset - entry->dataOffset);
+    } else {
+        *pLength = -1;
+    }
+    return (const DataHeader *)(base+entry->dataOffset);
+}
+
+
 static uint32_t U_CALLCONV pointerTOCEntryCount(const UDataMemory *pData) {
     const PointerTOC *toc = (PointerTOC *)pData->toc;
     return (uint32_t)((toc != NULL) ? (toc->count) : 0);
@@ -307,11 +371,22 @@ static const DataHeader * U_CALLCONV pointerTOCLookupFn(const UDataMemory *pData
         return pData->pHeader;
     }
 }
+
+static const DataHeader * U_CALLCONV pointerTOCGetEntryFn(const UDataMemory *pData,
+                   int32_t index,
+                   const char **pName,
+                   int32_t *pLength) {
+    const PointerTOC *toc = (PointerTOC *)pData->toc;
+    *pName=toc->entry[index].entryName;
+    *pLength=-1;
+    return UDataMemory_normalizeDataPointer(toc->entry[index].pHeader);
+}
 U_CDECL_END
 
 
-static const commonDataFuncs CmnDFuncs = {offsetTOCLookupFn,  offsetTOCEntryCount};
-static const commonDataFuncs ToCPFuncs = {pointerTOCLookupFn, pointerTOCEntryCount};
+static const commonDataFuncs CmnDFuncs = {offsetTOCLookupFn,  offsetTOCEntryCount,  offsetTOCGetEntryFn};
+static const commonDataFuncs CmnDHashFuncs = {offsetTOCHashLookupFn, offsetTOCEntryCount, offsetTOCGetEntryFn};
+static const commonDataFuncs ToCPFuncs = {pointerTOCLookupFn, pointerTOCEntryCount, pointerTOCGetEntryFn};
 
 
 
@@ -347,6 +422,15 @@ U_CFUNC void udata_checkCommonData(UDataMemory *udm, UErrorCode *err) {
         /* dataFormat="CmnD" */
         udm->vFuncs = &CmnDFuncs;
         udm->toc=(const char *)udm->pHeader+udata_getHeaderSize(udm->pHeader);
+        if(udm->pHeader->info.formatVersion[1]>=1) {
+            /* formatVersion 1.1 adds a hash table after the TOC entries */
+            const UDataOffsetTOC *toc=(const UDataOffsetTOC *)udm->toc;
+            const UDataOffsetTOCHash *hash=(const UDataOffsetTOCHash *)(toc->entry+toc->count);
+            if(hash->bucketCount>0 && hash->slotCount>0 && hash->slotCount>=toc->count &&
+                    hash->length==12+4*(hash->bucketCount+hash->slotCount)) {
+                udm->vFuncs = &CmnDHashFuncs;
+            }
+        }
     }
     else if(udm->pHeader->info.dataFormat[0]==0x54 &&
         udm->pHeader->info.dataFormat[1]==0x6f &&
@@ -63,6 +63,64 @@ typedef struct {
     UDataOffsetTOCEntry entry[1];
 } UDataOffsetTOC;
 
+/**
+ * Hash table for the offset TOC, in .dat packages with format version 1.1 and up.
+ * It immediately follows the UDataOffsetTOC entries, before the item names.
+ *
+ * It is a "hash and displace" perfect hash table:
+ * An item name is hashed with seed 0 to select a bucket, and then
+ * with the bucket's seed to select a slot, which holds the index of
+ * the TOC entry for that name, or UDATA_TOC_HASH_NO_ENTRY.
+ * Names that are not in the package also map to some slot,
+ * so the name of the found entry must be compared with the requested one.
+ *
+ * A bucketCount of 0 means that there is no usable hash table;
+ * lookups then fall back to binary search.
+ */
+typedef struct {
+    uint32_t length;        /* length of this structure in bytes, including the arrays */
+    uint32_t bucketCount;
+    uint32_t slotCount;
+    /**
+     * Variable-length array declared with length 1 to disable bounds checkers.
+     * It contains bucketCount seeds, followed by slotCount TOC entry indexes.
+     */
+    uint32_t values[1];
+} UDataOffsetTOCHash;
+
+#define UDATA_TOC_HASH_NO_ENTRY 0xffffffff
+
+#ifdef __cplusplus
+
+/**
+ * Hash function for UDataOffsetTOCHash: 64-bit FNV-1a.
+ * Hashes the bytes of the name, so the hash values depend on the charset family.
+ */
+inline uint64_t udata_hashTOCEntryName(const char *name) {
+    uint64_t h=UINT64_C(0xcbf29ce484222325);
+    uint8_t c;
+    while((c=(uint8_t)*name++)!=0) {
+        h=(h^c)*UINT64_C(0x100000001b3);
+    }
+    return h;
+}
+
+/**
+ * Derives the bucket value (with seed 0) or the slot value (with the bucket's seed)
+ * from a udata_hashTOCEntryName() value. The caller reduces it modulo the count.
+ */
+inline uint32_t udata_mixTOCHash(uint64_t hash, uint32_t seed) {
+    hash^=seed*UINT64_C(0x9e3779b97f4a7c15);
+    hash^=hash>>33;
+    hash*=UINT64_C(0xff51afd7ed558ccd);
+    hash^=hash>>33;
+    hash*=UINT64_C(0xc4ceb9fe1a85ec53);
+    hash^=hash>>33;
+    return (uint32_t)hash;
+}
+
+#endif  /* __cplusplus */
+
 /**
  * Get the header size from a const DataHeader *udh.
  * Handles opposite-endian data.
@@ -98,11 +156,23 @@ typedef const DataHeader *
 typedef uint32_t
 (U_CALLCONV * NumEntriesFn)(const UDataMemory *pData);
 
+/*
+ *  Returns the data of the TOC entry with the given index,
+ *  and sets *pName to its name and *pLength to its length, or to -1
+ *  if the length is not known.
+ */
+typedef const DataHeader *
+(U_CALLCONV * GetEntryFn)(const UDataMemory *pData,
+                          int32_t index,
+                          const char **pName,
+                          int32_t *pLength);
+
 U_CDECL_END
 
 typedef struct {
     LookupFn      Lookup;
     NumEntriesFn  NumEntries; 
+    GetEntryFn    GetEntry;
 } commonDataFuncs;
 
 
@@ -1834,6 +1834,172 @@ ucnv_toUChars(UConverter *cnv,
     return u_terminateUChars(originalDest, destCapacity, destLength, pErrorCode);
 }
 
+/* ucnv_to/fromUCharsBatch() ------------------------------------------------ */
+
+/*
+ * The batch functions reset the converter and call the internal
+ * _to/fromUnicodeWithCallback() directly for each string, skipping the
+ * per-call argument checks, overflow buffer handling and NUL termination
+ * of ucnv_to/fromUChars(). They fall back to the public streaming functions
+ * only when the output overflows, to get the preflighting length.
+ */
+
+U_CAPI int32_t U_EXPORT2
+ucnv_fromUCharsBatch(UConverter *cnv,
+                     char *dest, int32_t destCapacity,
+                     const UChar *const *sources, const int32_t *sourceLengths,
+                     int32_t count, int32_t *destOffsets,
+                     UErrorCode *pErrorCode) {
+    UConverterFromUnicodeArgs args;
+    char buffer[1024];
+    int32_t i, srcLength, destLength;
+
+    /* check arguments */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    if( cnv==NULL ||
+        destCapacity<0 || (destCapacity>0 && dest==NULL) ||
+        count<0 || (count>0 && (sources==NULL || sourceLengths==NULL)) ||
+        destOffsets==NULL
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    /* initialize */
+    destCapacity=pinCapacity(dest, destCapacity);
+    args.size=sizeof(args);
+    args.converter=cnv;
+    args.flush=true;
+    args.offsets=NULL;
+    args.target=dest;
+    args.targetLimit=dest+destCapacity;
+    destLength=0;
+
+    for(i=0; i<count; ++i) {
+        destOffsets[i]=destLength;
+        srcLength=sourceLengths[i];
+        if(srcLength<-1 || srcLength>0x3fffffff || (srcLength!=0 && sources[i]==NULL)) {
+            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return destLength;
+        }
+        if(srcLength==-1) {
+            srcLength=u_strlen(sources[i]);
+        }
+        _reset(cnv, UCNV_RESET_FROM_UNICODE, true);
+        if(srcLength==0) {
+            continue;
+        }
+        if(args.targetLimit==buffer+sizeof(buffer)) {
+            /* only preflighting since an earlier overflow */
+            args.target=buffer;
+        }
+        char *t=args.target;
+        args.source=sources[i];
+        args.sourceLimit=args.source+srcLength;
+        _fromUnicodeWithCallback(&args, pErrorCode);
+        destLength+=(int32_t)(args.target-t);
+
+        /* if an overflow occurs, then get the preflighting length */
+        if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+            args.targetLimit=buffer+sizeof(buffer);
+            do {
+                args.target=buffer;
+                *pErrorCode=U_ZERO_ERROR;
+                ucnv_fromUnicode(cnv, &args.target, args.targetLimit,
+                                 &args.source, args.sourceLimit, NULL, true, pErrorCode);
+                destLength+=(int32_t)(args.target-buffer);
+            } while(*pErrorCode==U_BUFFER_OVERFLOW_ERROR);
+        }
+        if(U_FAILURE(*pErrorCode)) {
+            return destLength;
+        }
+    }
+    destOffsets[count]=destLength;
+
+    return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_toUCharsBatch(UConverter *cnv,
+                   UChar *dest, int32_t destCapacity,
+                   const char *const *sources, const int32_t *sourceLengths,
+                   int32_t count, int32_t *destOffsets,
+                   UErrorCode *pErrorCode) {
+    UConverterToUnicodeArgs args;
+    UChar buffer[1024];
+    int32_t i, srcLength, destLength;
+
+    /* check arguments */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    if( cnv==NULL ||
+        destCapacity<0 || (destCapacity>0 && dest==NULL) ||
+        count<0 || (count>0 && (sources==NULL || sourceLengths==NULL)) ||
+        destOffsets==NULL
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    /* initialize */
+    destCapacity=pinCapacity(dest, destCapacity);
+    args.size=sizeof(args);
+    args.converter=cnv;
+    args.flush=true;
+    args.offsets=NULL;
+    args.target=dest;
+    args.targetLimit=dest+destCapacity;
+    destLength=0;
+
+    for(i=0; i<count; ++i) {
+        destOffsets[i]=destLength;
+        srcLength=sourceLengths[i];
+        if(srcLength<-1 || (srcLength!=0 && sources[i]==NULL)) {
+            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return destLength;
+        }
+        if(srcLength==-1) {
+            srcLength=(int32_t)uprv_strlen(sources[i]);
+        }
+        _reset(cnv, UCNV_RESET_TO_UNICODE, true);
+        if(srcLength==0) {
+            continue;
+        }
+        if(args.targetLimit==buffer+UPRV_LENGTHOF(buffer)) {
+            /* only preflighting since an earlier overflow */
+            args.target=buffer;
+        }
+        UChar *t=args.target;
+        args.source=sources[i];
+        args.sourceLimit=args.source+srcLength;
+        _toUnicodeWithCallback(&args, pErrorCode);
+        destLength+=(int32_t)(args.target-t);
+
+        /* if an overflow occurs, then get the preflighting length */
+        if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+            args.targetLimit=buffer+UPRV_LENGTHOF(buffer);
+            do {
+                args.target=buffer;
+                *pErrorCode=U_ZERO_ERROR;
+                ucnv_toUnicode(cnv, &args.target, args.targetLimit,
+                               &args.source, args.sourceLimit, NULL, true, pErrorCode);
+                destLength+=(int32_t)(args.target-buffer);
+            } while(*pErrorCode==U_BUFFER_OVERFLOW_ERROR);
+        }
+        if(U_FAILURE(*pErrorCode)) {
+            return destLength;
+        }
+    }
+    destOffsets[count]=destLength;
+
+    return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+}
+
 /* ucnv_getNextUChar() ------------------------------------------------------ */
 
 U_CAPI UChar32 U_EXPORT2
@@ -2400,7 +2566,7 @@ ucnv_convertEx(UConverter *targetCnv, UConverter *sourceCnv,
 }
 
 /* internal implementation of ucnv_convert() etc. with preflighting */
-static int32_t
+U_CFUNC int32_t
 ucnv_internalConvert(UConverter *outConverter, UConverter *inConverter,
                      char *target, int32_t targetCapacity,
                      const char *source, int32_t sourceLength,
@@ -2521,6 +2687,99 @@ ucnv_convert(const char *toConverterName, const char *fromConverterName,
     return targetLength;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucnv_convertBatch(UConverter *targetCnv, UConverter *sourceCnv,
+                  char *dest, int32_t destCapacity,
+                  const char *const *sources, const int32_t *sourceLengths,
+                  int32_t count, int32_t *destOffsets,
+                  UErrorCode *pErrorCode) {
+    UChar pivotBuffer[CHUNK_SIZE];
+    UChar *pivot, *pivot2;
+    char targetBuffer[CHUNK_SIZE];
+
+    const char *source, *sourceLimit;
+    char *target, *targetStart;
+    const char *targetLimit;
+    int32_t i, sourceLength, destLength;
+
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    if( targetCnv==NULL || sourceCnv==NULL ||
+        destCapacity<0 || (destCapacity>0 && dest==NULL) ||
+        count<0 || (count>0 && (sources==NULL || sourceLengths==NULL)) ||
+        destOffsets==NULL
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    destCapacity=pinCapacity(dest, destCapacity);
+    pivot=pivot2=pivotBuffer;
+    target=dest;
+    targetLimit=dest+destCapacity;
+    destLength=0;
+
+    for(i=0; i<count; ++i) {
+        destOffsets[i]=destLength;
+        source=sources[i];
+        sourceLength=sourceLengths[i];
+        if(sourceLength<-1 || (sourceLength!=0 && source==NULL)) {
+            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return destLength;
+        }
+        if(sourceLength==-1) {
+            sourceLength=(int32_t)uprv_strlen(source);
+        }
+        if(sourceLength==0) {
+            continue;
+        }
+        sourceLimit=source+sourceLength;
+
+        /*
+         * Once dest is full, only get the preflighting length.
+         * ucnv_convertEx() resets both converters and the pivot for each string,
+         * and uses the direct UTF-8 paths where available.
+         */
+        if(target==targetLimit || targetLimit==targetBuffer+CHUNK_SIZE) {
+            target=targetBuffer;
+            targetLimit=targetBuffer+CHUNK_SIZE;
+        }
+        targetStart=target;
+        ucnv_convertEx(targetCnv, sourceCnv,
+                       &target, targetLimit,
+                       &source, sourceLimit,
+                       pivotBuffer, &pivot, &pivot2, pivotBuffer+CHUNK_SIZE,
+                       true,
+                       true,
+                       pErrorCode);
+        destLength+=(int32_t)(target-targetStart);
+
+        while(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+            *pErrorCode=U_ZERO_ERROR;
+            target=targetBuffer;
+            targetLimit=targetBuffer+CHUNK_SIZE;
+            ucnv_convertEx(targetCnv, sourceCnv,
+                           &target, targetLimit,
+                           &source, sourceLimit,
+                           pivotBuffer, &pivot, &pivot2, pivotBuffer+CHUNK_SIZE,
+                           false,
+                           true,
+                           pErrorCode);
+            destLength+=(int32_t)(target-targetBuffer);
+        }
+        if(U_FAILURE(*pErrorCode)) {
+            return destLength;
+        }
+        /* the next string overwrites the NUL that ucnv_convertEx() may have written */
+        *pErrorCode=U_ZERO_ERROR;
+    }
+    destOffsets[count]=destLength;
+
+    return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
+}
+
 /* @internal */
 static int32_t
 ucnv_convertAlgorithmic(UBool convertToAlgorithmic,
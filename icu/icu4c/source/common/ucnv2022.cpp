@@ -84,6 +84,9 @@ static const char SHIFT_IN_STR[]  = "\x0F";
 
 #define CR      0x0D
 #define LF      0x0A
+
+/* stopControls bits for ucnv_toUASCIIRun() and ucnv_fromUASCIIRun() */
+#define ASCII_RUN_STOP_CR_LF (((uint32_t)1<<CR)|((uint32_t)1<<LF))
 #define H_TAB   0x09
 #define V_TAB   0x0B
 #define SPACE   0x20
@@ -203,6 +206,12 @@ typedef struct ISO2022State {
     int8_t prevG;       /* g before single shift (SS2 or SS3) */
 } ISO2022State;
 
+/* ISO-2022-CN resets the whole state at CR and LF; only then are they no-ops */
+static inline UBool
+isInitialCNState(const ISO2022State *state) {
+    return (state->cs[1] | state->cs[2] | state->cs[3] | state->g | state->prevG) == 0;
+}
+
 #define UCNV_OPTIONS_VERSION_MASK 0xf
 #define UCNV_2022_MAX_CONVERTERS 10
 
@@ -1695,6 +1704,24 @@ UConverter_fromUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
     while(source < sourceLimit) {
         if(target < targetLimit) {
 
+            if(pFromU2022State->g == 0 && pFromU2022State->cs[0] == ASCII && *source <= 0x7f) {
+                /* ASCII other than SO/SI/ESC stays in ASCII, see the ISO-2022-JP toUnicode run */
+                int32_t count = ucnv_fromUASCIIRun(
+                    source,
+                    UCNV_ASCII_RUN_LENGTH(sourceLimit - source, targetLimit - target),
+                    target, offsets, (int32_t)(source - args->source),
+                    UCNV_ASCII_RUN_STOP_ESC_SO_SI | (pFromU2022State->cs[2] != 0 ? ASCII_RUN_STOP_CR_LF : 0),
+                    0);
+                if(count > 0) {
+                    source += count;
+                    target += count;
+                    if(offsets) {
+                        offsets += count;
+                    }
+                    continue;
+                }
+            }
+
             sourceChar  = *(source++);
             /*check if the char is a First surrogate*/
             if(U16_IS_SURROGATE(sourceChar)) {
@@ -2112,6 +2139,27 @@ UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         if(myTarget < args->targetLimit){
 
+            if(pToU2022State->g==0 && pToU2022State->cs[0]==ASCII) {
+                /*
+                 * Copy a run of ASCII bytes other than ESC/SO/SI.
+                 * CR and LF only reset G2, so they end the run only while G2 is designated.
+                 */
+                int32_t count=ucnv_toUASCIIRun(
+                    (const uint8_t *)mySource,
+                    UCNV_ASCII_RUN_LENGTH(mySourceLimit-mySource, args->targetLimit-myTarget),
+                    myTarget,
+                    args->offsets!=NULL ? args->offsets+(myTarget-args->target) : NULL,
+                    (int32_t)(mySource-args->source),
+                    UCNV_ASCII_RUN_STOP_ESC_SO_SI|(pToU2022State->cs[2]!=0 ? ASCII_RUN_STOP_CR_LF : 0),
+                    0);
+                if(count>0) {
+                    mySource+=count;
+                    myTarget+=count;
+                    myData->isEmptySegment = false;
+                    continue;
+                }
+            }
+
             mySourceChar= (unsigned char) *mySource++;
 
             switch(mySourceChar) {
@@ -2944,6 +2992,24 @@ UConverter_fromUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
     while( source < sourceLimit){
         if(target < targetLimit){
 
+            if(pFromU2022State->g == 0 && *source <= 0x7f) {
+                /* US-ASCII other than SO/SI/ESC, see the ISO-2022-CN toUnicode run */
+                int32_t count = ucnv_fromUASCIIRun(
+                    source,
+                    UCNV_ASCII_RUN_LENGTH(sourceLimit - source, targetLimit - target),
+                    target, offsets, (int32_t)(source - args->source),
+                    UCNV_ASCII_RUN_STOP_ESC_SO_SI | (isInitialCNState(pFromU2022State) ? 0 : ASCII_RUN_STOP_CR_LF),
+                    0);
+                if(count > 0) {
+                    source += count;
+                    target += count;
+                    if(offsets) {
+                        offsets += count;
+                    }
+                    continue;
+                }
+            }
+
             sourceChar  = *(source++);
             /*check if the char is a First surrogate*/
              if(U16_IS_SURROGATE(sourceChar)) {
@@ -3295,6 +3361,27 @@ UConverter_toUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         if(myTarget < args->targetLimit){
 
+            if(pToU2022State->g==0) {
+                /*
+                 * Copy a run of ASCII bytes other than ESC/SO/SI.
+                 * CR and LF reset the state, so they end the run unless it is the initial one.
+                 */
+                int32_t count=ucnv_toUASCIIRun(
+                    (const uint8_t *)mySource,
+                    UCNV_ASCII_RUN_LENGTH(mySourceLimit-mySource, args->targetLimit-myTarget),
+                    myTarget,
+                    args->offsets!=NULL ? args->offsets+(myTarget-args->target) : NULL,
+                    (int32_t)(mySource-args->source),
+                    UCNV_ASCII_RUN_STOP_ESC_SO_SI|(isInitialCNState(pToU2022State) ? 0 : ASCII_RUN_STOP_CR_LF),
+                    0);
+                if(count>0) {
+                    mySource+=count;
+                    myTarget+=count;
+                    myData->isEmptySegment = false;
+                    continue;
+                }
+            }
+
             mySourceChar= (unsigned char) *mySource++;
 
             switch(mySourceChar){
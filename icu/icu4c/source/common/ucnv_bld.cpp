@@ -39,10 +39,10 @@
 #include "ucnv_ext.h"
 #include "ucnv_cnv.h"
 #include "ucnv_imp.h"
-#include "uhash.h"
 #include "umutex.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "flathashmap.h"
 #include "ucln_cmn.h"
 #include "ustr_cnv.h"
 
@@ -193,7 +193,9 @@ static struct {
 
 
 /*initializes some global variables */
-static UHashtable *SHARED_DATA_HASHTABLE = NULL;
+/* Maps converter names (owned by the shared data) to the shared data. */
+typedef icu::FlatHashMap<const char *, UConverterSharedData *, icu::CharsKeyTraits> SharedDataHashtable;
+static SharedDataHashtable *SHARED_DATA_HASHTABLE = NULL;
 static icu::UMutex cnvCacheMutex;
 /*  Note:  the global mutex is used for      */
 /*         reference count updates.          */
@@ -243,8 +245,8 @@ ucnv_flushAvailableConverterCache() {
 /*                Not supported API.                                          */
 static UBool U_CALLCONV ucnv_cleanup(void) {
     ucnv_flushCache();
-    if (SHARED_DATA_HASHTABLE != NULL && uhash_count(SHARED_DATA_HASHTABLE) == 0) {
-        uhash_close(SHARED_DATA_HASHTABLE);
+    if (SHARED_DATA_HASHTABLE != NULL && SHARED_DATA_HASHTABLE->count() == 0) {
+        delete SHARED_DATA_HASHTABLE;
         SHARED_DATA_HASHTABLE = NULL;
     }
 
@@ -416,16 +418,6 @@ getAlgorithmicTypeFromName(const char *realName)
     return NULL;
 }
 
-/*
-* Based on the number of known converters, this determines how many times larger
-* the shared data hash table should be. When on small platforms, or just a couple
-* of converters are used, this number should be 2. When memory is plentiful, or
-* when ucnv_countAvailable is ever used with a lot of available converters,
-* this should be 4.
-* Larger numbers reduce the number of hash collisions, but use more memory.
-*/
-#define UCNV_CACHE_LOAD_FACTOR 2
-
 /* Puts the shared data in the static hashtable SHARED_DATA_HASHTABLE */
 /*   Will always be called with the cnvCacheMutex already being held   */
 /*     by the calling function.                                       */
@@ -441,13 +433,10 @@ ucnv_shareConverterData(UConverterSharedData * data)
 
     if (SHARED_DATA_HASHTABLE == NULL)
     {
-        SHARED_DATA_HASHTABLE = uhash_openSize(uhash_hashChars, uhash_compareChars, NULL,
-                            ucnv_io_countKnownConverters(&err)*UCNV_CACHE_LOAD_FACTOR,
-                            &err);
-        ucnv_enableCleanup();
-
-        if (U_FAILURE(err))
+        SHARED_DATA_HASHTABLE = new SharedDataHashtable();
+        if (SHARED_DATA_HASHTABLE == NULL)
             return;
+        ucnv_enableCleanup();
     }
 
     /* ### check to see if the element is not already there! */
@@ -461,16 +450,14 @@ ucnv_shareConverterData(UConverterSharedData * data)
     UCNV_DEBUG_LOG("put:chk",data->staticData->name,sanity);
     */
 
-    /* Mark it shared */
-    data->sharedDataCached = true;
-
-    uhash_put(SHARED_DATA_HASHTABLE,
-            (void*) data->staticData->name, /* Okay to cast away const as long as
-            keyDeleter == NULL */
-            data,
-            &err);
+    SHARED_DATA_HASHTABLE->put(data->staticData->name, data, err);
     UCNV_DEBUG_LOG("put", data->staticData->name,data);
 
+    /* Mark it shared, unless it could not be added; then it is unloaded when it is no longer used */
+    if (U_SUCCESS(err)) {
+        data->sharedDataCached = true;
+    }
+
 }
 
 /*  Look up a converter name in the shared data cache.                    */
@@ -491,7 +478,7 @@ ucnv_getSharedConverterData(const char *name)
     {
         UConverterSharedData *rc;
 
-        rc = (UConverterSharedData*)uhash_get(SHARED_DATA_HASHTABLE, name);
+        rc = SHARED_DATA_HASHTABLE->get(name);
         UCNV_DEBUG_LOG("get",name,rc);
         return rc;
     }
@@ -1033,7 +1020,6 @@ ucnv_flushCache ()
     UConverterSharedData *mySharedData = NULL;
     int32_t pos;
     int32_t tableDeletedNum = 0;
-    const UHashElement *e;
     /*UErrorCode status = U_ILLEGAL_ARGUMENT_ERROR;*/
     int32_t i, remaining;
 
@@ -1071,10 +1057,10 @@ ucnv_flushCache ()
     i = 0;
     do {
         remaining = 0;
-        pos = UHASH_FIRST;
-        while ((e = uhash_nextElement (SHARED_DATA_HASHTABLE, &pos)) != NULL)
+        for (pos = SHARED_DATA_HASHTABLE->nextPosition(-1); pos >= 0;
+                pos = SHARED_DATA_HASHTABLE->nextPosition(pos))
         {
-            mySharedData = (UConverterSharedData *) e->value.pointer;
+            mySharedData = SHARED_DATA_HASHTABLE->valueAt(pos);
             /*deletes only if reference counter == 0 */
             if (mySharedData->referenceCounter == 0)
             {
@@ -1082,7 +1068,7 @@ ucnv_flushCache ()
 
                 UCNV_DEBUG_LOG("del",mySharedData->staticData->name,mySharedData);
 
-                uhash_removeElement(SHARED_DATA_HASHTABLE, e);
+                SHARED_DATA_HASHTABLE->removeAt(pos);
                 mySharedData->sharedDataCached = false;
                 ucnv_deleteSharedConverterData (mySharedData);
             } else {
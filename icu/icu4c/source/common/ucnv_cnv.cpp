@@ -27,6 +27,9 @@
 #include "ucnv_cnv.h"
 #include "ucnv_bld.h"
 #include "cmemory.h"
+#include "usimd.h"
+
+U_NAMESPACE_USE
 
 U_CFUNC void
 ucnv_getCompleteUnicodeSet(const UConverter *cnv,
@@ -179,4 +182,57 @@ ucnv_toUWriteCodePoint(UConverter *cnv,
     }
 }
 
+/* true if c ends an ASCII run, see ucnv_toUASCIIRun() */
+static inline UBool
+isASCIIRunEnd(UChar c, uint32_t stopControls, uint8_t stop) {
+    return c<0x20 ? ((stopControls>>c)&1)!=0 : (c>0x7f || c==stop);
+}
+
+U_CFUNC int32_t
+ucnv_toUASCIIRun(const uint8_t *source, int32_t length,
+                 UChar *target, int32_t *offsets, int32_t sourceIndex,
+                 uint32_t stopControls, uint8_t stop) {
+    int32_t i=0;
+    while(i<length) {
+        int32_t blockLimit;
+        i+=simd::widenPrintableASCII(source+i, length-i, target+i, stop);
+        /* continue unit by unit through the block that ended the block copy */
+        blockLimit= (length-i)>16 ? i+16 : length;
+        while(i<blockLimit && !isASCIIRunEnd(source[i], stopControls, stop)) {
+            target[i]=source[i];
+            ++i;
+        }
+        if(i<blockLimit) {
+            break; /* end of the run */
+        }
+    }
+    if(offsets!=NULL) {
+        simd::fillOffsets(offsets, i, sourceIndex);
+    }
+    return i;
+}
+
+U_CFUNC int32_t
+ucnv_fromUASCIIRun(const UChar *source, int32_t length,
+                   uint8_t *target, int32_t *offsets, int32_t sourceIndex,
+                   uint32_t stopControls, uint8_t stop) {
+    int32_t i=0;
+    while(i<length) {
+        int32_t blockLimit;
+        i+=simd::narrowPrintableASCII(source+i, length-i, target+i, stop);
+        blockLimit= (length-i)>16 ? i+16 : length;
+        while(i<blockLimit && !isASCIIRunEnd(source[i], stopControls, stop)) {
+            target[i]=(uint8_t)source[i];
+            ++i;
+        }
+        if(i<blockLimit) {
+            break;
+        }
+    }
+    if(offsets!=NULL) {
+        simd::fillOffsets(offsets, i, sourceIndex);
+    }
+    return i;
+}
+
 #endif
@@ -318,6 +318,52 @@ ucnv_toUWriteCodePoint(UConverter *cnv,
                        int32_t sourceIndex,
                        UErrorCode *pErrorCode);
 
+/**
+ * Bit set for the C0 controls that end an ASCII run when they change a
+ * converter's state: ESC, SO and SI for the ISO-2022 converters.
+ */
+#define UCNV_ASCII_RUN_STOP_ESC_SO_SI (((uint32_t)1<<0x1b)|((uint32_t)1<<0xe)|((uint32_t)1<<0xf))
+
+/**
+ * The length argument for ucnv_toUASCIIRun() and ucnv_fromUASCIIRun():
+ * the smaller of the remaining source length and target capacity.
+ */
+#define UCNV_ASCII_RUN_LENGTH(sourceLength, targetCapacity) \
+    ((sourceLength)<(targetCapacity) ? (int32_t)(sourceLength) : (int32_t)(targetCapacity))
+
+/**
+ * Converts a run of ASCII bytes to the same UChars, for a stateful converter
+ * while it is in a state where ASCII maps to itself.
+ * The run ends before the first byte that is not ASCII,
+ * is a C0 control c with bit c set in stopControls, or is the stop byte
+ * (a printable one that has a special meaning, or 0 for none),
+ * or after length bytes.
+ * Long runs are copied in blocks.
+ *
+ * @param source the input bytes
+ * @param length the maximum length of the run,
+ *               at most the number of bytes and of UChars available
+ * @param target receives as many UChars as the function returns
+ * @param offsets if not NULL, receives sourceIndex, sourceIndex+1, ...
+ * @param sourceIndex the offset of source[0]
+ * @param stopControls one bit per C0 control byte that ends the run
+ * @param stop a byte 0x20..0x7f that ends the run, or 0
+ * @return the length of the run
+ */
+U_CFUNC int32_t
+ucnv_toUASCIIRun(const uint8_t *source, int32_t length,
+                 UChar *target, int32_t *offsets, int32_t sourceIndex,
+                 uint32_t stopControls, uint8_t stop);
+
+/**
+ * Converts a run of ASCII UChars to the same bytes,
+ * the reverse of ucnv_toUASCIIRun().
+ */
+U_CFUNC int32_t
+ucnv_fromUASCIIRun(const UChar *source, int32_t length,
+                   uint8_t *target, int32_t *offsets, int32_t sourceIndex,
+                   uint32_t stopControls, uint8_t stop);
+
 #endif
 
 #endif /* UCNV_CNV */
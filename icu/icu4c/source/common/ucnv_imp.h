@@ -127,6 +127,17 @@ ucnv_unloadSharedDataIfReady(UConverterSharedData *sharedData);
 U_CFUNC void
 ucnv_incrementRefCount(UConverterSharedData *sharedData);
 
+/**
+ * Converts a whole string from inConverter's charset to outConverter's
+ * with preflighting, like ucnv_convert() but with existing converters.
+ * The converters must be reset.
+ */
+U_CFUNC int32_t
+ucnv_internalConvert(UConverter *outConverter, UConverter *inConverter,
+                     char *target, int32_t targetCapacity,
+                     const char *source, int32_t sourceLength,
+                     UErrorCode *pErrorCode);
+
 /**
  * These are the default error handling callbacks for the charset conversion framework.
  * For performance reasons, they are only called to handle an error (not normally called for a reset or close).
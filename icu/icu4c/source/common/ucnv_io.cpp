@@ -198,6 +198,16 @@ static const UConverterAliasOptions defaultTableOptions = {
 };
 static UConverterAlias gMainTable;
 
+/*
+ * Open-addressing hash index over the normalized alias names,
+ * built when the alias data is loaded.
+ * Each entry is the aliasList index + 1, or 0 for an empty slot.
+ * NULL if the alias table is unnormalized (or allocation failed):
+ * Then findConverter() does a binary search.
+ */
+static uint16_t *gAliasHashTable=NULL;
+static uint32_t gAliasHashMask=0;
+
 #define GET_STRING(idx) (const char *)(gMainTable.stringTable + (idx))
 #define GET_NORMALIZED_STRING(idx) (const char *)(gMainTable.normalizedStringTable + (idx))
 
@@ -224,11 +234,51 @@ static UBool U_CALLCONV ucnv_io_cleanup(void)
     }
     gAliasDataInitOnce.reset();
 
+    uprv_free(gAliasHashTable);
+    gAliasHashTable = NULL;
+    gAliasHashMask = 0;
+
     uprv_memset(&gMainTable, 0, sizeof(gMainTable));
 
     return true;                   /* Everything was cleaned up */
 }
 
+/* FNV-1a hash of a normalized alias name */
+static inline uint32_t
+hashAlias(const char *alias) {
+    uint32_t hash = 0x811c9dc5;
+    uint8_t c;
+    while ((c = (uint8_t)*alias++) != 0) {
+        hash = (hash ^ c) * 0x01000193;
+    }
+    return hash ^ (hash >> 16);
+}
+
+static void
+initAliasHashTable() {
+    uint32_t count = gMainTable.untaggedConvArraySize;
+    uint32_t capacity, i, h;
+
+    if (gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED || count >= 0xffff) {
+        return;
+    }
+    /* at most half full */
+    for (capacity = 64; capacity < 2 * count; capacity <<= 1) {}
+    gAliasHashTable = (uint16_t *)uprv_malloc(capacity * sizeof(uint16_t));
+    if (gAliasHashTable == NULL) {
+        return;
+    }
+    uprv_memset(gAliasHashTable, 0, capacity * sizeof(uint16_t));
+    gAliasHashMask = capacity - 1;
+    for (i = 0; i < count; ++i) {
+        h = hashAlias(GET_NORMALIZED_STRING(gMainTable.aliasList[i])) & gAliasHashMask;
+        while (gAliasHashTable[h] != 0) {
+            h = (h + 1) & gAliasHashMask;
+        }
+        gAliasHashTable[h] = (uint16_t)(i + 1);
+    }
+}
+
 static void U_CALLCONV initAliasData(UErrorCode &errCode) {
     UDataMemory *data;
     const uint16_t *table;
@@ -306,6 +356,8 @@ static void U_CALLCONV initAliasData(UErrorCode &errCode) {
     currOffset += gMainTable.stringTableSize;
     gMainTable.normalizedStringTable = ((gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED)
         ? gMainTable.stringTable : (table + currOffset));
+
+    initAliasHashTable();
 }
 
 
@@ -544,6 +596,30 @@ ucnv_compareNames(const char *name1, const char *name2) {
     }
 }
 
+/*
+ * found an alias at aliasList[idx]
+ * return the converter number index for gConverterList
+ */
+static inline uint32_t
+foundConverter(uint32_t idx, UBool *containsOption, UErrorCode *pErrorCode) {
+    /* Since the gencnval tool folds duplicates into one entry,
+     * this alias in gAliasList is unique, but different standards
+     * may map an alias to different converters.
+     */
+    if (gMainTable.untaggedConvArray[idx] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
+        *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
+    }
+    /* State whether the canonical converter name contains an option.
+    This information is contained in this list in order to maintain backward & forward compatibility. */
+    if (containsOption) {
+        UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
+        *containsOption = (UBool)((containsCnvOptionInfo
+            && ((gMainTable.untaggedConvArray[idx] & UCNV_CONTAINS_OPTION_BIT) != 0))
+            || !containsCnvOptionInfo);
+    }
+    return gMainTable.untaggedConvArray[idx] & UCNV_CONVERTER_INDEX_MASK;
+}
+
 /*
  * search for an alias
  * return the converter number index for gConverterList
@@ -565,6 +641,19 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         /* Lower case and remove ignoreable characters. */
         ucnv_io_stripForCompare(strippedName, alias);
         alias = strippedName;
+
+        if (gAliasHashTable != NULL) {
+            /* look up the normalized alias in the hash index */
+            uint32_t h = hashAlias(alias) & gAliasHashMask;
+            uint32_t entry;
+            while ((entry = gAliasHashTable[h]) != 0) {
+                if (uprv_strcmp(alias, GET_NORMALIZED_STRING(gMainTable.aliasList[entry - 1])) == 0) {
+                    return foundConverter(entry - 1, containsOption, pErrorCode);
+                }
+                h = (h + 1) & gAliasHashMask;
+            }
+            return UINT32_MAX;
+        }
     }
 
     /* do a binary search for the alias */
@@ -591,22 +680,7 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         } else if (result > 0) {
             start = mid;
         } else {
-            /* Since the gencnval tool folds duplicates into one entry,
-             * this alias in gAliasList is unique, but different standards
-             * may map an alias to different converters.
-             */
-            if (gMainTable.untaggedConvArray[mid] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
-                *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
-            }
-            /* State whether the canonical converter name contains an option.
-            This information is contained in this list in order to maintain backward & forward compatibility. */
-            if (containsOption) {
-                UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
-                *containsOption = (UBool)((containsCnvOptionInfo
-                    && ((gMainTable.untaggedConvArray[mid] & UCNV_CONTAINS_OPTION_BIT) != 0))
-                    || !containsCnvOptionInfo);
-            }
-            return gMainTable.untaggedConvArray[mid] & UCNV_CONVERTER_INDEX_MASK;
+            return foundConverter(mid, containsOption, pErrorCode);
         }
     }
 
@@ -0,0 +1,300 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  ucnv_par.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   ucnv_convertParallel(): Converts large buffers with stateless converters
+*   in pieces on several threads.
+*   In a separate file so that the rest of the conversion code
+*   does not start threads.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include <thread>
+
+#include "unicode/ucnv.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "putilimp.h"
+#include "ucnv_bld.h"
+#include "ucnv_imp.h"
+#include "ucnvmbcs.h"
+#include "ustr_imp.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+// Pieces shorter than this are not worth a thread.
+constexpr int32_t MIN_PIECE_LENGTH = 0x10000;
+constexpr int32_t MAX_THREAD_COUNT = 64;
+constexpr int32_t PIVOT_LENGTH = 1024;
+
+/**
+ * Returns the code unit width (1, 2 or 4 bytes) if a reset converter of this kind
+ * converts the same at any code point boundary as in the middle of a conversion,
+ * and 0 otherwise.
+ */
+int32_t getStatelessUnitWidth(const UConverter *cnv) {
+    switch(ucnv_getType(cnv)) {
+    case UCNV_US_ASCII:
+    case UCNV_LATIN_1:
+    case UCNV_UTF8:
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    case UCNV_SBCS:
+    case UCNV_DBCS:
+    case UCNV_MBCS:
+#endif
+        return 1;
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+        // version=1 reads and writes a BOM.
+        return UCNV_GET_VERSION(cnv) == 0 ? 2 : 0;
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * Finds split points in the source:
+ * Code units for C0 controls that cannot be part of a multi-byte sequence.
+ * No mapping table maps a sequence with such a control to or from another sequence,
+ * so both converters start fresh after one.
+ */
+class SplitFinder {
+public:
+    SplitFinder(const UConverter *cnv, int32_t unitWidth) :
+            type(ucnv_getType(cnv)), width(unitWidth) {
+        for(int32_t b = 0; b < 0x100; ++b) {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+            if(width == 1 && cnv->sharedData->staticData->conversionType == UCNV_MBCS) {
+                isSplitByte[b] = ucnv_MBCSIsSplitByte(cnv->sharedData, (uint8_t)b);
+                continue;
+            }
+#endif
+            isSplitByte[b] = b < 0x20;
+        }
+    }
+
+    /**
+     * @return the index after the first split code unit at or after start,
+     *         or -1 if there is none
+     */
+    int32_t findAfter(const uint8_t *s, int32_t start, int32_t length) const {
+        int32_t i = (start + width - 1) & ~(width - 1);
+        for(; i <= length - width; i += width) {
+            switch(type) {
+            case UCNV_UTF16_BigEndian:
+                if(s[i] == 0 && isSplitByte[s[i + 1]]) { return i + 2; }
+                break;
+            case UCNV_UTF16_LittleEndian:
+                if(s[i + 1] == 0 && isSplitByte[s[i]]) { return i + 2; }
+                break;
+            case UCNV_UTF32_BigEndian:
+                if((s[i] | s[i + 1] | s[i + 2]) == 0 && isSplitByte[s[i + 3]]) { return i + 4; }
+                break;
+            case UCNV_UTF32_LittleEndian:
+                if((s[i + 1] | s[i + 2] | s[i + 3]) == 0 && isSplitByte[s[i]]) { return i + 4; }
+                break;
+            default:
+                if(isSplitByte[s[i]]) { return i + 1; }
+                break;
+            }
+        }
+        return -1;
+    }
+
+private:
+    UConverterType type;
+    int32_t width;
+    UBool isSplitByte[0x100];
+};
+
+/** Converts one piece of the source into its own output buffer. */
+struct ConvertPiece : public UMemory {
+    void convert();
+
+    UConverter *targetCnv = nullptr;
+    UConverter *sourceCnv = nullptr;
+    LocalUConverterPointer targetClone;
+    LocalUConverterPointer sourceClone;
+    const char *source = nullptr;
+    const char *sourceLimit = nullptr;
+    CharString output;
+    UErrorCode errorCode = U_ZERO_ERROR;
+};
+
+void ConvertPiece::convert() {
+    UChar pivotBuffer[PIVOT_LENGTH];
+    UChar *pivotSource = pivotBuffer, *pivotTarget = pivotBuffer;
+    const char *s = source;
+    int32_t length = (int32_t)(sourceLimit - source);
+    int32_t capacityHint = length <= 0x3fffffff ? length * 2 : 0x7fffffff;
+    UBool reset = true;
+    UErrorCode convertErrorCode;
+    do {
+        int32_t capacity;
+        char *buffer = output.getAppendBuffer(PIVOT_LENGTH, capacityHint, capacity, errorCode);
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+        char *t = buffer;
+        convertErrorCode = U_ZERO_ERROR;
+        ucnv_convertEx(targetCnv, sourceCnv,
+                       &t, buffer + capacity,
+                       &s, sourceLimit,
+                       pivotBuffer, &pivotSource, &pivotTarget, pivotBuffer + PIVOT_LENGTH,
+                       reset, true, &convertErrorCode);
+        reset = false;
+        output.append(buffer, (int32_t)(t - buffer), errorCode);
+    } while(convertErrorCode == U_BUFFER_OVERFLOW_ERROR && U_SUCCESS(errorCode));
+    if(U_SUCCESS(errorCode) && U_FAILURE(convertErrorCode)) {
+        errorCode = convertErrorCode;
+    }
+}
+
+/**
+ * Starts a thread that converts the piece.
+ * @return false if the thread could not be created
+ */
+bool startThread(std::thread &thread, ConvertPiece &piece) {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    // std::thread reports failure with an exception, which must not
+    // escape this C API. Without exceptions, the failure is fatal.
+    try {
+        thread = std::thread(&ConvertPiece::convert, &piece);
+    } catch(...) {
+        return false;
+    }
+#else
+    thread = std::thread(&ConvertPiece::convert, &piece);
+#endif
+    return true;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+ucnv_convertParallel(UConverter *targetCnv, UConverter *sourceCnv,
+                     char *dest, int32_t destCapacity,
+                     const char *source, int32_t sourceLength,
+                     int32_t threadCount,
+                     UErrorCode *pErrorCode) {
+    if(pErrorCode == nullptr || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( targetCnv == nullptr || sourceCnv == nullptr ||
+        destCapacity < 0 || (destCapacity > 0 && dest == nullptr) ||
+        sourceLength < -1 || (sourceLength != 0 && source == nullptr) ||
+        threadCount < 1
+    ) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(sourceLength < 0) {
+        sourceLength = (int32_t)uprv_strlen(source);
+    }
+
+    // Split the source into pieces of roughly equal length.
+    int32_t unitWidth = getStatelessUnitWidth(sourceCnv);
+    int32_t pieceCount = 1;
+    int32_t pieceStarts[MAX_THREAD_COUNT + 1];
+    pieceStarts[0] = 0;
+    if(threadCount > 1 && unitWidth > 0 && getStatelessUnitWidth(targetCnv) > 0 &&
+            sourceLength >= 2 * MIN_PIECE_LENGTH) {
+        int32_t maxCount = uprv_min(threadCount, MAX_THREAD_COUNT);
+        maxCount = uprv_min(maxCount, sourceLength / MIN_PIECE_LENGTH);
+        SplitFinder finder(sourceCnv, unitWidth);
+        for(int32_t i = 1; i < maxCount; ++i) {
+            int32_t start = (int32_t)(((int64_t)sourceLength * i) / maxCount);
+            start = finder.findAfter((const uint8_t *)source,
+                                     uprv_max(start, pieceStarts[pieceCount - 1]), sourceLength);
+            if(start < 0 || start == sourceLength) {
+                break;
+            }
+            pieceStarts[pieceCount++] = start;
+        }
+    }
+    pieceStarts[pieceCount] = sourceLength;
+
+    ucnv_resetToUnicode(sourceCnv);
+    ucnv_resetFromUnicode(targetCnv);
+    if(pieceCount == 1) {
+        return ucnv_internalConvert(targetCnv, sourceCnv,
+                                    dest, destCapacity,
+                                    source, sourceLength,
+                                    pErrorCode);
+    }
+
+    LocalArray<ConvertPiece> pieces(new ConvertPiece[pieceCount], *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    for(int32_t i = 0; i < pieceCount; ++i) {
+        ConvertPiece &piece = pieces[i];
+        if(i == 0) {
+            piece.targetCnv = targetCnv;
+            piece.sourceCnv = sourceCnv;
+        } else {
+            piece.targetClone.adoptInstead(ucnv_clone(targetCnv, pErrorCode));
+            piece.sourceClone.adoptInstead(ucnv_clone(sourceCnv, pErrorCode));
+            if(U_FAILURE(*pErrorCode)) {
+                return 0;
+            }
+            piece.targetCnv = piece.targetClone.getAlias();
+            piece.sourceCnv = piece.sourceClone.getAlias();
+        }
+        piece.source = source + pieceStarts[i];
+        piece.sourceLimit = source + pieceStarts[i + 1];
+    }
+
+    // The calling thread converts the first piece, and the pieces
+    // for which no thread could be started.
+    std::thread threads[MAX_THREAD_COUNT];
+    int32_t threadLimit = 1;
+    while(threadLimit < pieceCount && startThread(threads[threadLimit], pieces[threadLimit])) {
+        ++threadLimit;
+    }
+    pieces[0].convert();
+    for(int32_t i = threadLimit; i < pieceCount; ++i) {
+        pieces[i].convert();
+    }
+    for(int32_t i = 1; i < threadLimit; ++i) {
+        threads[i].join();
+    }
+
+    // Stitch the outputs together, up to the first error.
+    int32_t destLength = 0;
+    for(int32_t i = 0; i < pieceCount; ++i) {
+        const ConvertPiece &piece = pieces[i];
+        int32_t length = piece.output.length();
+        if(length > INT32_MAX - destLength) {
+            *pErrorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        if(destLength < destCapacity) {
+            uprv_memcpy(dest + destLength, piece.output.data(),
+                        uprv_min(length, destCapacity - destLength));
+        }
+        destLength += length;
+        if(U_FAILURE(piece.errorCode)) {
+            *pErrorCode = piece.errorCode;
+            return destLength;
+        }
+    }
+    return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
+}
+
+#endif  // !UCONFIG_NO_CONVERSION
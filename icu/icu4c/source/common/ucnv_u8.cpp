@@ -719,6 +719,15 @@ ucnv_UTF8FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
         /* See note in ucnv_SBCSFromUTF8() about this goto. */
     }
 
+    /* copy the well-formed prefix in bulk, then continue with the conversion loop */
+    if(count>0) {
+        int32_t length=ustr_spanWellFormedUTF8(source, count, NULL, NULL);
+        uprv_memcpy(target, source, length);
+        source+=length;
+        target+=length;
+        count-=length;
+    }
+
     /* conversion loop */
     while(count>0) {
         b=*source++;
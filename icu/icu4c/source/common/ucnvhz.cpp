@@ -174,6 +174,23 @@ UConverter_toUnicode_HZ_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
     while(mySource< mySourceLimit){
         
         if(myTarget < args->targetLimit){
+
+            if(args->converter->mode != UCNV_TILDE && !myData->isStateDBCS) {
+                /* copy a run of ASCII bytes up to the next ~ */
+                int32_t count=ucnv_toUASCIIRun(
+                    (const uint8_t *)mySource,
+                    UCNV_ASCII_RUN_LENGTH(mySourceLimit - mySource, args->targetLimit - myTarget),
+                    myTarget,
+                    args->offsets ? args->offsets + (myTarget - args->target) : NULL,
+                    (int32_t)(mySource - args->source),
+                    0, UCNV_TILDE);
+                if(count > 0) {
+                    mySource += count;
+                    myTarget += count;
+                    myData->isEmptySegment = false;
+                    continue;
+                }
+            }
             
             mySourceChar= (unsigned char) *mySource++;
 
@@ -362,6 +379,24 @@ UConverter_fromUnicode_HZ_OFFSETS_LOGIC (UConverterFromUnicodeArgs * args,
     while (mySourceIndex < mySourceLength){
         targetUniChar = missingCharMarker;
         if (myTargetIndex < targetLength){
+
+            if(!isTargetUCharDBCS && myConverterData->isEscapeAppended) {
+                /* copy a run of ASCII characters up to the next ~ */
+                int32_t count = ucnv_fromUASCIIRun(
+                    mySource + mySourceIndex,
+                    UCNV_ASCII_RUN_LENGTH(mySourceLength - mySourceIndex, targetLength - myTargetIndex),
+                    (uint8_t *)myTarget + myTargetIndex,
+                    offsets, mySourceIndex,
+                    0, UCNV_TILDE);
+                if(count > 0) {
+                    mySourceIndex += count;
+                    myTargetIndex += count;
+                    if(offsets) {
+                        offsets += count;
+                    }
+                    continue;
+                }
+            }
             
             mySourceChar = (UChar) mySource[mySourceIndex++];
             
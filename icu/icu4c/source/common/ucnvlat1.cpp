@@ -21,12 +21,13 @@
 #include "unicode/ucnv.h"
 #include "unicode/uset.h"
 #include "unicode/utf8.h"
+#include "cmemory.h"
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
-/* control optimizations according to the platform */
-#define LATIN1_UNROLL_FROM_UNICODE 1
+U_NAMESPACE_USE
 
 /* ISO 8859-1 --------------------------------------------------------------- */
 
@@ -63,37 +64,17 @@ _Latin1ToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
         length=targetCapacity;
     }
 
-    if(targetCapacity>=8) {
-        /* This loop is unrolled for speed and improved pipelining. */
-        int32_t count, loops;
-
-        loops=count=targetCapacity>>3;
-        length=targetCapacity&=0x7;
-        do {
-            target[0]=source[0];
-            target[1]=source[1];
-            target[2]=source[2];
-            target[3]=source[3];
-            target[4]=source[4];
-            target[5]=source[5];
-            target[6]=source[6];
-            target[7]=source[7];
-            target+=8;
-            source+=8;
-        } while(--count>0);
+    if(targetCapacity>=16) {
+        /* widen whole blocks of bytes at a time */
+        int32_t count=simd::widenLatin1(source, targetCapacity, target);
+        source+=count;
+        target+=count;
+        length=targetCapacity-=count;
 
         if(offsets!=NULL) {
-            do {
-                offsets[0]=sourceIndex++;
-                offsets[1]=sourceIndex++;
-                offsets[2]=sourceIndex++;
-                offsets[3]=sourceIndex++;
-                offsets[4]=sourceIndex++;
-                offsets[5]=sourceIndex++;
-                offsets[6]=sourceIndex++;
-                offsets[7]=sourceIndex++;
-                offsets+=8;
-            } while(--loops>0);
+            simd::fillOffsets(offsets, count, sourceIndex);
+            offsets+=count;
+            sourceIndex+=count;
         }
     }
 
@@ -181,82 +162,15 @@ _Latin1FromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
         goto getTrail;
     }
 
-#if LATIN1_UNROLL_FROM_UNICODE
-    /* unroll the loop with the most common case */
+    /* convert whole blocks of the most common case at a time */
     if(targetCapacity>=16) {
-        int32_t count, loops;
-        UChar u, oredChars;
-
-        loops=count=targetCapacity>>4;
-        do {
-            oredChars=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-
-            /* were all 16 entries really valid? */
-            if(oredChars>max) {
-                /* no, return to the first of these 16 */
-                source-=16;
-                target-=16;
-                break;
-            }
-        } while(--count>0);
-        count=loops-count;
-        targetCapacity-=16*count;
-
-        if(offsets!=NULL) {
-            oldTarget+=16*count;
-            while(count>0) {
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                --count;
-            }
-        }
+        int32_t count= max==0xff ?
+            simd::narrowLatin1(source, targetCapacity, target) :
+            simd::narrowASCII(source, targetCapacity, target);
+        source+=count;
+        target+=count;
+        targetCapacity-=count;
     }
-#endif
 
     /* conversion loop */
     c=0;
@@ -301,11 +215,9 @@ _Latin1FromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     /* set offsets since the start */
     if(offsets!=NULL) {
-        size_t count=target-oldTarget;
-        while(count>0) {
-            *offsets++=sourceIndex++;
-            --count;
-        }
+        int32_t count=(int32_t)(target-oldTarget);
+        simd::fillOffsets(offsets, count, sourceIndex);
+        offsets+=count;
     }
 
     if(U_SUCCESS(*pErrorCode) && source<sourceLimit && target>=(uint8_t *)pArgs->targetLimit) {
@@ -509,48 +421,12 @@ _ASCIIToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
         targetCapacity=length;
     }
 
-    if(targetCapacity>=8) {
-        /* This loop is unrolled for speed and improved pipelining. */
-        int32_t count, loops;
-        UChar oredChars;
-
-        loops=count=targetCapacity>>3;
-        do {
-            oredChars=target[0]=source[0];
-            oredChars|=target[1]=source[1];
-            oredChars|=target[2]=source[2];
-            oredChars|=target[3]=source[3];
-            oredChars|=target[4]=source[4];
-            oredChars|=target[5]=source[5];
-            oredChars|=target[6]=source[6];
-            oredChars|=target[7]=source[7];
-
-            /* were all 16 entries really valid? */
-            if(oredChars>0x7f) {
-                /* no, return to the first of these 16 */
-                break;
-            }
-            source+=8;
-            target+=8;
-        } while(--count>0);
-        count=loops-count;
-        targetCapacity-=count*8;
-
-        if(offsets!=NULL) {
-            oldTarget+=count*8;
-            while(count>0) {
-                offsets[0]=sourceIndex++;
-                offsets[1]=sourceIndex++;
-                offsets[2]=sourceIndex++;
-                offsets[3]=sourceIndex++;
-                offsets[4]=sourceIndex++;
-                offsets[5]=sourceIndex++;
-                offsets[6]=sourceIndex++;
-                offsets[7]=sourceIndex++;
-                offsets+=8;
-                --count;
-            }
-        }
+    if(targetCapacity>=16) {
+        /* widen whole blocks of ASCII at a time */
+        int32_t count=simd::widenASCII(source, targetCapacity, target);
+        source+=count;
+        target+=count;
+        targetCapacity-=count;
     }
 
     /* conversion loop */
@@ -573,11 +449,9 @@ _ASCIIToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     /* set offsets since the start */
     if(offsets!=NULL) {
-        size_t count=target-oldTarget;
-        while(count>0) {
-            *offsets++=sourceIndex++;
-            --count;
-        }
+        int32_t count=(int32_t)(target-oldTarget);
+        simd::fillOffsets(offsets, count, sourceIndex);
+        offsets+=count;
     }
 
     /* write back the updated pointers */
@@ -645,40 +519,13 @@ ucnv_ASCIIFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
         targetCapacity=length;
     }
 
-    /* unroll the loop with the most common case */
+    /* copy whole blocks of ASCII at a time */
     if(targetCapacity>=16) {
-        int32_t count, loops;
-        uint8_t oredChars;
-
-        loops=count=targetCapacity>>4;
-        do {
-            oredChars=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-
-            /* were all 16 entries really valid? */
-            if(oredChars>0x7f) {
-                /* no, return to the first of these 16 */
-                source-=16;
-                target-=16;
-                break;
-            }
-        } while(--count>0);
-        count=loops-count;
-        targetCapacity-=16*count;
+        int32_t count=simd::spanASCII(source, targetCapacity);
+        uprv_memcpy(target, source, count);
+        source+=count;
+        target+=count;
+        targetCapacity-=count;
     }
 
     /* conversion loop */
@@ -59,8 +59,11 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "umutex.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 
+U_NAMESPACE_USE
+
 /* control optimizations according to the platform */
 #define MBCS_UNROLL_SINGLE_TO_BMP 1
 #define MBCS_UNROLL_SINGLE_FROM_BMP 0
@@ -406,6 +409,26 @@ static const char* U_CALLCONV
 ucnv_MBCSGetName(const UConverter *cnv);
 U_CDECL_END
 
+U_CFUNC UBool
+ucnv_MBCSIsSplitByte(const UConverterSharedData *sharedData, uint8_t b) {
+    const int32_t (*stateTable)[256]=sharedData->mbcs.stateTable;
+    int32_t entry=stateTable[0][b];
+    if(!( MBCS_ENTRY_IS_FINAL(entry) &&
+          MBCS_ENTRY_FINAL_ACTION(entry)==MBCS_STATE_VALID_DIRECT_16 &&
+          MBCS_ENTRY_FINAL_VALUE_16(entry)<0x20)
+    ) {
+        return false;
+    }
+    /* a trail byte in any other state would continue a multi-byte sequence */
+    for(int32_t state=1; state<sharedData->mbcs.countStates; ++state) {
+        entry=stateTable[state][b];
+        if(!(MBCS_ENTRY_IS_FINAL(entry) && MBCS_ENTRY_FINAL_ACTION(entry)==MBCS_STATE_ILLEGAL)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static void U_CALLCONV
 ucnv_MBCSWriteSub(UConverterFromUnicodeArgs *pArgs,
               int32_t offsetIndex,
@@ -431,6 +454,16 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode);
+
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,7 +486,7 @@ static const UConverterImpl _SBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_SBCSFromUTF8
 };
 
@@ -479,7 +512,7 @@ static const UConverterImpl _DBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_DBCSFromUTF8
 };
 
@@ -504,8 +537,8 @@ static const UConverterImpl _MBCSImpl={
     ucnv_MBCSWriteSub,
     NULL,
     ucnv_MBCSGetUnicodeSet,
-    NULL,
-    NULL
+    ucnv_MBCSToUTF8,
+    ucnv_MBCSFromUTF8
 };
 
 /* Static data is in tools/makeconv/ucnvstat.c for data-based
@@ -533,31 +566,141 @@ const UConverterSharedData _MBCSData={
  * GB four-byte sequences are contiguous and are handled algorithmically by
  * the special callback functions below.
  * The values are start & end of Unicode & GB codes.
+ * The ranges are sorted by code point, which also sorts them by GB code,
+ * so that they can be binary-searched either way.
+ * All supplementary code points are in the last range.
  *
  * Note that single surrogates are not mapped by GB 18030
  * as of the re-released mapping tables from 2000-nov-30.
  */
 static const uint32_t
 gb18030Ranges[14][4]={
-    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)},
-    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
     {0x0452, 0x1E3E, LINEAR(0x8130D330), LINEAR(0x8135F436)},
     {0x1E40, 0x200F, LINEAR(0x8135F438), LINEAR(0x8136A531)},
-    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
     {0x2643, 0x2E80, LINEAR(0x8137A839), LINEAR(0x8138FD38)},
-    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
-    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x361B, 0x3917, LINEAR(0x8230A633), LINEAR(0x8230F237)},
-    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x4160, 0x4336, LINEAR(0x8232C937), LINEAR(0x8232F837)},
-    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
     {0x44D7, 0x464B, LINEAR(0x8233A339), LINEAR(0x8233C931)},
-    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)}
+    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
+    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
+    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
+    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
+    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)},
+    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)}
 };
 
+/*
+ * @return the GB 18030 four-byte sequence for c (big-endian, first byte in bits 31..24)
+ *         if c is in one of the gb18030Ranges, otherwise 0
+ */
+static uint32_t
+gb18030FromUnicode(UChar32 c) {
+    const uint32_t *range;
+    uint32_t linear, b0, b1, b2, b3;
+
+    if(c>=0x10000) {
+        range=gb18030Ranges[UPRV_LENGTHOF(gb18030Ranges)-1];
+    } else {
+        /* binary search for the first BMP range that ends at or after c */
+        int32_t start=0, limit=UPRV_LENGTHOF(gb18030Ranges)-1;
+        while(start<limit) {
+            int32_t i=(start+limit)/2;
+            if((uint32_t)c>gb18030Ranges[i][1]) {
+                start=i+1;
+            } else {
+                limit=i;
+            }
+        }
+        range=gb18030Ranges[start];
+        if(start==UPRV_LENGTHOF(gb18030Ranges)-1 || (uint32_t)c<range[0]) {
+            return 0;
+        }
+    }
+
+    /* the linear value of the first GB 18030 code in this range, plus the offset of c */
+    linear=range[2]-LINEAR_18030_BASE+((uint32_t)c-range[0]);
+
+    /* turn this into a four-byte sequence */
+    b3=0x30+linear%10; linear/=10;
+    b2=0x81+linear%126; linear/=126;
+    b1=0x30+linear%10; linear/=10;
+    b0=0x81+linear;
+    return (b0<<24)|(b1<<16)|(b2<<8)|b3;
+}
+
+/*
+ * @return the code point for a GB 18030 four-byte sequence
+ *         if it is in one of the gb18030Ranges, otherwise U_SENTINEL
+ */
+static UChar32
+gb18030ToUnicode(const uint8_t bytes[4]) {
+    uint32_t linear=LINEAR_18030(bytes[0], bytes[1], bytes[2], bytes[3]);
+    const uint32_t *range;
+
+    /* binary search for the first range that ends at or after the sequence */
+    int32_t start=0, limit=UPRV_LENGTHOF(gb18030Ranges);
+    while(start<limit) {
+        int32_t i=(start+limit)/2;
+        if(linear>gb18030Ranges[i][3]) {
+            start=i+1;
+        } else {
+            limit=i;
+        }
+    }
+    if(start==UPRV_LENGTHOF(gb18030Ranges)) {
+        return U_SENTINEL;
+    }
+    range=gb18030Ranges[start];
+    if(linear<range[2]) {
+        return U_SENTINEL;
+    }
+    /* add the linear difference between the input and start sequences to the start code point */
+    return (UChar32)(range[0]+(linear-range[2]));
+}
+
 /* bit flag for UConverter.options indicating GB 18030 special handling */
 #define _MBCS_OPTION_GB18030 0x8000
 
+/*
+ * The conversion loops handle the GB 18030 ranges themselves rather than via
+ * _extFromU()/_extToU(), except where an extension mapping might take precedence.
+ *
+ * toUnicode: The four-byte range sequences are complete, so only
+ * an extension mapping with four or more input bytes could match one.
+ */
+#define IS_GB18030_INLINE_TO_U(cnv) \
+    (((cnv)->options&_MBCS_OPTION_GB18030)!=0 && \
+     ((cnv)->sharedData->mbcs.extIndexes==NULL || \
+      (((cnv)->sharedData->mbcs.extIndexes[UCNV_EXT_COUNT_BYTES]>>16)&0xff)<4))
+
+/*
+ * fromUnicode: true if this is a GB 18030 converter and
+ * no extension mapping starts with c.
+ */
+static inline UBool
+isGB18030InlineFromU(const UConverter *cnv, UChar32 c) {
+    const int32_t *cx;
+    const uint16_t *stage12, *stage3;
+    int32_t idx;
+
+    if((cnv->options&_MBCS_OPTION_GB18030)==0) {
+        return false;
+    }
+    if((cx=cnv->sharedData->mbcs.extIndexes)==NULL) {
+        return true;
+    }
+    idx=c>>10; /* stage 1 index */
+    if(idx>=cx[UCNV_EXT_FROM_U_STAGE_1_LENGTH]) {
+        return true;
+    }
+    stage12=UCNV_EXT_ARRAY(cx, UCNV_EXT_FROM_U_STAGE_12_INDEX, uint16_t);
+    stage3=UCNV_EXT_ARRAY(cx, UCNV_EXT_FROM_U_STAGE_3_INDEX, uint16_t);
+    return UCNV_EXT_ARRAY(cx, UCNV_EXT_FROM_U_STAGE_3B_INDEX, uint32_t)
+               [UCNV_EXT_FROM_U(stage12, stage3, idx, c)]==0;
+}
+
 /* bit flag for UConverter.options indicating KEIS,JEF,JIF special handling */
 #define _MBCS_OPTION_KEIS 0x01000
 #define _MBCS_OPTION_JEF  0x02000
@@ -1127,34 +1270,16 @@ _extFromU(UConverter *cnv, const UConverterSharedData *sharedData,
 
     /* GB 18030 */
     if((cnv->options&_MBCS_OPTION_GB18030)!=0) {
-        const uint32_t *range;
-        int32_t i;
-
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[0]<=(uint32_t)cp && (uint32_t)cp<=range[1]) {
-                /* found the Unicode code point, output the four-byte sequence for it */
-                uint32_t linear;
-                char bytes[4];
-
-                /* get the linear value of the first GB 18030 code in this range */
-                linear=range[2]-LINEAR_18030_BASE;
-
-                /* add the offset from the beginning of the range */
-                linear+=((uint32_t)cp-range[0]);
-
-                /* turn this into a four-byte sequence */
-                bytes[3]=(char)(0x30+linear%10); linear/=10;
-                bytes[2]=(char)(0x81+linear%126); linear/=126;
-                bytes[1]=(char)(0x30+linear%10); linear/=10;
-                bytes[0]=(char)(0x81+linear);
-
-                /* output this sequence */
-                ucnv_fromUWriteBytes(cnv,
-                                     bytes, 4, (char **)target, (char *)targetLimit,
-                                     offsets, sourceIndex, pErrorCode);
-                return 0;
-            }
+        uint32_t value=gb18030FromUnicode(cp);
+        if(value!=0) {
+            /* found the Unicode code point, output the four-byte sequence for it */
+            char bytes[4]={
+                (char)(value>>24), (char)(value>>16), (char)(value>>8), (char)value
+            };
+            ucnv_fromUWriteBytes(cnv,
+                                 bytes, 4, (char **)target, (char *)targetLimit,
+                                 offsets, sourceIndex, pErrorCode);
+            return 0;
         }
     }
 
@@ -1192,25 +1317,12 @@ _extToU(UConverter *cnv, const UConverterSharedData *sharedData,
 
     /* GB 18030 */
     if(length==4 && (cnv->options&_MBCS_OPTION_GB18030)!=0) {
-        const uint32_t *range;
-        uint32_t linear;
-        int32_t i;
-
-        linear=LINEAR_18030(cnv->toUBytes[0], cnv->toUBytes[1], cnv->toUBytes[2], cnv->toUBytes[3]);
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[2]<=linear && linear<=range[3]) {
-                /* found the sequence, output the Unicode code point for it */
-                *pErrorCode=U_ZERO_ERROR;
-
-                /* add the linear difference between the input and start sequences to the start code point */
-                linear=range[0]+(linear-range[2]);
-
-                /* output this code point */
-                ucnv_toUWriteCodePoint(cnv, linear, target, targetLimit, offsets, sourceIndex, pErrorCode);
-
-                return 0;
-            }
+        UChar32 c=gb18030ToUnicode(cnv->toUBytes);
+        if(c>=0) {
+            /* found the sequence, output the Unicode code point for it */
+            *pErrorCode=U_ZERO_ERROR;
+            ucnv_toUWriteCodePoint(cnv, c, target, targetLimit, offsets, sourceIndex, pErrorCode);
+            return 0;
         }
     }
 
@@ -2196,6 +2308,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t entry;
     uint8_t action;
+    UBool asciiBlocks;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -2207,8 +2320,11 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiBlocks=false;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
+        /* all of ASCII maps to itself: convert runs of ASCII bytes in blocks */
+        asciiBlocks=cnv->sharedData->mbcs.asciiRoundtrips==0xffffffff;
     }
 
     /* sourceIndex=-1 if the current character began in the previous buffer */
@@ -2228,8 +2344,22 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     /* unrolling makes it faster on Pentium III/Windows 2000 */
     /* unroll the loop with the most common case */
 unrolled:
+    if(asciiBlocks && targetCapacity>=16) {
+        int32_t count=simd::widenASCII(source, targetCapacity, target);
+        source+=count;
+        target+=count;
+        targetCapacity-=count;
+
+        if(offsets!=NULL) {
+            lastSource+=count;
+            simd::fillOffsets(offsets, count, sourceIndex);
+            offsets+=count;
+            sourceIndex+=count;
+        }
+    }
     if(targetCapacity>=16) {
         int32_t count, loops, oredEntries;
+        UBool isASCII=false;
 
         loops=count=targetCapacity>>4;
         do {
@@ -2273,31 +2403,24 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
                 target-=16;
                 break;
             }
+            /* were all 16 results ASCII? then try the block conversion again */
+            if(asciiBlocks && (oredEntries&0xff80)==0) {
+                isASCII=true;
+                --count;
+                break;
+            }
         } while(--count>0);
         count=loops-count;
         targetCapacity-=16*count;
 
         if(offsets!=NULL) {
             lastSource+=16*count;
-            while(count>0) {
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                --count;
-            }
+            simd::fillOffsets(offsets, 16*count, sourceIndex);
+            offsets+=16*count;
+            sourceIndex+=16*count;
+        }
+        if(isASCII) {
+            goto unrolled;
         }
     }
 #endif
@@ -2389,11 +2512,9 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     /* set offsets since the start or the last callback */
     if(offsets!=NULL) {
-        size_t count=source-lastSource;
-        while(count>0) {
-            *offsets++=sourceIndex++;
-            --count;
-        }
+        int32_t count=(int32_t)(source-lastSource);
+        simd::fillOffsets(offsets, count, sourceIndex);
+        offsets+=count;
     }
 
     /* write back the updated pointers */
@@ -2800,7 +2921,38 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                 byteIndex=0;
             }
         } else if(action==MBCS_STATE_UNASSIGNED) {
-            /* just fall through */
+            if(byteIndex==4 && IS_GB18030_INLINE_TO_U(cnv) && (entry=gb18030ToUnicode(bytes))>=0) {
+                /* GB 18030 four-byte range */
+                if(entry<=0xffff) {
+                    *target++=(UChar)entry;
+                    if(offsets!=NULL) {
+                        *offsets++=sourceIndex;
+                    }
+                    byteIndex=0;
+                } else {
+                    /* output surrogate pair */
+                    *target++=U16_LEAD(entry);
+                    if(offsets!=NULL) {
+                        *offsets++=sourceIndex;
+                    }
+                    byteIndex=0;
+                    c=U16_TRAIL(entry);
+                    if(target<targetLimit) {
+                        *target++=c;
+                        if(offsets!=NULL) {
+                            *offsets++=sourceIndex;
+                        }
+                    } else {
+                        /* target overflow */
+                        cnv->UCharErrorBuffer[0]=c;
+                        cnv->UCharErrorBufferLength=1;
+                        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+
+                        offset=0;
+                        break;
+                    }
+                }
+            }
         } else if(action==MBCS_STATE_ILLEGAL) {
             /* callback(illegal) */
             *pErrorCode=U_ILLEGAL_CHAR_FOUND;
@@ -2956,8 +3108,8 @@ ucnv_MBCSSingleGetNextUChar(UConverterToUnicodeArgs *pArgs,
  * conversion without offset handling.
  *
  * When a character does not have a mapping to Unicode, then we return to the
- * generic ucnv_getNextUChar() code for extension/GB 18030 and error/callback
- * handling.
+ * generic ucnv_getNextUChar() code for extension and error/callback handling,
+ * and for GB 18030 only if an extension mapping might match.
  * We also defer to the generic code in other complicated cases and have them
  * ultimately handled by _MBCSToUnicodeWithOffsets() itself.
  *
@@ -3116,7 +3268,12 @@ ucnv_MBCSGetNextUChar(UConverterToUnicodeArgs *pArgs,
                     break;
                 }
             } else if(action==MBCS_STATE_UNASSIGNED) {
-                /* just fall through */
+                if( (source-lastSource)==4 && IS_GB18030_INLINE_TO_U(cnv) &&
+                    (c=gb18030ToUnicode(lastSource))>=0
+                ) {
+                    /* GB 18030 four-byte range */
+                    break;
+                }
             } else if(action==MBCS_STATE_ILLEGAL) {
                 /* callback(illegal) */
                 *pErrorCode=U_ILLEGAL_CHAR_FOUND;
@@ -3828,6 +3985,8 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     uint32_t asciiRoundtrips;
     uint16_t value, minValue;
+    UBool asciiBlocks;
+    int32_t checkInterval, untilCheck;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -3844,6 +4003,14 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    /*
+     * If all of ASCII round-trips, then runs of ASCII are converted in blocks.
+     * The interval of ASCII characters between block attempts grows
+     * while they fail, so that mostly non-ASCII text does not pay for them.
+     */
+    asciiBlocks=asciiRoundtrips==0xffffffff;
+    checkInterval=16;
+    untilCheck=1;
 
     if(cnv->useFallback) {
         /* use all roundtrip and fallback results */
@@ -3940,6 +4107,18 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             *target++=(uint8_t)c;
             --targetCapacity;
             c=0;
+            if(asciiBlocks && --untilCheck==0) {
+                int32_t count=simd::narrowASCII(source, targetCapacity, target);
+                source+=count;
+                target+=count;
+                targetCapacity-=count;
+                if(count>0) {
+                    checkInterval=16;
+                } else if(checkInterval<1024) {
+                    checkInterval<<=1;
+                }
+                untilCheck=checkInterval;
+            }
             continue;
         }
         value=MBCS_SINGLE_RESULT_FROM_U(table, results, c);
@@ -4052,10 +4231,8 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             */
             count--;
         }
-        while(count>0) {
-            *offsets++=sourceIndex++;
-            --count;
-        }
+        simd::fillOffsets(offsets, (int32_t)count, sourceIndex);
+        offsets+=count;
     }
 
     /* set the converter state back into UConverter */
@@ -4607,6 +4784,12 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                      */
 
 unassigned:
+                    if(isGB18030InlineFromU(cnv, c) && (value=gb18030FromUnicode(c))!=0) {
+                        /* GB 18030 four-byte range */
+                        length=4;
+                        goto writeBytes;
+                    }
+
                     /* try an extension mapping */
                     pArgs->source=source;
                     c=_extFromU(cnv, cnv->sharedData,
@@ -4637,6 +4820,7 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
             }
 
+writeBytes:
             /* write the output character bytes from value and length */
             /* from the first if in the loop we know that targetCapacity>0 */
             if(length<=targetCapacity) {
@@ -5622,6 +5806,668 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/*
+ * Look up the codepage bytes for a code point in the stage 2/3 fromUnicode table,
+ * for all output types. Same as in ucnv_MBCSFromUnicodeWithOffsets()
+ * but without the SI/SO state handling, which the caller adds.
+ * @return the number of bytes in *pValue (1..4), or 0 if c is unassigned
+ */
+static inline int32_t
+mbcsFromUCodePoint(const UConverterMBCSTable *mbcs, const uint8_t *bytes,
+                   UChar32 c, UBool useFallback, uint32_t *pValue) {
+    const uint16_t *table=mbcs->fromUnicodeTable;
+    const uint8_t *p;
+    uint32_t stage2Entry;
+    uint32_t value;
+    int32_t length;
+
+    if(c>0xffff && !(mbcs->unicodeMask&UCNV_HAS_SUPPLEMENTARY)) {
+        /* BMP-only codepages are stored without stage 1 entries for supplementary code points */
+        return 0;
+    }
+    if(mbcs->outputType==MBCS_OUTPUT_1) {
+        value=MBCS_SINGLE_RESULT_FROM_U(table, (const uint16_t *)bytes, c);
+        /* is this code point assigned, or do we use fallbacks? */
+        if(useFallback ? value>=0x800 : value>=0xc00) {
+            *pValue=value&0xff;
+            return 1;
+        }
+        return 0;
+    }
+
+    stage2Entry=MBCS_STAGE_2_FROM_U(table, c);
+    switch(mbcs->outputType) {
+    case MBCS_OUTPUT_2:
+    case MBCS_OUTPUT_2_SISO:
+        value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+        length= value<=0xff ? 1 : 2;
+        break;
+    case MBCS_OUTPUT_DBCS_ONLY:
+        /* table with single-byte results, but only DBCS mappings used */
+        value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+        if(value<=0xff) {
+            /* no mapping or SBCS result, not taken for DBCS-only */
+            return 0;
+        }
+        length=2;
+        break;
+    case MBCS_OUTPUT_3:
+        p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+        value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else {
+            length=3;
+        }
+        break;
+    case MBCS_OUTPUT_4:
+        value=MBCS_VALUE_4_FROM_STAGE_2(bytes, stage2Entry, c);
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else if(value<=0xffffff) {
+            length=3;
+        } else {
+            length=4;
+        }
+        break;
+    case MBCS_OUTPUT_3_EUC:
+        value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+        /* EUC 16-bit fixed-length representation */
+        if(value<=0xff) {
+            length=1;
+        } else if((value&0x8000)==0) {
+            value|=0x8e8000;
+            length=3;
+        } else if((value&0x80)==0) {
+            value|=0x8f0080;
+            length=3;
+        } else {
+            length=2;
+        }
+        break;
+    case MBCS_OUTPUT_4_EUC:
+        p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+        value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+        /* EUC 16-bit fixed-length representation applied to the first two bytes */
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else if((value&0x800000)==0) {
+            value|=0x8e800000;
+            length=4;
+        } else if((value&0x8000)==0) {
+            value|=0x8f008000;
+            length=4;
+        } else {
+            length=3;
+        }
+        break;
+    default:
+        /* must not occur */
+        return 0;
+    }
+
+    /* is this code point assigned, or do we use fallbacks? */
+    if( MBCS_FROM_U_IS_ROUNDTRIP(stage2Entry, c) ||
+        (FROM_U_USE_FALLBACK(useFallback, c) && value!=0)
+    ) {
+        /*
+         * We allow a 0 byte output if the "assigned" bit is set for this entry.
+         * There is no way with this data structure for fallback output
+         * to be a zero byte.
+         */
+        *pValue=value;
+        return length;
+    }
+    return 0;
+}
+
+/*
+ * UTF-8 to any MBCS table, including multi-byte and stateful ones
+ * which do not have the utf8Friendly data for
+ * ucnv_SBCSFromUTF8() and ucnv_DBCSFromUTF8().
+ *
+ * This handles well-formed UTF-8 and main-table and extension mappings.
+ * For anything else, it stops before the current character and
+ * sets U_USING_DEFAULT_WARNING so that ucnv_convertEx() temporarily
+ * reverts to pivoting through UTF-16:
+ * Ill-formed and truncated UTF-8, partial characters from the previous buffer,
+ * partial extension matches, a partial character at the end of the target,
+ * and the final SI of EBCDIC_STATEFUL output.
+ */
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+
+    const UConverterMBCSTable *mbcs;
+    const uint8_t *bytes;
+    uint8_t outputType;
+
+    UChar32 c;
+    uint32_t value=0;
+    int32_t length, prevLength;
+
+    uint32_t asciiRoundtrips;
+    UBool asciiBlocks;
+    int32_t checkInterval, untilCheck;
+
+    /* Shift-In and Shift-Out byte sequences differ by encoding scheme. */
+    uint8_t siBytes[2] = {0, 0};
+    uint8_t soBytes[2] = {0, 0};
+    uint8_t siLength, soLength;
+
+    /* set up the local pointers */
+    utf8=pToUArgs->converter;
+    cnv=pFromUArgs->converter;
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    if(utf8->toULength>0 || cnv->fromUChar32!=0) {
+        /* let the standard converters finish the partial character */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    mbcs=&cnv->sharedData->mbcs;
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        bytes=mbcs->swapLFNLFromUnicodeBytes;
+    } else {
+        bytes=mbcs->fromUnicodeBytes;
+    }
+    outputType=mbcs->outputType;
+    asciiRoundtrips=mbcs->asciiRoundtrips;
+    asciiBlocks=asciiRoundtrips==0xffffffff;
+    checkInterval=16;
+    untilCheck=1;
+
+    if(outputType==MBCS_OUTPUT_2_SISO) {
+        prevLength=cnv->fromUnicodeStatus;
+        if(prevLength==0) {
+            /* set the real value */
+            prevLength=1;
+        }
+    } else {
+        /* prevent fromUnicodeStatus from being set to something non-0 */
+        prevLength=0;
+    }
+
+    /* Get the SI/SO character for the converter */
+    siLength = static_cast<uint8_t>(getSISOBytes(SI, cnv->options, siBytes));
+    soLength = static_cast<uint8_t>(getSISOBytes(SO, cnv->options, soBytes));
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        c=*source;
+        if(U8_IS_SINGLE(c) && IS_ASCII_ROUNDTRIP(c, asciiRoundtrips)) {
+            /* convert ASCII, and runs of ASCII in blocks if all of ASCII round-trips */
+            ++source;
+            *target++=(uint8_t)c;
+            if(asciiBlocks && --untilCheck==0) {
+                int32_t count=(int32_t)(sourceLimit-source);
+                if(count>(targetLimit-target)) {
+                    count=(int32_t)(targetLimit-target);
+                }
+                count=simd::spanASCII(source, count);
+                uprv_memcpy(target, source, count);
+                source+=count;
+                target+=count;
+                if(count>0) {
+                    checkInterval=16;
+                } else if(checkInterval<1024) {
+                    checkInterval<<=1;
+                }
+                untilCheck=checkInterval;
+            }
+            continue;
+        }
+
+        /* read a complete, well-formed UTF-8 character */
+        {
+            int32_t i=0, sourceLength=(int32_t)(sourceLimit-source);
+            U8_NEXT(source, i, sourceLength, c);
+            if(c<0 || (c>0xffff && (mbcs->unicodeMask&UCNV_HAS_SURROGATES))) {
+                /*
+                 * Ill-formed or truncated UTF-8, or a table that maps surrogate code units
+                 * separately: let the standard converters handle this character.
+                 */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            source+=i;
+        }
+
+        length=mbcsFromUCodePoint(mbcs, bytes, c, cnv->useFallback, &value);
+        if(outputType==MBCS_OUTPUT_2_SISO) {
+            /*
+             * Save the old state in the converter object for the extension mapping
+             * or a callback, see ucnv_MBCSFromUnicodeWithOffsets().
+             */
+            cnv->fromUnicodeStatus=prevLength;
+            if(length==1) {
+                if(prevLength>1) {
+                    /* change from double-byte mode to single-byte */
+                    if (siLength == 1) {
+                        value|=(uint32_t)siBytes[0]<<8;
+                        length = 2;
+                    } else if (siLength == 2) {
+                        value|=(uint32_t)siBytes[1]<<8;
+                        value|=(uint32_t)siBytes[0]<<16;
+                        length = 3;
+                    }
+                    prevLength=1;
+                }
+            } else if(length==2) {
+                if(prevLength!=2) {
+                    /* change from single-byte mode to double-byte */
+                    if (soLength == 1) {
+                        value|=(uint32_t)soBytes[0]<<16;
+                        length = 3;
+                    } else if (soLength == 2) {
+                        value|=(uint32_t)soBytes[1]<<16;
+                        value|=(uint32_t)soBytes[0]<<24;
+                        length = 4;
+                    }
+                    prevLength=2;
+                }
+            }
+        }
+
+        if(length==0 && isGB18030InlineFromU(cnv, c) && (value=gb18030FromUnicode(c))!=0) {
+            /* GB 18030 four-byte range */
+            length=4;
+        }
+        if(length==0) {
+            /*
+             * Try an extension mapping.
+             * Pass in no source because we don't have UTF-16 input.
+             * If we have a partial match on c, we will return and revert
+             * to UTF-8->UTF-16->charset conversion.
+             */
+            static const UChar nul=0;
+            const UChar *noSource=&nul;
+            c=_extFromU(cnv, cnv->sharedData,
+                        c, &noSource, noSource,
+                        &target, targetLimit,
+                        NULL, -1,
+                        pFromUArgs->flush,
+                        pErrorCode);
+            prevLength=cnv->fromUnicodeStatus; /* restore SISO state */
+
+            if(U_FAILURE(*pErrorCode)) {
+                /* not mappable or buffer overflow */
+                cnv->fromUChar32=c;
+                break;
+            } else if(cnv->preFromUFirstCP>=0) {
+                /* partial match, return and revert to pivoting */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            /* a mapping was written to the target, continue */
+            continue;
+        }
+
+        /* write the output character bytes from value and length */
+        if(length<=(targetLimit-target)) {
+            switch(length) {
+                /* each branch falls through to the next one */
+            case 4:
+                *target++=(uint8_t)(value>>24);
+                U_FALLTHROUGH;
+            case 3:
+                *target++=(uint8_t)(value>>16);
+                U_FALLTHROUGH;
+            case 2:
+                *target++=(uint8_t)(value>>8);
+                U_FALLTHROUGH;
+            case 1:
+                *target++=(uint8_t)value;
+                U_FALLTHROUGH;
+            default:
+                /* will never occur */
+                break;
+            }
+        } else {
+            /* the character does not fit: back out and let the standard converter handle it */
+            source-=U8_LENGTH(c);
+            if(outputType==MBCS_OUTPUT_2_SISO) {
+                prevLength=cnv->fromUnicodeStatus;
+            }
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+    }
+
+    if( U_SUCCESS(*pErrorCode) && *pErrorCode!=U_USING_DEFAULT_WARNING &&
+        outputType==MBCS_OUTPUT_2_SISO && prevLength==2 &&
+        pToUArgs->flush && source>=sourceLimit
+    ) {
+        /* EBCDIC_STATEFUL ending with DBCS: the standard converter emits the SI */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->fromUnicodeStatus=prevLength;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
+/* MBCS-to-UTF-8 conversion functions --------------------------------------- */
+
+/*
+ * Any MBCS table to UTF-8, walking the state table like
+ * ucnv_MBCSToUnicodeWithOffsets() but writing UTF-8 directly.
+ *
+ * This handles the main-table and extension mappings, and SI/SO state changes.
+ * For anything else, it stops before the current character and
+ * sets U_USING_DEFAULT_WARNING so that ucnv_convertEx() temporarily
+ * reverts to pivoting through UTF-16:
+ * Illegal, unmappable and truncated byte sequences, partial characters
+ * and extension matches from the previous buffer,
+ * and a partial character at the end of the target.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+
+    const int32_t (*stateTable)[256];
+    const uint16_t *unicodeCodeUnits;
+
+    uint32_t offset;
+    uint8_t state, s, action;
+    UBool asciiBlocks;
+    int32_t checkInterval, untilCheck;
+
+    int32_t entry;
+    UChar32 c;
+
+    /* set up the local pointers */
+    cnv=pToUArgs->converter;
+    utf8=pFromUArgs->converter;
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    if(cnv->toULength>0 || utf8->fromUChar32!=0) {
+        /* let the standard converters finish the partial character */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiBlocks=false;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+        /* all of ASCII maps to itself in state 0: copy runs of ASCII bytes in blocks */
+        asciiBlocks=cnv->sharedData->mbcs.asciiRoundtrips==0xffffffff;
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+    checkInterval=16;
+    untilCheck=1;
+
+    /*
+     * if we are in the SBCS state for a DBCS-only converter,
+     * then load the DBCS state from the MBCS data
+     * (dbcsOnlyState==0 if it is not a DBCS-only converter)
+     */
+    if((state=(uint8_t)(cnv->mode))==0) {
+        state=cnv->sharedData->mbcs.dbcsOnlyState;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        const uint8_t *p;
+
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        /*
+         * optimized loop for 1/2-byte input and BMP output,
+         * while there is room for the longest such UTF-8 sequence
+         */
+        while((targetLimit-target)>=3) {
+            entry=stateTable[state][*source];
+            if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+                if( (source+1)<sourceLimit &&
+                    MBCS_ENTRY_IS_FINAL(entry=stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][source[1]]) &&
+                    MBCS_ENTRY_FINAL_ACTION(entry)==MBCS_STATE_VALID_16 &&
+                    (c=unicodeCodeUnits[
+                        MBCS_ENTRY_TRANSITION_OFFSET(stateTable[state][*source])+
+                        MBCS_ENTRY_FINAL_VALUE_16(entry)])<0xfffe &&
+                    !U_IS_SURROGATE(c)
+                ) {
+                    source+=2;
+                } else {
+                    break;
+                }
+            } else if(MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry)) {
+                ++source;
+                c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+                if(c<=0x7f) {
+                    *target++=(uint8_t)c;
+                    if(asciiBlocks && state==0 && --untilCheck==0) {
+                        /* copy a run of ASCII bytes in blocks */
+                        int32_t count=(int32_t)(sourceLimit-source);
+                        if(count>(targetLimit-target)) {
+                            count=(int32_t)(targetLimit-target);
+                        }
+                        count=simd::spanASCII(source, count);
+                        uprv_memcpy(target, source, count);
+                        source+=count;
+                        target+=count;
+                        if(count>0) {
+                            checkInterval=16;
+                        } else if(checkInterval<1024) {
+                            checkInterval<<=1;
+                        }
+                        untilCheck=checkInterval;
+                    }
+                    state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+                    if(source>=sourceLimit) {
+                        break;
+                    }
+                    continue;
+                } else if(U_IS_SURROGATE(c)) {
+                    --source;
+                    break;
+                }
+            } else {
+                break;
+            }
+            if(c<=0x7ff) {
+                target[0]=(uint8_t)((c>>6)|0xc0);
+                target[1]=(uint8_t)((c&0x3f)|0x80);
+                target+=2;
+            } else {
+                target[0]=(uint8_t)((c>>12)|0xe0);
+                target[1]=(uint8_t)(((c>>6)&0x3f)|0x80);
+                target[2]=(uint8_t)((c&0x3f)|0x80);
+                target+=3;
+            }
+            state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+            if(source>=sourceLimit) {
+                break;
+            }
+        }
+        if(source>=sourceLimit) {
+            break;
+        }
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        /* read one complete character */
+        p=source;
+        s=state;
+        offset=0;
+        entry=stateTable[s][*p++];
+        while(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            if(p==sourceLimit) {
+                break;
+            }
+            s=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+            offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            entry=stateTable[s][*p++];
+        }
+        if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            /* truncated character: let the standard converter collect it */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+
+        /*
+         * An if-else-if chain provides more reliable performance for
+         * the most common cases compared to a switch.
+         */
+        action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+        if(action==MBCS_STATE_VALID_DIRECT_16 || action==MBCS_STATE_FALLBACK_DIRECT_16) {
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+        } else if(action==MBCS_STATE_VALID_16) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset];
+            if(c==0xfffe) {
+                /* fallback, or else try an extension mapping below */
+                c=ucnv_MBCSGetFallback(&cnv->sharedData->mbcs, offset);
+                if(c==0xfffe) {
+                    c=U_SENTINEL;
+                }
+            } else if(c==0xffff) {
+                /* illegal */
+                c=-2;
+            }
+        } else if(action==MBCS_STATE_VALID_16_PAIR) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset++];
+            if(c<0xd800) {
+                /* BMP code point below 0xd800 */
+            } else if(c<=0xdfff) {
+                /* roundtrip or fallback supplementary code point */
+                c=(UChar32)(((c&0x3ff)<<10)+unicodeCodeUnits[offset]+(0x10000-0xdc00));
+            } else if((c&0xfffe)==0xe000) {
+                /* roundtrip BMP code point above 0xd800 or fallback BMP code point */
+                c=unicodeCodeUnits[offset];
+            } else if(c==0xffff) {
+                /* illegal */
+                c=-2;
+            } else {
+                c=U_SENTINEL;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_20 || action==MBCS_STATE_FALLBACK_DIRECT_20) {
+            c=0x10000+MBCS_ENTRY_FINAL_VALUE(entry);
+        } else if(action==MBCS_STATE_CHANGE_ONLY && cnv->sharedData->mbcs.dbcsOnlyState==0) {
+            /* state change without any output */
+            source=p;
+            state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry);
+            continue;
+        } else if(action==MBCS_STATE_UNASSIGNED) {
+            if((p-source)==4 && IS_GB18030_INLINE_TO_U(cnv)) {
+                /* GB 18030 four-byte range, or else U_SENTINEL */
+                c=gb18030ToUnicode(source);
+            } else {
+                c=U_SENTINEL;
+            }
+        } else {
+            /* illegal, or reserved which the standard converter skips */
+            c=-2;
+        }
+
+        if(c==U_SENTINEL && (targetLimit-target)>=3*32) {
+            /*
+             * Try an extension mapping, with UTF-16 output into a local buffer
+             * (32 is large enough for UCNV_EXT_MAX_UCHARS and a surrogate pair)
+             * and from there to UTF-8 into the target, which has room for all of it.
+             */
+            UChar buffer[32];
+            UChar *t16=buffer;
+            int8_t length=(int8_t)(p-source);
+
+            uprv_memcpy(cnv->toUBytes, source, length);
+            /* save the previous state for proper extension mapping with SI/SO-stateful converters */
+            cnv->mode=s;
+            _extToU(cnv, cnv->sharedData,
+                    length, &p, sourceLimit,
+                    &t16, buffer+UPRV_LENGTHOF(buffer),
+                    NULL, -1,
+                    pToUArgs->flush,
+                    pErrorCode);
+            if(U_SUCCESS(*pErrorCode)) {
+                int32_t i=0, j=0;
+                while(i<(t16-buffer)) {
+                    U16_NEXT(buffer, i, t16-buffer, c);
+                    U8_APPEND_UNSAFE(target, j, c);
+                }
+                target+=j;
+                source=p;
+                state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry);
+                if(cnv->preToULength>0) {
+                    /* partial match at the end of the input, return and revert to pivoting */
+                    *pErrorCode=U_USING_DEFAULT_WARNING;
+                    break;
+                }
+                continue;
+            }
+            /* no mapping: let the standard converter call the callback */
+            *pErrorCode=U_ZERO_ERROR;
+        }
+
+        if(c<0 || U_IS_SURROGATE(c)) {
+            /* let the standard converter handle this character */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        } else if(c<=0x7f) {
+            *target++=(uint8_t)c;
+        } else if(U8_LENGTH(c)<=(targetLimit-target)) {
+            int32_t j=0;
+            U8_APPEND_UNSAFE(target, j, c);
+            target+=j;
+        } else {
+            /* the character does not fit: let the standard converter handle it */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        source=p;
+        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->mode=state;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
@@ -522,6 +522,16 @@ ucnv_MBCSSingleSimpleGetNextUChar(UConverterSharedData *sharedData,
 U_CFUNC UBool
 ucnv_MBCSIsLeadByte(UConverterSharedData *sharedData, char byte);
 
+/**
+ * This is an internal function that checks whether a byte stream can be
+ * split after the byte and converted in independent pieces:
+ * The byte must be a single-byte C0 control character (mapped to U+0000..U+001F)
+ * that is illegal as a trail byte in every other state.
+ * Not for EBCDIC_STATEFUL converters.
+ */
+U_CFUNC UBool
+ucnv_MBCSIsSplitByte(const UConverterSharedData *sharedData, uint8_t b);
+
 /** This is a macro version of _MBCSIsLeadByte(). */
 #define _MBCS_IS_LEAD_BYTE(sharedData, byte) \
     (UBool)MBCS_ENTRY_IS_TRANSITION((sharedData)->mbcs.stateTable[0][(uint8_t)(byte)])
@@ -0,0 +1,286 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  ucnvpool.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Pool of reusable converters, see unicode/ucnvpool.h.
+*
+*   Idle converters are kept in shards, and a thread always uses the shard
+*   that its thread ID hashes to. Each shard index has its own mutex,
+*   which the shards with that index in all pools share.
+*   In a shard, idle converters are grouped by their shared data and options
+*   into a fixed number of slots with fixed-size free lists,
+*   so that acquiring and releasing converters does not allocate memory.
+*   A slot holds a reference on its shared data, so that its address cannot
+*   be reused by other shared data while the slot exists.
+******************************************************************************
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include <thread>
+
+#include "unicode/ucnv.h"
+#include "unicode/ucnvpool.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "mutex.h"
+#include "ucnv_bld.h"
+#include "ucnv_imp.h"
+#include "umutex.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+// Power of 2.
+constexpr int32_t SHARD_COUNT = 16;
+// Number of converter kinds per shard. Slots are never removed:
+// Once a shard has seen this many kinds, further kinds acquired or released
+// on its threads are opened and closed as if there were no pool.
+constexpr int32_t SLOTS_PER_SHARD = 8;
+// Number of name spellings per converter kind.
+constexpr int32_t NAMES_PER_SLOT = 4;
+// Number of idle converters per converter kind and shard.
+constexpr int32_t IDLE_PER_SLOT = 8;
+
+/**
+ * Idle converters of one kind: the same shared data and options,
+ * with a reference on the shared data for the lifetime of the slot,
+ * and the substitution settings of a newly opened converter,
+ * so that converters with changed settings are not reused.
+ */
+struct PoolSlot {
+    UConverterSharedData *sharedData;
+    uint32_t options;
+    int32_t nameCount;
+    char names[NAMES_PER_SLOT][UCNV_MAX_CONVERTER_NAME_LENGTH];
+    int8_t subCharLen;
+    uint8_t subChar1;
+    UChar subUChars[UCNV_MAX_SUBCHAR_LEN/U_SIZEOF_UCHAR];
+    int32_t idleCount;
+    UConverter *idle[IDLE_PER_SLOT];
+};
+
+// UMutex instances must be static.
+// The critical sections are short, so pools can share them.
+UMutex gShardMutexes[SHARD_COUNT];
+
+struct PoolShard : public UMemory {
+    UMutex *mutex = nullptr;
+    int32_t slotCount = 0;
+    PoolSlot slots[SLOTS_PER_SHARD];
+};
+
+PoolShard &shardForThisThread(PoolShard *shards) {
+    std::thread::id id = std::this_thread::get_id();
+    size_t hash = 0;
+    uprv_memcpy(&hash, &id, sizeof(id) < sizeof(hash) ? sizeof(id) : sizeof(hash));
+    // Thread IDs may be aligned addresses: fold in the higher bits.
+    hash ^= hash >> 16;
+    return shards[(hash ^ (hash >> 8)) & (SHARD_COUNT - 1)];
+}
+
+PoolSlot *findSlot(PoolShard &shard, const UConverter *cnv) {
+    for (int32_t i = 0; i < shard.slotCount; ++i) {
+        PoolSlot &slot = shard.slots[i];
+        if (slot.sharedData == cnv->sharedData && slot.options == cnv->options) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void addName(PoolSlot &slot, const char *name) {
+    for (int32_t i = 0; i < slot.nameCount; ++i) {
+        if (uprv_strcmp(slot.names[i], name) == 0) {
+            return;
+        }
+    }
+    if (slot.nameCount < NAMES_PER_SLOT && uprv_strlen(name) < UCNV_MAX_CONVERTER_NAME_LENGTH) {
+        uprv_strcpy(slot.names[slot.nameCount++], name);
+    }
+}
+
+/**
+ * Adds a slot for the kind of cnv, with cnv's substitution settings
+ * which must be those of a newly opened converter.
+ * @return the new slot, or nullptr if the shard is full
+ */
+PoolSlot *addSlot(PoolShard &shard, const UConverter *cnv) {
+    if (shard.slotCount == SLOTS_PER_SHARD) {
+        return nullptr;
+    }
+    PoolSlot &slot = shard.slots[shard.slotCount++];
+    ucnv_incrementRefCount(cnv->sharedData);
+    slot.sharedData = cnv->sharedData;
+    slot.options = cnv->options;
+    slot.nameCount = 0;
+    slot.subCharLen = cnv->subCharLen;
+    slot.subChar1 = cnv->subChar1;
+    uprv_memcpy(slot.subUChars, cnv->subUChars, sizeof(slot.subUChars));
+    slot.idleCount = 0;
+    return &slot;
+}
+
+UBool hasDefaultSubstitution(const PoolSlot &slot, const UConverter *cnv) {
+    return
+        cnv->subChars == (const uint8_t *)cnv->subUChars &&
+        cnv->subCharLen == slot.subCharLen &&
+        cnv->subChar1 == slot.subChar1 &&
+        uprv_memcmp(cnv->subUChars, slot.subUChars, sizeof(slot.subUChars)) == 0;
+}
+
+}  // namespace
+
+struct UConverterPool : public UMemory {
+    UConverterPool() {
+        for (int32_t i = 0; i < SHARD_COUNT; ++i) {
+            shards[i].mutex = &gShardMutexes[i];
+        }
+    }
+    PoolShard shards[SHARD_COUNT];
+};
+
+U_CAPI UConverterPool* U_EXPORT2
+ucnvpool_open(UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return nullptr;
+    }
+    UConverterPool *pool = new UConverterPool();
+    if (pool == nullptr) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return pool;
+}
+
+U_CAPI void U_EXPORT2
+ucnvpool_close(UConverterPool *pool) {
+    if (pool == nullptr) {
+        return;
+    }
+    for (PoolShard &shard : pool->shards) {
+        for (int32_t i = 0; i < shard.slotCount; ++i) {
+            PoolSlot &slot = shard.slots[i];
+            for (int32_t j = 0; j < slot.idleCount; ++j) {
+                ucnv_close(slot.idle[j]);
+            }
+            ucnv_unloadSharedDataIfReady(slot.sharedData);
+        }
+    }
+    delete pool;
+}
+
+U_CAPI UConverter* U_EXPORT2
+ucnvpool_acquire(UConverterPool *pool, const char *converterName, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return nullptr;
+    }
+    if (pool == nullptr) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    if (converterName == nullptr) {
+        // Like ucnv_open(NULL). Idle converters are found by name,
+        // so a later change of the default converter is honored.
+        converterName = ucnv_getDefaultName();
+    }
+    PoolShard &shard = shardForThisThread(pool->shards);
+    {
+        Mutex lock(shard.mutex);
+        for (int32_t i = 0; i < shard.slotCount; ++i) {
+            PoolSlot &slot = shard.slots[i];
+            if (slot.idleCount == 0) {
+                continue;
+            }
+            for (int32_t j = 0; j < slot.nameCount; ++j) {
+                if (uprv_strcmp(slot.names[j], converterName) == 0) {
+                    return slot.idle[--slot.idleCount];
+                }
+            }
+        }
+    }
+
+    // No idle converter: open a new one, and remember its name and
+    // initial settings for when it is released.
+    UConverter *cnv = ucnv_open(converterName, status);
+    if (U_FAILURE(*status)) {
+        return nullptr;
+    }
+    Mutex lock(shard.mutex);
+    PoolSlot *slot = findSlot(shard, cnv);
+    if (slot == nullptr) {
+        slot = addSlot(shard, cnv);
+    }
+    if (slot != nullptr) {
+        addName(*slot, converterName);
+    }
+    return cnv;
+}
+
+U_CAPI void U_EXPORT2
+ucnvpool_release(UConverterPool *pool, UConverter *cnv) {
+    if (pool == nullptr || cnv == nullptr) {
+        return;
+    }
+    // Same state as after ucnv_open().
+    ucnv_reset(cnv);
+    cnv->fromCharErrorBehaviour = UCNV_TO_U_DEFAULT_CALLBACK;
+    cnv->toUContext = nullptr;
+    cnv->fromUCharErrorBehaviour = UCNV_FROM_U_DEFAULT_CALLBACK;
+    cnv->fromUContext = nullptr;
+    cnv->useFallback = false;
+
+    PoolShard &shard = shardForThisThread(pool->shards);
+    UBool hasSlot;
+    {
+        Mutex lock(shard.mutex);
+        PoolSlot *slot = findSlot(shard, cnv);
+        hasSlot = slot != nullptr;
+        if (hasSlot && slot->idleCount < IDLE_PER_SLOT && hasDefaultSubstitution(*slot, cnv)) {
+            slot->idle[slot->idleCount++] = cnv;
+            return;
+        }
+    }
+
+    // No slot in this shard: The converter was acquired on a thread that uses
+    // a different shard. Copy that shard's slot so that this thread can reuse it.
+    PoolSlot other;
+    UBool found = false;
+    for (int32_t i = 0; !hasSlot && !found && i < SHARD_COUNT; ++i) {
+        PoolShard &otherShard = pool->shards[i];
+        if (&otherShard != &shard) {
+            Mutex lock(otherShard.mutex);
+            const PoolSlot *otherSlot = findSlot(otherShard, cnv);
+            if (otherSlot != nullptr) {
+                uprv_memcpy(&other, otherSlot, sizeof(other));
+                found = true;
+            }
+        }
+    }
+    if (found && hasDefaultSubstitution(other, cnv)) {
+        Mutex lock(shard.mutex);
+        PoolSlot *slot = findSlot(shard, cnv);
+        if (slot == nullptr && shard.slotCount < SLOTS_PER_SHARD) {
+            slot = &shard.slots[shard.slotCount++];
+            uprv_memcpy(slot, &other, sizeof(other));
+            ucnv_incrementRefCount(cnv->sharedData);
+            slot->idleCount = 0;
+        }
+        if (slot != nullptr && slot->idleCount < IDLE_PER_SLOT) {
+            slot->idle[slot->idleCount++] = cnv;
+            return;
+        }
+    }
+    // Not kept: too many idle converters, changed settings, or no room for its kind.
+    ucnv_close(cnv);
+}
+
+#endif  // !UCONFIG_NO_CONVERSION
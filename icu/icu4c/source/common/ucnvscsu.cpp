@@ -107,6 +107,12 @@ static const uint32_t fixedOffsets[]={
     /* 0xFF */ 0xFF60  /* Halfwidth Katakana */
 };
 
+/*
+ * stopControls for ucnv_toUASCIIRun()/ucnv_fromUASCIIRun():
+ * single-byte mode passes through CR/LF/TAB/NUL, all other C0 controls are commands
+ */
+#define ASCII_RUN_STOP_COMMANDS ((uint32_t)~0x2601)
+
 /* state values */
 enum {
     readCommand,
@@ -290,15 +296,20 @@ _SCSUToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
         if(state==readCommand) {
 fastSingle:
             while(source<sourceLimit && target<targetLimit && (b=*source)>=0x20) {
-                ++source;
-                ++nextSourceIndex;
                 if(b<=0x7f) {
-                    /* write US-ASCII graphic character or DEL */
-                    *target++=(UChar)b;
+                    /* write a run of US-ASCII graphic characters, DEL and CR/LF/TAB/NUL */
+                    int32_t count=ucnv_toUASCIIRun(
+                        source, UCNV_ASCII_RUN_LENGTH(sourceLimit-source, targetLimit-target),
+                        target, offsets, sourceIndex, ASCII_RUN_STOP_COMMANDS, 0);
+                    source+=count;
+                    target+=count;
                     if(offsets!=NULL) {
-                        *offsets++=sourceIndex;
+                        offsets+=count;
                     }
+                    nextSourceIndex+=count;
                 } else {
+                    ++source;
+                    ++nextSourceIndex;
                     /* write from dynamic window */
                     uint32_t c=scsu->toUDynamicOffsets[dynamicWindow]+(b&0x7f);
                     if(c<=0xffff) {
@@ -636,11 +647,15 @@ _SCSUToUnicode(UConverterToUnicodeArgs *pArgs,
         if(state==readCommand) {
 fastSingle:
             while(source<sourceLimit && target<targetLimit && (b=*source)>=0x20) {
-                ++source;
                 if(b<=0x7f) {
-                    /* write US-ASCII graphic character or DEL */
-                    *target++=(UChar)b;
+                    /* write a run of US-ASCII graphic characters, DEL and CR/LF/TAB/NUL */
+                    int32_t count=ucnv_toUASCIIRun(
+                        source, UCNV_ASCII_RUN_LENGTH(sourceLimit-source, targetLimit-target),
+                        target, NULL, 0, ASCII_RUN_STOP_COMMANDS, 0);
+                    source+=count;
+                    target+=count;
                 } else {
+                    ++source;
                     /* write from dynamic window */
                     uint32_t c=scsu->toUDynamicOffsets[dynamicWindow]+(b&0x7f);
                     if(c<=0xffff) {
@@ -1070,6 +1085,23 @@ _SCSUFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
                 break;
             }
+            if(*source<=0x7f) {
+                /* pass a run of US-ASCII graphic characters, DEL and CR/LF/TAB/NUL through */
+                int32_t count=ucnv_fromUASCIIRun(
+                    source, UCNV_ASCII_RUN_LENGTH(sourceLimit-source, targetCapacity),
+                    target, offsets, sourceIndex, ASCII_RUN_STOP_COMMANDS, 0);
+                if(count>0) {
+                    source+=count;
+                    target+=count;
+                    if(offsets!=NULL) {
+                        offsets+=count;
+                    }
+                    targetCapacity-=count;
+                    nextSourceIndex+=count;
+                    sourceIndex=nextSourceIndex;
+                    continue;
+                }
+            }
             c=*source++;
             ++nextSourceIndex;
 
@@ -1570,6 +1602,18 @@ _SCSUFromUnicode(UConverterFromUnicodeArgs *pArgs,
                 *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
                 break;
             }
+            if(*source<=0x7f) {
+                /* pass a run of US-ASCII graphic characters, DEL and CR/LF/TAB/NUL through */
+                int32_t count=ucnv_fromUASCIIRun(
+                    source, UCNV_ASCII_RUN_LENGTH(sourceLimit-source, targetCapacity),
+                    target, NULL, 0, ASCII_RUN_STOP_COMMANDS, 0);
+                if(count>0) {
+                    source+=count;
+                    target+=count;
+                    targetCapacity-=count;
+                    continue;
+                }
+            }
             c=*source++;
 
             if((c-0x20)<=0x5f) {
@@ -45,6 +45,7 @@
 #include "uenumimp.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "usimd.h"
 
 U_NAMESPACE_USE
 
@@ -663,17 +664,6 @@ static const UEnumeration defaultEncodings = {
 };
 
 
-// internal fn to intersect two sets of masks
-// returns whether the mask has reduced to all zeros
-static UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len) {
-  int32_t i;
-  uint32_t oredDest = 0;
-  for (i = 0 ; i < len ; ++i) {
-    oredDest |= (dest[i] &= source1[i]);
-  }
-  return oredDest == 0;
-}
-
 // internal fn to count how many 1's are there in a mask
 // algorithm taken from  http://graphics.stanford.edu/~seander/bithacks.html
 static int16_t countOnes(uint32_t* mask, int32_t len) {
@@ -738,6 +728,119 @@ static UEnumeration *selectForMask(const UConverterSelector* sel,
   return en.orphan();
 }
 
+namespace {
+
+/**
+ * The intersection of the bit vectors of the code points seen so far.
+ * Each distinct bit vector is ANDed in only once: Text tends to reuse
+ * few of them, and a one-bit-per-pvIndex bitmap is cheaper to test than
+ * a full vector is to AND when there are many encodings.
+ */
+class SelectionMask : public UMemory {
+public:
+  SelectionMask(const UConverterSelector* selector, UErrorCode& status)
+      : sel(selector), columns((selector->encodingsCount+31)/32),
+        seenLength((selector->pvCount+31)/32) {
+    if ((columns > mask.getCapacity() && mask.resize(columns) == nullptr) ||
+        (seenLength > seen.getCapacity() && seen.resize(seenLength) == nullptr)) {
+      status = U_MEMORY_ALLOCATION_ERROR;
+      return;
+    }
+    reset();
+  }
+
+  void reset() {
+    uprv_memset(mask.getAlias(), ~0, columns * 4);
+    uprv_memset(seen.getAlias(), 0, seenLength * 4);
+    lastPvIndex = -1;
+    empty = false;
+  }
+
+  /** @return whether the mask has reduced to all zeros */
+  UBool isEmpty() const { return empty; }
+
+  /**
+   * Intersects the mask with the bit vector at pvIndex.
+   * @return whether the mask has reduced to all zeros
+   */
+  UBool intersect(uint16_t pvIndex) {
+    if (pvIndex != lastPvIndex) {
+      lastPvIndex = pvIndex;
+      uint32_t& word = seen[pvIndex >> 5];
+      uint32_t bit = (uint32_t)1 << (pvIndex & 31);
+      if ((word & bit) == 0) {
+        word |= bit;
+        empty = simd::andWords(mask.getAlias(), sel->pv + pvIndex, columns);
+      }
+    }
+    return empty;
+  }
+
+  /**
+   * Returns the selected encodings for the current mask,
+   * further intersected with the bit vector at extraPvIndex if that is not negative.
+   */
+  UEnumeration* select(int32_t extraPvIndex, UErrorCode* status) const {
+    uint32_t* result = (uint32_t*) uprv_malloc(columns * 4);
+    if (result == nullptr) {
+      *status = U_MEMORY_ALLOCATION_ERROR;
+      return nullptr;
+    }
+    uprv_memcpy(result, mask.getAlias(), columns * 4);
+    if (extraPvIndex >= 0) {
+      simd::andWords(result, sel->pv + extraPvIndex, columns);
+    }
+    return selectForMask(sel, result, status);
+  }
+
+private:
+  const UConverterSelector* sel;
+  int32_t columns;
+  int32_t seenLength;
+  MaybeStackArray<uint32_t, 8> mask;
+  MaybeStackArray<uint32_t, 160> seen;  // one bit per pv index
+  int32_t lastPvIndex;
+  UBool empty;
+};
+
+// Is s[0..length[ the beginning of a well-formed UTF-8 sequence (1<=length<=4)?
+UBool isUTF8Prefix(const uint8_t* s, int32_t length) {
+  uint8_t lead = s[0];
+  if (lead < 0xc2 || lead > 0xf4 || length > U8_COUNT_TRAIL_BYTES(lead) + 1) {
+    return false;
+  }
+  if (length >= 2) {
+    uint8_t t1 = s[1];
+    if (lead >= 0xf0 ? !U8_IS_VALID_LEAD4_AND_T1(lead, t1) :
+        lead >= 0xe0 ? !U8_IS_VALID_LEAD3_AND_T1(lead, t1) : !U8_IS_TRAIL(t1)) {
+      return false;
+    }
+    for (int32_t i = 2; i < length; ++i) {
+      if (!U8_IS_TRAIL(s[i])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Returns the length of an incomplete but so far well-formed UTF-8 sequence
+// at the end of s[0..length[, or 0 if there is none.
+int32_t getTruncatedUTF8Length(const uint8_t* s, int32_t length) {
+  for (int32_t i = 1; i <= 3 && i <= length; ++i) {
+    uint8_t b = s[length - i];
+    if (!U8_IS_TRAIL(b)) {
+      if (isUTF8Prefix(s + length - i, i) && i < U8_COUNT_TRAIL_BYTES(b) + 1) {
+        return i;
+      }
+      break;
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+
 /* check a string against the selector - UTF16 version */
 U_CAPI UEnumeration * U_EXPORT2
 ucnvsel_selectForString(const UConverterSelector* sel,
@@ -752,13 +855,10 @@ ucnvsel_selectForString(const UConverterSelector* sel,
     return NULL;
   }
 
-  int32_t columns = (sel->encodingsCount+31)/32;
-  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
-  if (mask == NULL) {
-    *status = U_MEMORY_ALLOCATION_ERROR;
+  SelectionMask mask(sel, *status);
+  if (U_FAILURE(*status)) {
     return NULL;
   }
-  uprv_memset(mask, ~0, columns *4);
 
   if(s!=NULL) {
     const UChar *limit;
@@ -772,12 +872,12 @@ ucnvsel_selectForString(const UConverterSelector* sel,
       UChar32 c;
       uint16_t pvIndex;
       UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+      if (mask.intersect(pvIndex)) {
         break;
       }
     }
   }
-  return selectForMask(sel, mask, status);
+  return mask.select(-1, status);
 }
 
 /* check a string against the selector - UTF8 version */
@@ -794,13 +894,10 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
     return NULL;
   }
 
-  int32_t columns = (sel->encodingsCount+31)/32;
-  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
-  if (mask == NULL) {
-    *status = U_MEMORY_ALLOCATION_ERROR;
+  SelectionMask mask(sel, *status);
+  if (U_FAILURE(*status)) {
     return NULL;
   }
-  uprv_memset(mask, ~0, columns *4);
 
   if (length < 0) {
     length = (int32_t)uprv_strlen(s);
@@ -812,12 +909,177 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
     while (s != limit) {
       uint16_t pvIndex;
       UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+      if (mask.intersect(pvIndex)) {
         break;
       }
     }
   }
-  return selectForMask(sel, mask, status);
+  return mask.select(-1, status);
+}
+
+struct UConverterSelectorStream : public UMemory {
+  UConverterSelectorStream(const UConverterSelector* selector, UErrorCode& status)
+      : sel(selector), mask(selector, status) {}
+
+  const UConverterSelector* sel;
+  SelectionMask mask;
+  UChar lead = 0;           // lead surrogate at the end of the last UTF-16 chunk
+  uint8_t bytes[4];         // incomplete sequence at the end of the last UTF-8 chunk
+  int32_t bytesLength = 0;
+};
+
+U_CAPI UConverterSelectorStream * U_EXPORT2
+ucnvsel_openStream(const UConverterSelector* sel, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  if (sel == NULL) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+  LocalPointer<UConverterSelectorStream> stream(new UConverterSelectorStream(sel, *status), *status);
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  return stream.orphan();
+}
+
+U_CAPI void U_EXPORT2
+ucnvsel_closeStream(UConverterSelectorStream *stream) {
+  delete stream;
+}
+
+U_CAPI void U_EXPORT2
+ucnvsel_resetStream(UConverterSelectorStream *stream) {
+  if (stream != NULL) {
+    stream->mask.reset();
+    stream->lead = 0;
+    stream->bytesLength = 0;
+  }
+}
+
+U_CAPI void U_EXPORT2
+ucnvsel_streamString(UConverterSelectorStream *stream,
+                     const UChar *s, int32_t length, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return;
+  }
+  if (stream == NULL || (s == NULL && length != 0) || length < -1) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return;
+  }
+  if (length < 0) {
+    length = u_strlen(s);
+  }
+  if (length == 0 || stream->mask.isEmpty()) {
+    return;
+  }
+  const UTrie2 *trie = stream->sel->trie;
+  const UChar *limit = s + length;
+  if (stream->lead != 0) {
+    // Finish the surrogate pair from the last chunk, or look up the lone lead surrogate
+    // like UTRIE2_U16_NEXT16() does.
+    UChar32 c = stream->lead;
+    stream->lead = 0;
+    uint16_t pvIndex;
+    if (U16_IS_TRAIL(*s)) {
+      c = U16_GET_SUPPLEMENTARY(c, *s++);
+      pvIndex = UTRIE2_GET16_FROM_SUPP(trie, c);
+    } else {
+      pvIndex = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, c);
+    }
+    if (stream->mask.intersect(pvIndex)) {
+      return;
+    }
+  }
+  if (s != limit && U16_IS_LEAD(limit[-1])) {
+    stream->lead = *--limit;
+  }
+  while (s != limit) {
+    UChar32 c;
+    uint16_t pvIndex;
+    UTRIE2_U16_NEXT16(trie, s, limit, c, pvIndex);
+    if (stream->mask.intersect(pvIndex)) {
+      break;
+    }
+  }
+}
+
+U_CAPI void U_EXPORT2
+ucnvsel_streamUTF8(UConverterSelectorStream *stream,
+                   const char *s, int32_t length, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return;
+  }
+  if (stream == NULL || (s == NULL && length != 0) || length < -1) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return;
+  }
+  if (length < 0) {
+    length = (int32_t)uprv_strlen(s);
+  }
+  if (length == 0 || stream->mask.isEmpty()) {
+    return;
+  }
+  const UTrie2 *trie = stream->sel->trie;
+  const uint8_t *p = (const uint8_t *)s;
+  const uint8_t *limit = p + length;
+  if (stream->bytesLength > 0) {
+    // Continue the sequence from the last chunk while it stays well-formed.
+    int32_t count = U8_COUNT_TRAIL_BYTES(stream->bytes[0]) + 1;
+    while (p != limit) {
+      stream->bytes[stream->bytesLength] = *p;
+      if (!isUTF8Prefix(stream->bytes, stream->bytesLength + 1)) {
+        break;
+      }
+      ++p;
+      if (++stream->bytesLength == count) {
+        const uint8_t *q = stream->bytes;
+        uint16_t pvIndex;
+        UTRIE2_U8_NEXT16(trie, q, stream->bytes + count, pvIndex);
+        stream->bytesLength = 0;
+        if (stream->mask.intersect(pvIndex)) {
+          return;
+        }
+        break;
+      }
+    }
+    if (p == limit && stream->bytesLength > 0) {
+      return;  // still incomplete
+    }
+    // An ill-formed sequence maps to the all-ones error value, like in
+    // ucnvsel_selectForUTF8(), and does not change the mask.
+    stream->bytesLength = 0;
+  }
+  int32_t truncated = getTruncatedUTF8Length(p, (int32_t)(limit - p));
+  limit -= truncated;
+  uprv_memcpy(stream->bytes, limit, truncated);
+  stream->bytesLength = truncated;
+  while (p != limit) {
+    uint16_t pvIndex;
+    UTRIE2_U8_NEXT16(trie, p, limit, pvIndex);
+    if (stream->mask.intersect(pvIndex)) {
+      break;
+    }
+  }
+}
+
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_selectForStream(const UConverterSelectorStream *stream, UErrorCode *status) {
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  if (stream == NULL) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+  // A lone lead surrogate at the end counts like in ucnvsel_selectForString(),
+  // while an incomplete UTF-8 sequence is ill-formed and does not.
+  int32_t extraPvIndex = -1;
+  if (stream->lead != 0) {
+    extraPvIndex = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(stream->sel->trie, stream->lead);
+  }
+  return stream->mask.select(extraPvIndex, status);
 }
 
 #endif  // !UCONFIG_NO_CONVERSION
@@ -31,14 +31,15 @@ might have to #include some other header
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "flathashmap.h"
 #include "mutex.h"
 #include "putilimp.h"
 #include "restrace.h"
+#include "uarrsort.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
 #include "ucmndata.h"
 #include "udatamem.h"
-#include "uhash.h"
 #include "umapfile.h"
 #include "umutex.h"
 
@@ -108,7 +109,10 @@ static UDataMemory *gCommonICUDataArray[10] = { NULL };   // Access protected by
 
 static u_atomic_int32_t gHaveTriedToLoadCommonData {0};  //  See extendICUData().
 
-static UHashtable  *gCommonDataCache = NULL;  /* Global hash table of opened ICU data files.  */
+struct DataCacheElement;
+/* Maps the base names of opened ICU data files to their cache elements, which own the names. */
+typedef FlatHashMap<const char *, DataCacheElement *, CharsKeyTraits> DataCacheHashtable;
+static DataCacheHashtable *gCommonDataCache = NULL;  /* Global hash table of opened ICU data files.  */
 static icu::UInitOnce gCommonDataCacheInitOnce {};
 
 #if !defined(ICU_DATA_DIR_WINDOWS)
@@ -119,13 +123,18 @@ static UDataFileAccess  gDataFileAccess = UDATA_DEFAULT_ACCESS;  // Access not s
 static UDataFileAccess  gDataFileAccess = UDATA_NO_FILES;
 #endif
 
+static void U_CALLCONV DataCacheElement_deleter(DataCacheElement *pDCEl);
+
 static UBool U_CALLCONV
 udata_cleanup(void)
 {
     int32_t i;
 
     if (gCommonDataCache) {             /* Delete the cache of user data mappings.  */
-        uhash_close(gCommonDataCache);  /*   Table owns the contents, and will delete them. */
+        for (i = gCommonDataCache->nextPosition(-1); i >= 0; i = gCommonDataCache->nextPosition(i)) {
+            DataCacheElement_deleter(gCommonDataCache->valueAt(i));
+        }
+        delete gCommonDataCache;
         gCommonDataCache = NULL;        /*   Cleanup is not thread safe.                */
     }
     gCommonDataCacheInitOnce.reset();
@@ -270,24 +279,22 @@ typedef struct DataCacheElement {
 
 /*
  * Deleter function for DataCacheElements.
- *         udata cleanup function closes the hash table; hash table in turn calls back to
- *         here for each entry.
+ *         udata cleanup function calls it for each entry of the hash table
+ *         before deleting the table.
  */
-static void U_CALLCONV DataCacheElement_deleter(void *pDCEl) {
-    DataCacheElement *p = (DataCacheElement *)pDCEl;
+static void U_CALLCONV DataCacheElement_deleter(DataCacheElement *p) {
     udata_close(p->item);              /* unmaps storage */
     uprv_free(p->name);                /* delete the hash key string. */
-    uprv_free(pDCEl);                  /* delete 'this'          */
+    uprv_free(p);                      /* delete 'this'          */
 }
 
 static void U_CALLCONV udata_initHashTable(UErrorCode &err) {
     U_ASSERT(gCommonDataCache == NULL);
-    gCommonDataCache = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &err);
-    if (U_FAILURE(err)) {
+    gCommonDataCache = new DataCacheHashtable();
+    if (gCommonDataCache == NULL) {
+       err = U_MEMORY_ALLOCATION_ERROR;
        return;
     }
-    U_ASSERT(gCommonDataCache != NULL);
-    uhash_setValueDeleter(gCommonDataCache, DataCacheElement_deleter);
     ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
 }
 
@@ -295,7 +302,7 @@ static void U_CALLCONV udata_initHashTable(UErrorCode &err) {
   *     Get the hash table used to store the data cache entries.
   *     Lazy create it if it doesn't yet exist.
   */
-static UHashtable *udata_getHashTable(UErrorCode &err) {
+static DataCacheHashtable *udata_getHashTable(UErrorCode &err) {
     umtx_initOnce(gCommonDataCacheInitOnce, &udata_initHashTable, err);
     return gCommonDataCache;
 }
@@ -304,7 +311,7 @@ static UHashtable *udata_getHashTable(UErrorCode &err) {
 
 static UDataMemory *udata_findCachedData(const char *path, UErrorCode &err)
 {
-    UHashtable        *htable;
+    DataCacheHashtable *htable;
     UDataMemory       *retVal = NULL;
     DataCacheElement  *el;
     const char        *baseName;
@@ -316,7 +323,7 @@ static UDataMemory *udata_findCachedData(const char *path, UErrorCode &err)
 
     baseName = findBasename(path);   /* Cache remembers only the base name, not the full path. */
     umtx_lock(NULL);
-    el = (DataCacheElement *)uhash_get(htable, baseName);
+    el = htable->get(baseName);
     umtx_unlock(NULL);
     if (el != NULL) {
         retVal = el->item;
@@ -332,7 +339,7 @@ static UDataMemory *udata_cacheDataItem(const char *path, UDataMemory *item, UEr
     DataCacheElement *newElement;
     const char       *baseName;
     int32_t           nameLen;
-    UHashtable       *htable;
+    DataCacheHashtable *htable;
     DataCacheElement *oldValue = NULL;
     UErrorCode        subErr = U_ZERO_ERROR;
 
@@ -370,16 +377,15 @@ static UDataMemory *udata_cacheDataItem(const char *path, UDataMemory *item, UEr
     /* Stick the new DataCacheElement into the hash table.
     */
     umtx_lock(NULL);
-    oldValue = (DataCacheElement *)uhash_get(htable, path);
+    oldValue = htable->get(path);
     if (oldValue != NULL) {
         subErr = U_USING_DEFAULT_WARNING;
     }
     else {
-        uhash_put(
-            htable,
+        htable->put(
             newElement->name,               /* Key   */
             newElement,                     /* Value */
-            &subErr);
+            subErr);
     }
     umtx_unlock(NULL);
 
@@ -1468,3 +1474,137 @@ U_CAPI void U_EXPORT2 udata_setFileAccess(UDataFileAccess access, UErrorCode * /
     // Note: this function is documented as not thread safe.
     gDataFileAccess = access;
 }
+
+namespace {
+
+/*
+ * Returns true if the TOC entry name, without its package name,
+ * matches the udata_preload() pattern.
+ */
+UBool matchesPreloadPattern(const char *pattern, const char *name) {
+    for (;;) {
+        char p = *pattern;
+        if (p == '*') {
+            // Try all lengths of the run of characters that the '*' matches.
+            ++pattern;
+            for (;;) {
+                if (matchesPreloadPattern(pattern, name)) {
+                    return true;
+                }
+                if (*name == 0 || *name == U_TREE_ENTRY_SEP_CHAR) {
+                    return false;
+                }
+                ++name;
+            }
+        }
+        if (p == 0) {
+            return *name == 0;
+        }
+        if (p == U_TREE_ENTRY_SEP_CHAR && pattern[1] == 0) {
+            // A pattern ending with '/' selects the whole tree.
+            return *name == U_TREE_ENTRY_SEP_CHAR;
+        }
+        if (p != *name) {
+            return false;
+        }
+        ++pattern;
+        ++name;
+    }
+}
+
+/* Page-aligned memory range of data items to be preloaded. */
+struct PreloadRange {
+    uintptr_t start;
+    uintptr_t limit;
+};
+
+int32_t U_CALLCONV
+comparePreloadRanges(const void * /*context*/, const void *left, const void *right) {
+    uintptr_t l = static_cast<const PreloadRange *>(left)->start;
+    uintptr_t r = static_cast<const PreloadRange *>(right)->start;
+    return l < r ? -1 : (l > r ? 1 : 0);
+}
+
+}  // namespace
+
+U_CAPI int64_t U_EXPORT2
+udata_preload(const char * const *patterns, int32_t patternCount,
+              int32_t options, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if (patterns != NULL && patternCount < 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uintptr_t pageMask = (uintptr_t)uprv_getMemoryPageSize() - 1;
+
+    /* Collect the memory ranges of the selected items in all of the common ICU data,
+     * loading the full set of ICU data like doLoadFromCommonData() does. */
+    MaybeStackArray<PreloadRange, 64> ranges;
+    int32_t rangeCount = 0;
+    UBool checkedExtendedICUData = false;
+    for (int32_t commonDataIndex = 0;;) {
+        UErrorCode subErrorCode = U_ZERO_ERROR;
+        UDataMemory *pCommonData = openCommonData(NULL, commonDataIndex, &subErrorCode);
+        if (pCommonData != NULL) {
+            int32_t count = (int32_t)pCommonData->vFuncs->NumEntries(pCommonData);
+            for (int32_t i = 0; i < count; ++i) {
+                const char *name;
+                int32_t length;
+                const DataHeader *pHeader =
+                    pCommonData->vFuncs->GetEntry(pCommonData, i, &name, &length);
+                /* Entry names start with the package name, like "icudt72l/coll/root.res". */
+                const char *itemName = uprv_strchr(name, U_TREE_ENTRY_SEP_CHAR);
+                itemName = itemName != NULL ? itemName + 1 : name;
+                UBool selected = patterns == NULL;
+                for (int32_t j = 0; !selected && j < patternCount; ++j) {
+                    selected = matchesPreloadPattern(patterns[j], itemName);
+                }
+                if (!selected) {
+                    continue;
+                }
+                if (length < 0) {
+                    /* Unknown length: Preload at least the page with the header. */
+                    length = 1;
+                }
+                if (rangeCount == ranges.getCapacity() &&
+                        ranges.resize(2 * rangeCount, rangeCount) == NULL) {
+                    *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+                    return 0;
+                }
+                uintptr_t start = (uintptr_t)pHeader;
+                ranges[rangeCount].start = start & ~pageMask;
+                ranges[rangeCount].limit = (start + (uint32_t)length + pageMask) & ~pageMask;
+                ++rangeCount;
+            }
+            ++commonDataIndex;  /* try the next data package */
+        } else if (!checkedExtendedICUData && extendICUData(&subErrorCode)) {
+            checkedExtendedICUData = true;
+            /* try this data package slot again: it changed from NULL to non-NULL */
+        } else {
+            break;
+        }
+    }
+
+    /* Merge overlapping and adjacent ranges, so that each page is counted once. */
+    uprv_sortArray(ranges.getAlias(), rangeCount, (int32_t)sizeof(PreloadRange),
+                   comparePreloadRanges, NULL, false, pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    UBool hugePages = (options & UDATA_PRELOAD_HUGE_PAGES) != 0;
+    int64_t byteCount = 0;
+    for (int32_t i = 0; i < rangeCount;) {
+        uintptr_t start = ranges[i].start;
+        uintptr_t limit = ranges[i].limit;
+        for (++i; i < rangeCount && ranges[i].start <= limit; ++i) {
+            if (ranges[i].limit > limit) {
+                limit = ranges[i].limit;
+            }
+        }
+        uprv_preloadMemory((const void *)start, (int64_t)(limit - start), hugePages);
+        byteCount += (int64_t)(limit - start);
+    }
+    return byteCount;
+}
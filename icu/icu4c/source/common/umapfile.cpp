@@ -528,3 +528,49 @@ typedef HANDLE MemoryMap;
 #else
 #   error MAP_IMPLEMENTATION is set incorrectly
 #endif
+
+
+/*----------------------------------------------------------------------------*
+ *                                                                            *
+ *   Preloading of data into memory                                           *
+ *                                                                            *
+ *----------------------------------------------------------------------------*/
+U_CFUNC int32_t
+uprv_getMemoryPageSize() {
+#if MAP_IMPLEMENTATION==MAP_WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int32_t)info.dwPageSize;
+#elif MAP_IMPLEMENTATION==MAP_POSIX
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize > 0) {
+        return (int32_t)pageSize;
+    }
+    return 4096;
+#else
+    return 4096;
+#endif
+}
+
+U_CFUNC void
+uprv_preloadMemory(const void *start, int64_t length, UBool hugePages) {
+#if MAP_IMPLEMENTATION==MAP_POSIX
+    void *addr = const_cast<void *>(start);
+#if defined(MADV_HUGEPAGE)
+    if (hugePages) {
+        madvise(addr, (size_t)length, MADV_HUGEPAGE);
+    }
+#endif
+    // Start reading all of the pages ahead; the loop below then mostly
+    // finds them resident instead of faulting them in one at a time.
+    posix_madvise(addr, (size_t)length, POSIX_MADV_WILLNEED);
+#endif
+    (void)hugePages;
+
+    // Touch every page so that it is resident when we return.
+    int32_t pageSize = uprv_getMemoryPageSize();
+    const volatile char *bytes = static_cast<const volatile char *>(start);
+    for (int64_t i = 0; i < length; i += pageSize) {
+        (void)bytes[i];
+    }
+}
@@ -32,6 +32,19 @@
 U_CAPI  UBool U_EXPORT2 uprv_mapFile(UDataMemory *pdm, const char *path, UErrorCode *status);
 U_CFUNC void  uprv_unmapFile(UDataMemory *pData);
 
+/*
+ *  Returns the size of a virtual memory page.
+ */
+U_CFUNC int32_t uprv_getMemoryPageSize(void);
+
+/*
+ *  Makes the memory in [start, start+length[ resident, for example by
+ *  paging in memory-mapped data. start and length must be multiples of
+ *  the memory page size. If hugePages is true, asks the operating system
+ *  to back the memory with huge pages if it can.
+ */
+U_CFUNC void  uprv_preloadMemory(const void *start, int64_t length, UBool hugePages);
+
 /* MAP_NONE: no memory mapping, no file access at all */
 #define MAP_NONE        0
 #define MAP_WIN32       1
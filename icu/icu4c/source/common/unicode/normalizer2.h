@@ -247,6 +247,68 @@ class U_COMMON_API Normalizer2 : public UObject {
     normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink,
                   Edits *edits, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes the normalized form of the source string to the destination string
+     * (replacing its contents) and returns the destination string,
+     * like normalize(), but on several threads for long strings.
+     *
+     * The source is split into up to threadCount pieces just before characters
+     * for which hasBoundaryBefore() is true.
+     * The pieces are normalized concurrently and concatenated in dest,
+     * so that the result is the same as from normalize().
+     * Short strings, and strings without suitable boundaries,
+     * are normalized on the calling thread.
+     *
+     * @param src source string
+     * @param dest destination string; its contents is replaced with normalized src
+     * @param threadCount the maximum number of threads to use, including the calling thread;
+     *                    1 normalizes on the calling thread only
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return dest
+     * @see normalize
+     * @draft ICU 73
+     */
+    UnicodeString &
+    normalizeParallel(const UnicodeString &src, UnicodeString &dest,
+                      int32_t threadCount, UErrorCode &errorCode) const;
+
+    /**
+     * Normalizes a UTF-8 string and optionally records how source substrings
+     * relate to changed and unchanged result substrings,
+     * like normalizeUTF8(), but on several threads for long strings.
+     *
+     * The source is split like in normalizeParallel().
+     * The output of the pieces is written to the sink in order,
+     * and their edits are appended to edits in order,
+     * so that both are the same as from normalizeUTF8().
+     *
+     * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT and U_EDITS_NO_RESET.
+     * @param src       Source UTF-8 string.
+     * @param sink      A ByteSink to which the normalized UTF-8 result string is written.
+     *                  sink.Flush() is called at the end.
+     * @param edits     Records edits for index mapping, working with styled text,
+     *                  and getting only changes (if any).
+     *                  The Edits contents is undefined if any error occurs.
+     *                  This function calls edits->reset() first unless
+     *                  options includes U_EDITS_NO_RESET. edits can be nullptr.
+     * @param threadCount the maximum number of threads to use, including the calling thread;
+     *                    1 normalizes on the calling thread only
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @see normalizeUTF8
+     * @draft ICU 73
+     */
+    void
+    normalizeUTF8Parallel(uint32_t options, StringPiece src, ByteSink &sink,
+                          Edits *edits, int32_t threadCount, UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Appends the normalized form of the second string to the first string
      * (merging them at the boundary) and returns the first string.
@@ -762,6 +824,142 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
     const UnicodeSet &set;
 };
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Normalizes a stream of text that arrives in chunks, with bounded memory.
+ *
+ * Each chunk is normalized up to the last normalization boundary in it
+ * (a character for which Normalizer2::hasBoundaryBefore() is true),
+ * and the normalized text is written out right away.
+ * Only the rest of the chunk after that boundary is held back,
+ * to be normalized together with the following chunk.
+ * The chunks can be split anywhere, even inside a surrogate pair or
+ * inside a UTF-8 sequence.
+ * After the last chunk, call finish() or finishUTF8() for the remaining text.
+ * The concatenated output is the same as from normalizing the whole text at once.
+ *
+ * One stream uses either the UTF-16 functions or the UTF-8 functions;
+ * call reset() before switching.
+ *
+ * An instance of this class is not thread-safe.
+ * The Normalizer2 must remain valid while the StreamingNormalizer2 is used.
+ * @draft ICU 73
+ */
+class U_COMMON_API StreamingNormalizer2 : public UObject {
+public:
+    /**
+     * Constructs a streaming normalizer for the given Normalizer2.
+     * @param n2 wrapped Normalizer2 instance
+     * @draft ICU 73
+     */
+    explicit StreamingNormalizer2(const Normalizer2 &n2);
+
+    /**
+     * Destructor.
+     * @draft ICU 73
+     */
+    ~StreamingNormalizer2();
+
+    /**
+     * Discards any held-back text, for starting a new stream.
+     * @draft ICU 73
+     */
+    void reset();
+
+    /**
+     * Normalizes the next chunk of the stream, together with the text held back
+     * from the previous chunks, up to the last normalization boundary,
+     * and appends the result to dest.
+     * The remainder is held back until the next call.
+     * @param chunk the next part of the UTF-16 text
+     * @param dest the normalized text is appended to this string;
+     *             must be a different object than chunk
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return dest
+     * @draft ICU 73
+     */
+    UnicodeString &
+    normalizeChunk(const UnicodeString &chunk, UnicodeString &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the text held back from the previous chunks,
+     * appends the result to dest, and resets this object.
+     * @param dest the normalized text is appended to this string
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return dest
+     * @draft ICU 73
+     */
+    UnicodeString &
+    finish(UnicodeString &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next chunk of a UTF-8 stream, together with the text held back
+     * from the previous chunks, up to the last normalization boundary,
+     * and writes the result to the sink.
+     * The remainder is held back until the next call.
+     *
+     * Edits are appended for the normalized text, as with U_EDITS_NO_RESET;
+     * edits->reset() is never called.
+     * The edits of all calls together are the same as those from
+     * Normalizer2::normalizeUTF8() for the whole text.
+     *
+     * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT.
+     * @param chunk     the next part of the UTF-8 text
+     * @param sink      A ByteSink to which the normalized UTF-8 text is written.
+     *                  sink.Flush() is called at the end.
+     * @param edits     Records edits for index mapping, working with styled text,
+     *                  and getting only changes (if any).
+     *                  edits can be nullptr.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 73
+     */
+    void
+    normalizeUTF8Chunk(uint32_t options, StringPiece chunk, ByteSink &sink,
+                       Edits *edits, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the UTF-8 text held back from the previous chunks,
+     * writes the result to the sink, and resets this object.
+     * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT.
+     * @param sink      A ByteSink to which the normalized UTF-8 text is written.
+     *                  sink.Flush() is called at the end.
+     * @param edits     Records edits like in normalizeUTF8Chunk(). edits can be nullptr.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 73
+     */
+    void
+    finishUTF8(uint32_t options, ByteSink &sink, Edits *edits, UErrorCode &errorCode);
+
+private:
+    StreamingNormalizer2(const StreamingNormalizer2 &) = delete;
+    StreamingNormalizer2 &operator=(const StreamingNormalizer2 &) = delete;
+
+    UBool appendPending8(const char *s, int32_t length, UErrorCode &errorCode);
+
+    const Normalizer2 &norm2;
+    // Held-back UTF-16 text.
+    UnicodeString pending;
+    // Scratch output for normalizeChunk().
+    UnicodeString normalized;
+    // Held-back UTF-8 text.
+    char *pending8;
+    int32_t pending8Length;
+    int32_t pending8Capacity;
+};
+#endif  // U_HIDE_DRAFT_API
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
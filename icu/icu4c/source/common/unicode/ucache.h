@@ -0,0 +1,196 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  ucache.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+******************************************************************************
+*/
+
+#ifndef __UCACHE_H__
+#define __UCACHE_H__
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C API: Control and monitor ICU's cache of locale data objects
+ *
+ * ICU caches objects created from locale data, such as number formats,
+ * date format symbols, plural rules and collation tailorings, in one
+ * process-wide cache. Objects that are no longer referenced by any service
+ * object stay in the cache for reuse until they are evicted.
+ *
+ * These functions allow an application to bound the memory used by that
+ * cache and to observe it, including per object type statistics on hits,
+ * misses, creation times and waits for objects being created by other threads.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Sets a limit on the approximate memory used by objects in ICU's cache.
+ * Whenever the total exceeds the limit, objects that are no longer in use are
+ * evicted, least recently used first, until the total is under the limit again.
+ * Objects still in use are never evicted, so the limit can be exceeded if the
+ * objects in use alone take more memory.
+ *
+ * The memory of each object is a rough estimate of the heap memory it owns.
+ * Data that is memory-mapped from ICU's data files does not count.
+ *
+ * By default there is no memory limit.
+ *
+ * @param maxBytes the memory limit in bytes, or 0 for no limit.
+ * @param status   ICU error code. Set to U_ILLEGAL_ARGUMENT_ERROR if
+ *                 maxBytes is negative.
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucache_setMemoryLimit(int64_t maxBytes, UErrorCode *status);
+
+/**
+ * Returns the memory limit set with ucache_setMemoryLimit().
+ *
+ * @param status ICU error code.
+ * @return the memory limit in bytes, or 0 if there is no limit.
+ * @draft ICU 73
+ */
+U_CAPI int64_t U_EXPORT2
+ucache_getMemoryLimit(UErrorCode *status);
+
+/**
+ * Returns the approximate number of bytes used by the objects in ICU's cache.
+ * See ucache_setMemoryLimit() for how the memory of objects is estimated.
+ *
+ * @param status ICU error code.
+ * @return the approximate memory usage of cached objects, in bytes.
+ * @draft ICU 73
+ */
+U_CAPI int64_t U_EXPORT2
+ucache_getByteCount(UErrorCode *status);
+
+/**
+ * Returns the number of entries in ICU's cache. Several entries can share
+ * one object, for example when locales fall back to the same data.
+ *
+ * @param status ICU error code.
+ * @return the number of cache entries.
+ * @draft ICU 73
+ */
+U_CAPI int32_t U_EXPORT2
+ucache_getEntryCount(UErrorCode *status);
+
+/**
+ * Returns the number of entries that ICU's cache has evicted so far, to honor
+ * its limits on unused entries and on memory.
+ *
+ * @param status ICU error code.
+ * @return the number of evicted entries.
+ * @draft ICU 73
+ */
+U_CAPI int64_t U_EXPORT2
+ucache_getEvictionCount(UErrorCode *status);
+
+/**
+ * Statistics that ICU's cache keeps for each type of cached object.
+ * Times are measured with a monotonic clock.
+ * @see ucache_getKeyTypeStatistic
+ * @draft ICU 73
+ */
+typedef enum UCacheStatistic {
+    /**
+     * The number of lookups that found an object in the cache.
+     * @draft ICU 73
+     */
+    UCACHE_HITS,
+    /**
+     * The number of lookups that did not find an object and created it.
+     * @draft ICU 73
+     */
+    UCACHE_MISSES,
+    /**
+     * The number of lookups that waited for another thread to create the
+     * same object.
+     * @draft ICU 73
+     */
+    UCACHE_WAITS,
+    /**
+     * The total time that lookups waited for other threads to create
+     * objects, in nanoseconds.
+     * @draft ICU 73
+     */
+    UCACHE_WAIT_NANOS,
+    /**
+     * The total time spent creating objects on misses, in nanoseconds.
+     * @draft ICU 73
+     */
+    UCACHE_CREATION_NANOS,
+    /**
+     * The longest time spent creating one object, in nanoseconds.
+     * @draft ICU 73
+     */
+    UCACHE_MAX_CREATION_NANOS,
+    /**
+     * The number of entries that were evicted to honor the cache limits.
+     * @draft ICU 73
+     */
+    UCACHE_EVICTIONS
+} UCacheStatistic;
+
+/**
+ * Returns the number of types of objects for which ICU's cache has
+ * statistics. Types are added as objects of new types are first cached.
+ *
+ * @param status ICU error code.
+ * @return the number of key types.
+ * @draft ICU 73
+ */
+U_CAPI int32_t U_EXPORT2
+ucache_countKeyTypes(UErrorCode *status);
+
+/**
+ * Returns the name of a type of objects in ICU's cache, such as
+ * "SharedNumberFormat". The names are the same on all platforms,
+ * but they are the names of internal classes and may change
+ * between ICU versions.
+ *
+ * @param index  the index of the key type, from 0 to
+ *               ucache_countKeyTypes() - 1.
+ * @param status ICU error code. Set to U_INDEX_OUTOFBOUNDS_ERROR if
+ *               index is out of range.
+ * @return the key type name, a NUL-terminated string owned by ICU.
+ * @draft ICU 73
+ */
+U_CAPI const char * U_EXPORT2
+ucache_getKeyTypeName(int32_t index, UErrorCode *status);
+
+/**
+ * Returns one statistic of ICU's cache for a type of objects.
+ *
+ * @param index     the index of the key type, from 0 to
+ *                  ucache_countKeyTypes() - 1.
+ * @param statistic the statistic to return.
+ * @param status    ICU error code. Set to U_INDEX_OUTOFBOUNDS_ERROR if
+ *                  index is out of range.
+ * @return the value of the statistic.
+ * @draft ICU 73
+ */
+U_CAPI int64_t U_EXPORT2
+ucache_getKeyTypeStatistic(int32_t index, UCacheStatistic statistic, UErrorCode *status);
+
+/**
+ * Resets all statistics of ICU's cache to 0.
+ *
+ * @param status ICU error code.
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucache_resetStatistics(UErrorCode *status);
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // __UCACHE_H__
@@ -1297,6 +1297,92 @@ ucnv_toUChars(UConverter *cnv,
               const char *src, int32_t srcLength,
               UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Convert many Unicode strings into codepage strings using an existing UConverter,
+ * like calling ucnv_fromUChars() for each of them.
+ * This is faster than separate calls when the strings are short,
+ * for example database fields.
+ *
+ * The output strings are written one after another into dest, without separators.
+ * destOffsets[i] is set to the index in dest where the output for sources[i] starts,
+ * and destOffsets[count] to the total output length.
+ * The converter is reset before each string, so that each output
+ * is the same as from ucnv_fromUChars().
+ * The output is NUL-terminated if possible.
+ *
+ * If a string cannot be converted, then the function stops with that error code,
+ * and destOffsets[i] is set only for the strings up to and including that one.
+ *
+ * @param cnv the converter object to be used (ucnv_resetFromUnicode() will be called)
+ * @param dest destination buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of chars available at dest
+ * @param sources the input Unicode strings
+ * @param sourceLengths the input string lengths; a length can be -1 if that string is NUL-terminated
+ * @param count the number of input strings
+ * @param destOffsets an array of count+1 output offsets, must not be NULL
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors
+ * @return the total length of the output, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the output will not fit
+ *         and a buffer of the indicated length would need to be passed in;
+ *         the destOffsets are set also in this case
+ * @see ucnv_fromUChars
+ * @draft ICU 73
+ */
+U_CAPI int32_t U_EXPORT2
+ucnv_fromUCharsBatch(UConverter *cnv,
+                     char *dest, int32_t destCapacity,
+                     const UChar *const *sources, const int32_t *sourceLengths,
+                     int32_t count, int32_t *destOffsets,
+                     UErrorCode *pErrorCode);
+
+/**
+ * Convert many codepage strings into Unicode strings using an existing UConverter,
+ * like calling ucnv_toUChars() for each of them.
+ * This is faster than separate calls when the strings are short,
+ * for example database fields.
+ *
+ * The output strings are written one after another into dest, without separators.
+ * destOffsets[i] is set to the index in dest where the output for sources[i] starts,
+ * and destOffsets[count] to the total output length.
+ * The converter is reset before each string, so that each output
+ * is the same as from ucnv_toUChars().
+ * The output is NUL-terminated if possible.
+ *
+ * If a string cannot be converted, then the function stops with that error code,
+ * and destOffsets[i] is set only for the strings up to and including that one.
+ *
+ * @param cnv the converter object to be used (ucnv_resetToUnicode() will be called)
+ * @param dest destination buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of UChars available at dest
+ * @param sources the input codepage strings
+ * @param sourceLengths the input string lengths; a length can be -1 if that string is NUL-terminated
+ * @param count the number of input strings
+ * @param destOffsets an array of count+1 output offsets, must not be NULL
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors
+ * @return the total length of the output, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the output will not fit
+ *         and a buffer of the indicated length would need to be passed in;
+ *         the destOffsets are set also in this case
+ * @see ucnv_toUChars
+ * @draft ICU 73
+ */
+U_CAPI int32_t U_EXPORT2
+ucnv_toUCharsBatch(UConverter *cnv,
+                   UChar *dest, int32_t destCapacity,
+                   const char *const *sources, const int32_t *sourceLengths,
+                   int32_t count, int32_t *destOffsets,
+                   UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Convert a codepage buffer into Unicode one character at a time.
  * The input is completely consumed when the U_INDEX_OUTOFBOUNDS_ERROR is set.
@@ -1584,6 +1670,105 @@ ucnv_convert(const char *toConverterName,
              int32_t sourceLength,
              UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Convert many strings from one external charset to another
+ * using two existing converters, like calling ucnv_convertEx() with
+ * reset=true and flush=true for each of them.
+ * This is faster than separate calls when the strings are short,
+ * for example database fields.
+ * As with ucnv_convertEx(), conversions between UTF-8 and many other charsets
+ * convert directly without a UTF-16 pivot.
+ *
+ * The output strings are written one after another into dest, without separators.
+ * destOffsets[i] is set to the index in dest where the output for sources[i] starts,
+ * and destOffsets[count] to the total output length.
+ * The output is NUL-terminated if possible.
+ *
+ * If a string cannot be converted, then the function stops with that error code,
+ * and destOffsets[i] is set only for the strings up to and including that one.
+ *
+ * @param targetCnv output converter, used to convert from the UTF-16 pivot
+ *                  to the target (ucnv_resetFromUnicode() will be called)
+ * @param sourceCnv input converter, used to convert from the source to
+ *                  the UTF-16 pivot (ucnv_resetToUnicode() will be called)
+ * @param dest destination buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of chars available at dest
+ * @param sources the input strings
+ * @param sourceLengths the input string lengths; a length can be -1 if that string is NUL-terminated
+ * @param count the number of input strings
+ * @param destOffsets an array of count+1 output offsets, must not be NULL
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors
+ * @return the total length of the output, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the output will not fit
+ *         and a buffer of the indicated length would need to be passed in;
+ *         the destOffsets are set also in this case
+ * @see ucnv_convertEx
+ * @draft ICU 73
+ */
+U_CAPI int32_t U_EXPORT2
+ucnv_convertBatch(UConverter *targetCnv, UConverter *sourceCnv,
+                  char *dest, int32_t destCapacity,
+                  const char *const *sources, const int32_t *sourceLengths,
+                  int32_t count, int32_t *destOffsets,
+                  UErrorCode *pErrorCode);
+
+/**
+ * Convert a large buffer from one external charset to another
+ * using two existing converters, like ucnv_convertEx() with
+ * reset=true and flush=true, but on several threads.
+ *
+ * If both converters are stateless, then the source is split into up to
+ * threadCount pieces, which are converted concurrently by clones of the converters
+ * and stitched together in dest.
+ * The split points are after C0 control characters (U+0000..U+001F, for example line feeds)
+ * that cannot be part of a multi-byte sequence, so that the output is the same
+ * as from a single conversion.
+ * Stateless converters include UTF-8, UTF-16BE/LE, UTF-32BE/LE, US-ASCII, ISO-8859-1,
+ * and table-based converters other than EBCDIC_STATEFUL ones.
+ * With other converters (for example ISO-2022, SCSU, or UTF-16 with a BOM),
+ * with short input, or if there are no suitable split points,
+ * the conversion runs on the calling thread.
+ *
+ * The converters' callbacks may be called concurrently on several threads,
+ * with the clones as their converter arguments, and must be thread-safe.
+ *
+ * @param targetCnv output converter, used to convert from the UTF-16 pivot
+ *                  to the target (ucnv_resetFromUnicode() will be called)
+ * @param sourceCnv input converter, used to convert from the source to
+ *                  the UTF-16 pivot (ucnv_resetToUnicode() will be called)
+ * @param dest destination buffer, can be NULL if destCapacity==0
+ * @param destCapacity the number of chars available at dest
+ * @param source the input buffer
+ * @param sourceLength the input length, or -1 if NUL-terminated
+ * @param threadCount the maximum number of threads to use, including the calling thread;
+ *                    1 converts on the calling thread only
+ * @param pErrorCode normal ICU error code;
+ *                  common error codes that may be set by this function include
+ *                  U_BUFFER_OVERFLOW_ERROR, U_STRING_NOT_TERMINATED_WARNING,
+ *                  U_ILLEGAL_ARGUMENT_ERROR, and conversion errors;
+ *                  if a conversion error occurs, then it is reported for the first
+ *                  piece where it occurs, and the output and its length are those
+ *                  up to the error
+ * @return the length of the output, not counting the terminating NUL;
+ *         if the length is greater than destCapacity, then the output will not fit
+ *         and a buffer of the indicated length would need to be passed in
+ * @see ucnv_convertEx
+ * @draft ICU 73
+ */
+U_CAPI int32_t U_EXPORT2
+ucnv_convertParallel(UConverter *targetCnv, UConverter *sourceCnv,
+                     char *dest, int32_t destCapacity,
+                     const char *source, int32_t sourceLength,
+                     int32_t threadCount,
+                     UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Convert from one external charset to another.
  * Internally, the text is converted to and from the 16-bit Unicode "pivot"
@@ -0,0 +1,148 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  ucnvpool.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+******************************************************************************
+*/
+
+#ifndef __UCNVPOOL_H__
+#define __UCNVPOOL_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include "unicode/ucnv.h"
+
+#if U_SHOW_CPLUSPLUS_API
+#include "unicode/localpointer.h"
+#endif   // U_SHOW_CPLUSPLUS_API
+
+/**
+ * \file
+ * \brief C API: Pool of reusable converters
+ *
+ * A converter pool keeps converters that are no longer in use
+ * so that they can be handed out again without opening new ones.
+ * Applications that open and close converters for short tasks,
+ * for example once per request, acquire them from a pool instead.
+ *
+ * Once a pool keeps an idle converter for a name, acquiring one with that name
+ * neither looks up the name nor allocates memory.
+ * Idle converters are kept separately for groups of threads, so that
+ * threads rarely wait for each other, and it is best to release
+ * a converter on the thread that acquired it.
+ * Each group of threads keeps idle converters for at most 8 different
+ * converters. A pool is meant for the few converters that an application
+ * uses all the time; converters beyond that are opened and closed as usual.
+ *
+ * The pool keeps the data of each converter it has seen loaded
+ * until the pool is closed, even if ucnv_flushCache() is called.
+ *
+ * All functions are thread-safe.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+struct UConverterPool;
+/**
+ * @{
+ * Typedef for the converter pool data structure.
+ * @draft ICU 73
+ */
+typedef struct UConverterPool UConverterPool;
+/** @} */
+
+/**
+ * Opens an empty converter pool.
+ *
+ * @param status ICU error code.
+ * @return the new pool, or NULL if an error occurred
+ * @draft ICU 73
+ */
+U_CAPI UConverterPool* U_EXPORT2
+ucnvpool_open(UErrorCode *status);
+
+/**
+ * Closes the pool and all of the idle converters that it keeps.
+ * Converters that were acquired but not released are not affected;
+ * close them with ucnv_close().
+ *
+ * @param pool the pool to close. Does nothing if NULL.
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucnvpool_close(UConverterPool *pool);
+
+/**
+ * Returns a converter for the given name, like ucnv_open().
+ * If the pool keeps an idle converter that was acquired with the same name,
+ * then that converter is returned. Otherwise a new one is opened.
+ *
+ * The converter is in the same state as one returned by ucnv_open():
+ * It is reset and has the default callbacks, substitution characters
+ * and fallback behavior.
+ * The caller may change its settings, and must pass it to ucnvpool_release()
+ * or ucnv_close() when it is done with it.
+ *
+ * @param pool the pool
+ * @param converterName the converter name, as for ucnv_open().
+ *        The pool matches names as strings, so for the best reuse
+ *        always acquire the same converter with the same spelling of its name.
+ *        NULL means the default converter, see ucnv_getDefaultName().
+ * @param status ICU error code.
+ * @return the converter, or NULL if an error occurred
+ * @see ucnv_open
+ * @draft ICU 73
+ */
+U_CAPI UConverter* U_EXPORT2
+ucnvpool_acquire(UConverterPool *pool, const char *converterName, UErrorCode *status);
+
+/**
+ * Returns a converter to the pool for reuse.
+ * The pool resets the converter and restores its default callbacks
+ * and fallback behavior.
+ * If the pool already keeps enough idle converters of this kind,
+ * or if the converter's substitution characters or string were changed,
+ * then the converter is closed instead.
+ *
+ * The converter must have been returned by ucnvpool_acquire() for this pool,
+ * and the caller must not use it after this call.
+ *
+ * @param pool the pool
+ * @param cnv the converter to be released. Does nothing if NULL.
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucnvpool_release(UConverterPool *pool, UConverter *cnv);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUConverterPoolPointer
+ * "Smart pointer" class, closes a UConverterPool via ucnvpool_close().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 73
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUConverterPoolPointer, UConverterPool, ucnvpool_close);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // !UCONFIG_NO_CONVERSION
+
+#endif  // __UCNVPOOL_H__
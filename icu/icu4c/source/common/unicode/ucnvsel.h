@@ -188,6 +188,123 @@ U_CAPI UEnumeration * U_EXPORT2
 ucnvsel_selectForUTF8(const UConverterSelector* sel,
                       const char *s, int32_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+
+struct UConverterSelectorStream;
+/**
+ * @{
+ * Typedef for the state of selecting converters for text that arrives in chunks.
+ * @draft ICU 73
+ */
+typedef struct UConverterSelectorStream UConverterSelectorStream;
+/** @} */
+
+/**
+ * Opens a stream for selecting converters that can map all characters
+ * of a text which is passed in several chunks, for example as it is read
+ * from a network connection.
+ * Feeding all chunks of a text and then calling ucnvsel_selectForStream()
+ * gives the same result as calling ucnvsel_selectForString() or ucnvsel_selectForUTF8()
+ * with the whole text, even if a chunk boundary splits a surrogate pair
+ * or a UTF-8 sequence.
+ * Once no converter is left, further chunks are not examined.
+ *
+ * @param sel a selector; must remain valid for the lifetime of the stream
+ * @param status an in/out ICU UErrorCode
+ * @return the new stream
+ *
+ * @draft ICU 73
+ */
+U_CAPI UConverterSelectorStream * U_EXPORT2
+ucnvsel_openStream(const UConverterSelector* sel, UErrorCode *status);
+
+/**
+ * Closes a stream opened with ucnvsel_openStream().
+ *
+ * @param stream the stream to close; can be NULL
+ *
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_closeStream(UConverterSelectorStream *stream);
+
+/**
+ * Resets a stream so that it can be used for a new text.
+ *
+ * @param stream the stream
+ *
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_resetStream(UConverterSelectorStream *stream);
+
+/**
+ * Passes the next chunk of a UTF-16 text to the stream.
+ * Do not mix UTF-16 and UTF-8 chunks for the same text.
+ *
+ * @param stream the stream
+ * @param s UTF-16 chunk
+ * @param length length of the chunk, or -1 if NUL-terminated
+ * @param status an in/out ICU UErrorCode
+ *
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_streamString(UConverterSelectorStream *stream,
+                     const UChar *s, int32_t length, UErrorCode *status);
+
+/**
+ * Passes the next chunk of a UTF-8 text to the stream.
+ * Do not mix UTF-16 and UTF-8 chunks for the same text.
+ *
+ * @param stream the stream
+ * @param s UTF-8 chunk
+ * @param length length of the chunk, or -1 if NUL-terminated
+ * @param status an in/out ICU UErrorCode
+ *
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_streamUTF8(UConverterSelectorStream *stream,
+                   const char *s, int32_t length, UErrorCode *status);
+
+/**
+ * Select converters that can map all characters of the text
+ * passed to the stream so far, ignoring the excluded code points.
+ * The stream is not modified; more chunks can be passed after this call.
+ *
+ * @param stream the stream
+ * @param status an in/out ICU UErrorCode
+ * @return an enumeration containing encoding names.
+ *         The returned encoding names and their order will be the same as
+ *         supplied when building the selector.
+ *
+ * @draft ICU 73
+ */
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_selectForStream(const UConverterSelectorStream *stream, UErrorCode *status);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUConverterSelectorStreamPointer
+ * "Smart pointer" class, closes a UConverterSelectorStream via ucnvsel_closeStream().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 73
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUConverterSelectorStreamPointer, UConverterSelectorStream, ucnvsel_closeStream);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  // U_HIDE_DRAFT_API
+
 #endif  /* !UCONFIG_NO_CONVERSION */
 
 #endif  /* __ICU_UCNV_SEL_H__ */
@@ -416,6 +416,58 @@ typedef enum UDataFileAccess {
 U_CAPI void U_EXPORT2
 udata_setFileAccess(UDataFileAccess access, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Option bits for udata_preload().
+ * @see udata_preload
+ * @draft ICU 73
+ */
+typedef enum UDataPreloadOption {
+    /**
+     * Ask the operating system to back the preloaded data with huge pages,
+     * to reduce TLB misses when accessing it. This is only a hint. It is
+     * ignored where huge pages are not supported for the memory that holds
+     * the data, for example for memory-mapped files on most file systems.
+     * @draft ICU 73
+     */
+    UDATA_PRELOAD_HUGE_PAGES = 1
+} UDataPreloadOption;
+
+/**
+ * Loads ICU common data into memory ahead of its use, so that the first
+ * services that use it do not wait for the operating system to page it in.
+ * This is most useful when the ICU data is memory-mapped from a file,
+ * right after process startup.
+ *
+ * The items to preload are selected by name patterns that are matched
+ * against the names of the items in the ICU data packages, without the
+ * package name, for example "coll/root.res" or "brkitr/word.brk".
+ * A pattern that ends with '/' selects all items in that tree.
+ * An asterisk '*' in a pattern matches any sequence of characters other
+ * than '/'. For example,
+ * - "coll/" selects the collation data,
+ * - "*.res" selects the locale data at the top level of the package,
+ * - "uprops.icu" selects just the character properties.
+ *
+ * This function blocks until the selected data has been touched. An
+ * application that does not want to wait can call it on a thread of its
+ * own. It is thread-safe, and other ICU functions can be used concurrently.
+ *
+ * @param patterns     array of item name patterns, or NULL to preload all
+ *                     ICU data.
+ * @param patternCount number of patterns; ignored if patterns is NULL.
+ * @param options      a bit set of UDataPreloadOption values, or 0.
+ * @param status       ICU error code. Set to U_ILLEGAL_ARGUMENT_ERROR if
+ *                     patternCount is negative.
+ * @return the number of bytes of ICU data that were touched, rounded
+ *         up to whole memory pages.
+ * @draft ICU 73
+ */
+U_CAPI int64_t U_EXPORT2
+udata_preload(const char * const *patterns, int32_t patternCount,
+              int32_t options, UErrorCode *status);
+#endif  // U_HIDE_DRAFT_API
+
 U_CDECL_END
 
 #if U_SHOW_CPLUSPLUS_API
@@ -266,6 +266,7 @@
 #define u_fungetc U_ICU_ENTRY_POINT_RENAME(u_fungetc)
 #define u_getBidiPairedBracket U_ICU_ENTRY_POINT_RENAME(u_getBidiPairedBracket)
 #define u_getBinaryPropertySet U_ICU_ENTRY_POINT_RENAME(u_getBinaryPropertySet)
+#define u_getCategoryInitTime U_ICU_ENTRY_POINT_RENAME(u_getCategoryInitTime)
 #define u_getCombiningClass U_ICU_ENTRY_POINT_RENAME(u_getCombiningClass)
 #define u_getDataDirectory U_ICU_ENTRY_POINT_RENAME(u_getDataDirectory)
 #define u_getDataVersion U_ICU_ENTRY_POINT_RENAME(u_getDataVersion)
@@ -289,6 +290,7 @@
 #define u_get_stdout U_ICU_ENTRY_POINT_RENAME(u_get_stdout)
 #define u_hasBinaryProperty U_ICU_ENTRY_POINT_RENAME(u_hasBinaryProperty)
 #define u_init U_ICU_ENTRY_POINT_RENAME(u_init)
+#define u_initCategories U_ICU_ENTRY_POINT_RENAME(u_initCategories)
 #define u_isIDIgnorable U_ICU_ENTRY_POINT_RENAME(u_isIDIgnorable)
 #define u_isIDPart U_ICU_ENTRY_POINT_RENAME(u_isIDPart)
 #define u_isIDStart U_ICU_ENTRY_POINT_RENAME(u_isIDStart)
@@ -411,6 +413,7 @@
 #define u_uastrncpy U_ICU_ENTRY_POINT_RENAME(u_uastrncpy)
 #define u_unescape U_ICU_ENTRY_POINT_RENAME(u_unescape)
 #define u_unescapeAt U_ICU_ENTRY_POINT_RENAME(u_unescapeAt)
+#define u_validateUTF8 U_ICU_ENTRY_POINT_RENAME(u_validateUTF8)
 #define u_versionFromString U_ICU_ENTRY_POINT_RENAME(u_versionFromString)
 #define u_versionFromUString U_ICU_ENTRY_POINT_RENAME(u_versionFromUString)
 #define u_versionToString U_ICU_ENTRY_POINT_RENAME(u_versionToString)
@@ -513,8 +516,17 @@
 #define ubrk_setUText U_ICU_ENTRY_POINT_RENAME(ubrk_setUText)
 #define ubrk_swap U_ICU_ENTRY_POINT_RENAME(ubrk_swap)
 #define ucache_compareKeys U_ICU_ENTRY_POINT_RENAME(ucache_compareKeys)
+#define ucache_countKeyTypes U_ICU_ENTRY_POINT_RENAME(ucache_countKeyTypes)
 #define ucache_deleteKey U_ICU_ENTRY_POINT_RENAME(ucache_deleteKey)
+#define ucache_getByteCount U_ICU_ENTRY_POINT_RENAME(ucache_getByteCount)
+#define ucache_getEntryCount U_ICU_ENTRY_POINT_RENAME(ucache_getEntryCount)
+#define ucache_getEvictionCount U_ICU_ENTRY_POINT_RENAME(ucache_getEvictionCount)
+#define ucache_getKeyTypeName U_ICU_ENTRY_POINT_RENAME(ucache_getKeyTypeName)
+#define ucache_getKeyTypeStatistic U_ICU_ENTRY_POINT_RENAME(ucache_getKeyTypeStatistic)
+#define ucache_getMemoryLimit U_ICU_ENTRY_POINT_RENAME(ucache_getMemoryLimit)
 #define ucache_hashKeys U_ICU_ENTRY_POINT_RENAME(ucache_hashKeys)
+#define ucache_resetStatistics U_ICU_ENTRY_POINT_RENAME(ucache_resetStatistics)
+#define ucache_setMemoryLimit U_ICU_ENTRY_POINT_RENAME(ucache_setMemoryLimit)
 #define ucal_add U_ICU_ENTRY_POINT_RENAME(ucal_add)
 #define ucal_clear U_ICU_ENTRY_POINT_RENAME(ucal_clear)
 #define ucal_clearField U_ICU_ENTRY_POINT_RENAME(ucal_clearField)
@@ -621,6 +633,7 @@
 #define ucnv_MBCSGetType U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSGetType)
 #define ucnv_MBCSGetUnicodeSetForUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSGetUnicodeSetForUnicode)
 #define ucnv_MBCSIsLeadByte U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSIsLeadByte)
+#define ucnv_MBCSIsSplitByte U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSIsSplitByte)
 #define ucnv_MBCSSimpleGetNextUChar U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSSimpleGetNextUChar)
 #define ucnv_MBCSToUnicodeWithOffsets U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSToUnicodeWithOffsets)
 #define ucnv_bld_countAvailableConverters U_ICU_ENTRY_POINT_RENAME(ucnv_bld_countAvailableConverters)
@@ -635,7 +648,9 @@
 #define ucnv_close U_ICU_ENTRY_POINT_RENAME(ucnv_close)
 #define ucnv_compareNames U_ICU_ENTRY_POINT_RENAME(ucnv_compareNames)
 #define ucnv_convert U_ICU_ENTRY_POINT_RENAME(ucnv_convert)
+#define ucnv_convertBatch U_ICU_ENTRY_POINT_RENAME(ucnv_convertBatch)
 #define ucnv_convertEx U_ICU_ENTRY_POINT_RENAME(ucnv_convertEx)
+#define ucnv_convertParallel U_ICU_ENTRY_POINT_RENAME(ucnv_convertParallel)
 #define ucnv_countAliases U_ICU_ENTRY_POINT_RENAME(ucnv_countAliases)
 #define ucnv_countAvailable U_ICU_ENTRY_POINT_RENAME(ucnv_countAvailable)
 #define ucnv_countStandards U_ICU_ENTRY_POINT_RENAME(ucnv_countStandards)
@@ -656,6 +671,7 @@
 #define ucnv_flushCache U_ICU_ENTRY_POINT_RENAME(ucnv_flushCache)
 #define ucnv_fromAlgorithmic U_ICU_ENTRY_POINT_RENAME(ucnv_fromAlgorithmic)
 #define ucnv_fromUChars U_ICU_ENTRY_POINT_RENAME(ucnv_fromUChars)
+#define ucnv_fromUCharsBatch U_ICU_ENTRY_POINT_RENAME(ucnv_fromUCharsBatch)
 #define ucnv_fromUCountPending U_ICU_ENTRY_POINT_RENAME(ucnv_fromUCountPending)
 #define ucnv_fromUWriteBytes U_ICU_ENTRY_POINT_RENAME(ucnv_fromUWriteBytes)
 #define ucnv_fromUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_fromUnicode)
@@ -686,6 +702,7 @@
 #define ucnv_getType U_ICU_ENTRY_POINT_RENAME(ucnv_getType)
 #define ucnv_getUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_getUnicodeSet)
 #define ucnv_incrementRefCount U_ICU_ENTRY_POINT_RENAME(ucnv_incrementRefCount)
+#define ucnv_internalConvert U_ICU_ENTRY_POINT_RENAME(ucnv_internalConvert)
 #define ucnv_io_countKnownConverters U_ICU_ENTRY_POINT_RENAME(ucnv_io_countKnownConverters)
 #define ucnv_io_getConverterName U_ICU_ENTRY_POINT_RENAME(ucnv_io_getConverterName)
 #define ucnv_io_stripASCIIForCompare U_ICU_ENTRY_POINT_RENAME(ucnv_io_stripASCIIForCompare)
@@ -714,6 +731,7 @@
 #define ucnv_swapAliases U_ICU_ENTRY_POINT_RENAME(ucnv_swapAliases)
 #define ucnv_toAlgorithmic U_ICU_ENTRY_POINT_RENAME(ucnv_toAlgorithmic)
 #define ucnv_toUChars U_ICU_ENTRY_POINT_RENAME(ucnv_toUChars)
+#define ucnv_toUCharsBatch U_ICU_ENTRY_POINT_RENAME(ucnv_toUCharsBatch)
 #define ucnv_toUCountPending U_ICU_ENTRY_POINT_RENAME(ucnv_toUCountPending)
 #define ucnv_toUWriteCodePoint U_ICU_ENTRY_POINT_RENAME(ucnv_toUWriteCodePoint)
 #define ucnv_toUWriteUChars U_ICU_ENTRY_POINT_RENAME(ucnv_toUWriteUChars)
@@ -721,12 +739,22 @@
 #define ucnv_unload U_ICU_ENTRY_POINT_RENAME(ucnv_unload)
 #define ucnv_unloadSharedDataIfReady U_ICU_ENTRY_POINT_RENAME(ucnv_unloadSharedDataIfReady)
 #define ucnv_usesFallback U_ICU_ENTRY_POINT_RENAME(ucnv_usesFallback)
+#define ucnvpool_acquire U_ICU_ENTRY_POINT_RENAME(ucnvpool_acquire)
+#define ucnvpool_close U_ICU_ENTRY_POINT_RENAME(ucnvpool_close)
+#define ucnvpool_open U_ICU_ENTRY_POINT_RENAME(ucnvpool_open)
+#define ucnvpool_release U_ICU_ENTRY_POINT_RENAME(ucnvpool_release)
 #define ucnvsel_close U_ICU_ENTRY_POINT_RENAME(ucnvsel_close)
+#define ucnvsel_closeStream U_ICU_ENTRY_POINT_RENAME(ucnvsel_closeStream)
 #define ucnvsel_open U_ICU_ENTRY_POINT_RENAME(ucnvsel_open)
 #define ucnvsel_openFromSerialized U_ICU_ENTRY_POINT_RENAME(ucnvsel_openFromSerialized)
+#define ucnvsel_openStream U_ICU_ENTRY_POINT_RENAME(ucnvsel_openStream)
+#define ucnvsel_resetStream U_ICU_ENTRY_POINT_RENAME(ucnvsel_resetStream)
+#define ucnvsel_selectForStream U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForStream)
 #define ucnvsel_selectForString U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForString)
 #define ucnvsel_selectForUTF8 U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8)
 #define ucnvsel_serialize U_ICU_ENTRY_POINT_RENAME(ucnvsel_serialize)
+#define ucnvsel_streamString U_ICU_ENTRY_POINT_RENAME(ucnvsel_streamString)
+#define ucnvsel_streamUTF8 U_ICU_ENTRY_POINT_RENAME(ucnvsel_streamUTF8)
 #define ucol_clone U_ICU_ENTRY_POINT_RENAME(ucol_clone)
 #define ucol_cloneBinary U_ICU_ENTRY_POINT_RENAME(ucol_cloneBinary)
 #define ucol_close U_ICU_ENTRY_POINT_RENAME(ucol_close)
@@ -809,6 +837,7 @@
 #define ucptrie_openFromBinary U_ICU_ENTRY_POINT_RENAME(ucptrie_openFromBinary)
 #define ucptrie_swap U_ICU_ENTRY_POINT_RENAME(ucptrie_swap)
 #define ucptrie_toBinary U_ICU_ENTRY_POINT_RENAME(ucptrie_toBinary)
+#define ucsdet_appendText U_ICU_ENTRY_POINT_RENAME(ucsdet_appendText)
 #define ucsdet_close U_ICU_ENTRY_POINT_RENAME(ucsdet_close)
 #define ucsdet_detect U_ICU_ENTRY_POINT_RENAME(ucsdet_detect)
 #define ucsdet_detectAll U_ICU_ENTRY_POINT_RENAME(ucsdet_detectAll)
@@ -890,6 +919,7 @@
 #define udata_openChoice U_ICU_ENTRY_POINT_RENAME(udata_openChoice)
 #define udata_openSwapper U_ICU_ENTRY_POINT_RENAME(udata_openSwapper)
 #define udata_openSwapperForInputData U_ICU_ENTRY_POINT_RENAME(udata_openSwapperForInputData)
+#define udata_preload U_ICU_ENTRY_POINT_RENAME(udata_preload)
 #define udata_printError U_ICU_ENTRY_POINT_RENAME(udata_printError)
 #define udata_readInt16 U_ICU_ENTRY_POINT_RENAME(udata_readInt16)
 #define udata_readInt32 U_ICU_ENTRY_POINT_RENAME(udata_readInt32)
@@ -1795,6 +1825,7 @@
 #define ustr_hashCharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashCharsN)
 #define ustr_hashICharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashICharsN)
 #define ustr_hashUCharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashUCharsN)
+#define ustr_spanWellFormedUTF8 U_ICU_ENTRY_POINT_RENAME(ustr_spanWellFormedUTF8)
 #define ustrcase_getCaseLocale U_ICU_ENTRY_POINT_RENAME(ustrcase_getCaseLocale)
 #define ustrcase_getTitleBreakIterator U_ICU_ENTRY_POINT_RENAME(ustrcase_getTitleBreakIterator)
 #define ustrcase_internalFold U_ICU_ENTRY_POINT_RENAME(ustrcase_internalFold)
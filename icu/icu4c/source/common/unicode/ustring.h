@@ -1446,6 +1446,36 @@ u_strFromUTF8Lenient(UChar *dest,
                      int32_t srcLength,
                      UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Check whether a string is well-formed UTF-8, and find its first ill-formed
+ * byte sequence if it is not.
+ *
+ * This is faster than converting the string with u_strFromUTF8() only to detect
+ * errors, and it does not need a destination buffer.
+ * A byte sequence is ill-formed where U8_NEXT() would return a negative value:
+ * for example a non-shortest form, a surrogate code point, a code point above
+ * U+10FFFF, or a sequence that is truncated by the end of the string.
+ *
+ * @param src           The UTF-8 string to check.
+ * @param srcLength     The length of the string. If -1, then src must be zero-terminated.
+ * @param pNumCodePoints If not NULL, receives the number of code points before
+ *                      the first ill-formed sequence, which is the number of
+ *                      code points in the whole string if it is well-formed.
+ * @param pErrorCode    Pointer to a standard ICU error code. Its input value must
+ *                      pass the U_SUCCESS() test, or else the function returns
+ *                      immediately. Check for U_FAILURE() on output or use with
+ *                      function chaining. (See User Guide for details.)
+ * @return The index of the first byte of the first ill-formed sequence,
+ *         or -1 if the string is well-formed or if an error occurred.
+ * @see u_strFromUTF8
+ * @draft ICU 73
+ */
+U_CAPI int32_t U_EXPORT2
+u_validateUTF8(const char *src, int32_t srcLength,
+               int32_t *pNumCodePoints, UErrorCode *pErrorCode);
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Convert a UTF-16 string to UTF-32.
  * If the input string is not well-formed, then the U_INVALID_CHAR_FOUND error code is set.
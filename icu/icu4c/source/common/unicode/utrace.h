@@ -67,6 +67,18 @@ typedef enum UTraceFunctionNumber {
     UTRACE_U_INIT=UTRACE_FUNCTION_START,
     UTRACE_U_CLEANUP,
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Indicates that u_initCategories() initialized one category of singletons.
+     * The trace exit carries the status of the initialization.
+     *
+     * Provides one C-style string to UTraceData: the category name.
+     *
+     * @draft ICU 73
+     */
+    UTRACE_U_INIT_CATEGORY,
+#endif  // U_HIDE_DRAFT_API
+
 #ifndef U_HIDE_DEPRECATED_API
     /**
      * One more than the highest normal collation trace location.
@@ -235,6 +247,63 @@ typedef enum UTraceFunctionNumber {
     UTRACE_UBRK_LIMIT,
 #endif  // U_HIDE_INTERNAL_API
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * The lowest cache location.
+     * @draft ICU 73
+     */
+    UTRACE_UCACHE_START=0x5000,
+
+    /**
+     * Indicates that an object was created on a miss in ICU's cache of locale
+     * data objects. The trace exit carries the status of the creation.
+     *
+     * Provides two C-style strings to UTraceData: the key type name and
+     * the key description, such as the locale ID.
+     *
+     * @draft ICU 73
+     */
+    UTRACE_UCACHE_CREATE_OBJECT = UTRACE_UCACHE_START,
+
+    /**
+     * Indicates that a cache lookup waited for another thread to create
+     * the same object.
+     *
+     * Provides two C-style strings and one int64_t to UTraceData: the key
+     * type name, the key description, and the wait time in nanoseconds.
+     *
+     * @draft ICU 73
+     */
+    UTRACE_UCACHE_WAIT,
+
+    /**
+     * Indicates that the cache ran an eviction slice to honor its limit
+     * on unused entries. The trace exit carries the number of evicted entries.
+     *
+     * @draft ICU 73
+     */
+    UTRACE_UCACHE_EVICTION_SLICE,
+
+    /**
+     * Indicates that the cache evicted entries to honor its memory limit.
+     *
+     * Provides the number of bytes over the limit and the limit as int64_t
+     * values to UTraceData, followed by the number of bytes used after
+     * eviction.
+     *
+     * @draft ICU 73
+     */
+    UTRACE_UCACHE_MEMORY_EVICTION,
+#endif  // U_HIDE_DRAFT_API
+
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * One more than the highest normal cache trace location.
+     * @internal The numeric value may change over time, see ICU ticket #12420.
+     */
+    UTRACE_UCACHE_LIMIT,
+#endif  // U_HIDE_INTERNAL_API
+
 } UTraceFunctionNumber;
 
 /**
@@ -13,20 +13,41 @@
 #include "unifiedcache.h"
 
 #include <algorithm>      // For std::max()
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 
+#include "unicode/ucache.h"
+#include "cmemory.h"
+#include "uarrsort.h"
 #include "uassert.h"
 #include "uhash.h"
 #include "ucln_cmn.h"
+#include "mutex.h"
+#include "utracimp.h"
 
 static icu::UnifiedCache *gCache = NULL;
-static std::mutex *gCacheMutex = nullptr;
-static std::condition_variable *gInProgressValueAddedCond;
 static icu::UInitOnce gCacheInitOnce {};
 
 static const int32_t MAX_EVICT_ITERATIONS = 10;
+// Evicting the non-primary keys of a value can make its primary key
+// evictable, so memory limit enforcement may take more than one round.
+static const int32_t MAX_MEMORY_EVICT_ROUNDS = 4;
+// Returned by _computeMemoryEvictionCutoff() when it cannot pick entries.
+// Every entry has a last access time of at least 0.
+static const int64_t NO_MEMORY_EVICTION_CUTOFF = -1;
 static const int32_t DEFAULT_MAX_UNUSED = 1000;
 static const int32_t DEFAULT_PERCENTAGE_OF_IN_USE = 100;
+static const int32_t MAX_DESCRIPTION_LENGTH = 100;
+
+// Name of the statistics entry shared by key types that do not fit in the table.
+static const char OTHER_KEY_TYPES[] = "(other)";
+
+// Guards the registration of new key types.
+static icu::UMutex gKeyTypesMutex;
+
+static_assert((UNIFIED_CACHE_SHARD_COUNT & (UNIFIED_CACHE_SHARD_COUNT - 1)) == 0,
+              "UNIFIED_CACHE_SHARD_COUNT must be a power of two");
 
 
 U_CDECL_BEGIN
@@ -34,10 +55,6 @@ static UBool U_CALLCONV unifiedcache_cleanup() {
     gCacheInitOnce.reset();
     delete gCache;
     gCache = nullptr;
-    gCacheMutex->~mutex();
-    gCacheMutex = nullptr;
-    gInProgressValueAddedCond->~condition_variable();
-    gInProgressValueAddedCond = nullptr;
     return true;
 }
 U_CDECL_END
@@ -45,6 +62,44 @@ U_CDECL_END
 
 U_NAMESPACE_BEGIN
 
+/**
+ * One independently locked partition of the UnifiedCache.
+ * All access to hashtable, evictPos and stats is synchronized by mutex.
+ */
+struct UnifiedCacheShard : public UMemory {
+    std::mutex mutex;
+    std::condition_variable inProgressValueAddedCond;
+    UHashtable *hashtable = nullptr;
+    int32_t evictPos = UHASH_FIRST;
+    UnifiedCacheKeyTypeStats stats[UNIFIED_CACHE_MAX_KEY_TYPES] = {};
+};
+
+namespace {
+
+int64_t nanosSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+}
+
+// Traces that a lookup of key waited for nanos for another thread to create
+// the value.
+void traceWait(const CacheKeyBase &key, int64_t nanos) {
+#if U_ENABLE_TRACING
+    if (UTRACE_LEVEL(UTRACE_INFO)) {
+        UTRACE_ENTRY(UTRACE_UCACHE_WAIT);
+        char buffer[MAX_DESCRIPTION_LENGTH];
+        UTRACE_DATA3(UTRACE_INFO, "%s %s waited %l ns", key.typeName(),
+                     key.writeDescription(buffer, MAX_DESCRIPTION_LENGTH), nanos);
+        UTRACE_EXIT();
+    }
+#else
+    (void)key;
+    (void)nanos;
+#endif
+}
+
+}  // namespace
+
 int32_t U_EXPORT2
 ucache_hashKeys(const UHashTok key) {
     const CacheKeyBase *ckey = (const CacheKeyBase *) key.pointer;
@@ -72,8 +127,6 @@ static void U_CALLCONV cacheInit(UErrorCode &status) {
     ucln_common_registerCleanup(
             UCLN_COMMON_UNIFIED_CACHE, unifiedcache_cleanup);
 
-    gCacheMutex = STATIC_NEW(std::mutex);
-    gInProgressValueAddedCond = STATIC_NEW(std::condition_variable);
     gCache = new UnifiedCache(status);
     if (gCache == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -95,13 +148,22 @@ UnifiedCache *UnifiedCache::getInstance(UErrorCode &status) {
 }
 
 UnifiedCache::UnifiedCache(UErrorCode &status) :
-        fHashtable(NULL),
-        fEvictPos(UHASH_FIRST),
+        fShards(nullptr),
+        fEvictShard(0),
+        fNumItems(0),
         fNumValuesTotal(0),
         fNumValuesInUse(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
         fMaxPercentageOfInUse(DEFAULT_PERCENTAGE_OF_IN_USE),
         fAutoEvictedCount(0),
+        fNumBytes(0),
+        fMaxBytes(0),
+        fAccessClock(0),
+        fEvictingToMemoryLimit(false),
+        fReleaseCount(0),
+        fMemoryEvictionStalledAt(-1),
+        fKeyTypeNames(),
+        fKeyTypeCount(0),
         fNoValue(nullptr) {
     if (U_FAILURE(status)) {
         return;
@@ -115,15 +177,30 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
     fNoValue->cachePtr = this;
 
-    fHashtable = uhash_open(
-            &ucache_hashKeys,
-            &ucache_compareKeys,
-            NULL,
-            &status);
-    if (U_FAILURE(status)) {
+    fShards = new UnifiedCacheShard[UNIFIED_CACHE_SHARD_COUNT];
+    if (fShards == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
-    uhash_setKeyDeleter(fHashtable, &ucache_deleteKey);
+    for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+        fShards[i].hashtable = uhash_open(
+                &ucache_hashKeys,
+                &ucache_compareKeys,
+                NULL,
+                &status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        uhash_setKeyDeleter(fShards[i].hashtable, &ucache_deleteKey);
+    }
+}
+
+UnifiedCacheShard &UnifiedCache::_shardFor(const CacheKeyBase &key) const {
+    // The low bits of key hash codes are poorly distributed for short
+    // locale IDs, so fold in the high bits before picking the shard.
+    uint32_t hash = (uint32_t) key.hashCode();
+    hash ^= hash >> 16;
+    return fShards[hash & (UNIFIED_CACHE_SHARD_COUNT - 1)];
 }
 
 void UnifiedCache::setEvictionPolicy(
@@ -135,39 +212,129 @@ void UnifiedCache::setEvictionPolicy(
         status = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    fMaxUnused = count;
-    fMaxPercentageOfInUse = percentageOfInUseItems;
+    umtx_storeRelease(fMaxUnused, count);
+    umtx_storeRelease(fMaxPercentageOfInUse, percentageOfInUseItems);
+}
+
+void UnifiedCache::setMemoryLimit(int64_t maxBytes, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (maxBytes < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fMaxBytes.store(maxBytes);
+    fMemoryEvictionStalledAt.store(-1);
+    _evictToMemoryLimit();
+}
+
+int64_t UnifiedCache::memoryLimit() const {
+    return fMaxBytes.load();
+}
+
+int64_t UnifiedCache::byteCount() const {
+    return fNumBytes.load();
 }
 
 int32_t UnifiedCache::unusedCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return uhash_count(fHashtable) - fNumValuesInUse;
+    return umtx_loadAcquire(fNumItems) - umtx_loadAcquire(fNumValuesInUse);
 }
 
 int64_t UnifiedCache::autoEvictedCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return fAutoEvictedCount;
+    return fAutoEvictedCount.load();
 }
 
 int32_t UnifiedCache::keyCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return uhash_count(fHashtable);
+    return umtx_loadAcquire(fNumItems);
 }
 
-void UnifiedCache::flush() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
+int32_t UnifiedCache::keyTypeCount() const {
+    return umtx_loadAcquire(fKeyTypeCount);
+}
+
+const char *UnifiedCache::keyTypeName(int32_t index) const {
+    if (index < 0 || index >= umtx_loadAcquire(fKeyTypeCount)) {
+        return nullptr;
+    }
+    return fKeyTypeNames[index];
+}
+
+void UnifiedCache::keyTypeStats(int32_t index, UnifiedCacheKeyTypeStats &stats) const {
+    stats = UnifiedCacheKeyTypeStats();
+    if (index < 0 || index >= umtx_loadAcquire(fKeyTypeCount)) {
+        return;
+    }
+    for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(fShards[i].mutex);
+        const UnifiedCacheKeyTypeStats &shardStats = fShards[i].stats[index];
+        stats.hits += shardStats.hits;
+        stats.misses += shardStats.misses;
+        stats.waits += shardStats.waits;
+        stats.waitNanos += shardStats.waitNanos;
+        stats.creationNanos += shardStats.creationNanos;
+        stats.maxCreationNanos = std::max(stats.maxCreationNanos, shardStats.maxCreationNanos);
+        stats.evictions += shardStats.evictions;
+    }
+}
 
+void UnifiedCache::resetStats() const {
+    for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(fShards[i].mutex);
+        for (UnifiedCacheKeyTypeStats &stats : fShards[i].stats) {
+            stats = UnifiedCacheKeyTypeStats();
+        }
+    }
+}
+
+int32_t UnifiedCache::_keyTypeIndex(const char *typeName) const {
+    // Type names normally are unique strings, so comparing pointers usually
+    // suffices, but the same type can have different copies of its name in
+    // different libraries.
+    int32_t count = umtx_loadAcquire(fKeyTypeCount);
+    for (int32_t i = 0; i < count; ++i) {
+        if (fKeyTypeNames[i] == typeName || uprv_strcmp(fKeyTypeNames[i], typeName) == 0) {
+            return i;
+        }
+    }
+    Mutex lock(&gKeyTypesMutex);
+    int32_t newCount = umtx_loadAcquire(fKeyTypeCount);
+    for (int32_t i = count; i < newCount; ++i) {
+        if (uprv_strcmp(fKeyTypeNames[i], typeName) == 0) {
+            return i;
+        }
+    }
+    count = newCount;
+    if (count == UNIFIED_CACHE_MAX_KEY_TYPES) {
+        return UNIFIED_CACHE_MAX_KEY_TYPES - 1;
+    }
+    fKeyTypeNames[count] =
+            count == UNIFIED_CACHE_MAX_KEY_TYPES - 1 ? OTHER_KEY_TYPES : typeName;
+    umtx_storeRelease(fKeyTypeCount, count + 1);
+    return count;
+}
+
+void UnifiedCache::flush() const {
     // Use a loop in case cache items that are flushed held hard references to
     // other cache items making those additional cache items eligible for
-    // flushing.
-    while (_flush(false));
+    // flushing. Those other items may live in any shard.
+    UBool flushed;
+    do {
+        flushed = false;
+        for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+            std::lock_guard<std::mutex> lock(fShards[i].mutex);
+            if (_flush(fShards[i], false)) {
+                flushed = true;
+            }
+        }
+    } while (flushed);
 }
 
 void UnifiedCache::handleUnreferencedObject() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    --fNumValuesInUse;
+    umtx_atomic_dec(&fNumValuesInUse);
+    ++fReleaseCount;
     _runEvictionSlice();
+    _evictToMemoryLimit();
 }
 
 #ifdef UNIFIED_CACHE_DEBUG
@@ -184,19 +351,24 @@ void UnifiedCache::dump() {
 }
 
 void UnifiedCache::dumpContents() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    _dumpContents();
+    int32_t cnt = 0;
+    for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(fShards[i].mutex);
+        cnt += _dumpContents(fShards[i]);
+    }
+    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, keyCount());
 }
 
-// Dumps content of cache.
-// On entry, gCacheMutex must be held.
-// On exit, cache contents dumped to stderr.
-void UnifiedCache::_dumpContents() const {
+// Dumps content of one cache shard.
+// On entry, the shard's mutex must be held.
+// On exit, shard contents dumped to stderr. Returns the number of entries
+// whose values still have hard references.
+int32_t UnifiedCache::_dumpContents(UnifiedCacheShard &shard) const {
     int32_t pos = UHASH_FIRST;
-    const UHashElement *element = uhash_nextElement(fHashtable, &pos);
+    const UHashElement *element = uhash_nextElement(shard.hashtable, &pos);
     char buffer[256];
     int32_t cnt = 0;
-    for (; element != NULL; element = uhash_nextElement(fHashtable, &pos)) {
+    for (; element != NULL; element = uhash_nextElement(shard.hashtable, &pos)) {
         const SharedObject *sharedObject =
                 (const SharedObject *) element->value.pointer;
         const CacheKeyBase *key =
@@ -207,56 +379,80 @@ void UnifiedCache::_dumpContents() const {
                     stderr,
                     "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
                     key->writeDescription(buffer, 256),
-                    key->creationStatus,
+                    key->fCreationStatus,
                     sharedObject == fNoValue ? NULL :sharedObject,
                     sharedObject->getRefCount(),
-                    sharedObject->getSoftRefCount());
+                    umtx_loadAcquire(sharedObject->softRefCount));
         }
     }
-    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(fHashtable));
+    return cnt;
 }
 #endif
 
 UnifiedCache::~UnifiedCache() {
-    // Try our best to clean up first.
-    flush();
-    {
+    if (fShards != nullptr) {
+        // Try our best to clean up first.
+        flush();
         // Now all that should be left in the cache are entries that refer to
         // each other and entries with hard references from outside the cache.
         // Nothing we can do about these so proceed to wipe out the cache.
-        std::lock_guard<std::mutex> lock(*gCacheMutex);
-        _flush(true);
+        for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+            {
+                std::lock_guard<std::mutex> lock(fShards[i].mutex);
+                _flush(fShards[i], true);
+            }
+            uhash_close(fShards[i].hashtable);
+            fShards[i].hashtable = nullptr;
+        }
+        delete[] fShards;
+        fShards = nullptr;
     }
-    uhash_close(fHashtable);
-    fHashtable = nullptr;
     delete fNoValue;
     fNoValue = nullptr;
 }
 
 const UHashElement *
-UnifiedCache::_nextElement() const {
-    const UHashElement *element = uhash_nextElement(fHashtable, &fEvictPos);
+UnifiedCache::_nextElement(UnifiedCacheShard &shard) const {
+    const UHashElement *element = uhash_nextElement(shard.hashtable, &shard.evictPos);
     if (element == NULL) {
-        fEvictPos = UHASH_FIRST;
-        return uhash_nextElement(fHashtable, &fEvictPos);
+        shard.evictPos = UHASH_FIRST;
+        return uhash_nextElement(shard.hashtable, &shard.evictPos);
     }
     return element;
 }
 
-UBool UnifiedCache::_flush(UBool all) const {
+void UnifiedCache::_removeElement(
+        UnifiedCacheShard &shard, const UHashElement *element) const {
+    const SharedObject *sharedObject =
+            (const SharedObject *) element->value.pointer;
+    U_ASSERT(sharedObject->cachePtr == this);
+    uhash_removeElement(shard.hashtable, element);
+    umtx_atomic_dec(&fNumItems);
+    ++fReleaseCount;
+    removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
+}
+
+void UnifiedCache::_evict(
+        UnifiedCacheShard &shard, const UHashElement *element) const {
+    const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+    ++shard.stats[theKey->fTypeIndex].evictions;
+    _removeElement(shard, element);
+    ++fAutoEvictedCount;
+}
+
+UBool UnifiedCache::_flush(UnifiedCacheShard &shard, UBool all) const {
     UBool result = false;
-    int32_t origSize = uhash_count(fHashtable);
+    if (shard.hashtable == nullptr) {
+        return result;
+    }
+    int32_t origSize = uhash_count(shard.hashtable);
     for (int32_t i = 0; i < origSize; ++i) {
-        const UHashElement *element = _nextElement();
+        const UHashElement *element = _nextElement(shard);
         if (element == nullptr) {
             break;
         }
         if (all || _isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            U_ASSERT(sharedObject->cachePtr == this);
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
+            _removeElement(shard, element);
             result = true;
         }
     }
@@ -264,11 +460,13 @@ UBool UnifiedCache::_flush(UBool all) const {
 }
 
 int32_t UnifiedCache::_computeCountOfItemsToEvict() const {
-    int32_t totalItems = uhash_count(fHashtable);
-    int32_t evictableItems = totalItems - fNumValuesInUse;
+    int32_t totalItems = umtx_loadAcquire(fNumItems);
+    int32_t numValuesInUse = umtx_loadAcquire(fNumValuesInUse);
+    int32_t evictableItems = totalItems - numValuesInUse;
 
-    int32_t unusedLimitByPercentage = fNumValuesInUse * fMaxPercentageOfInUse / 100;
-    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused);
+    int32_t unusedLimitByPercentage =
+            numValuesInUse * umtx_loadAcquire(fMaxPercentageOfInUse) / 100;
+    int32_t unusedLimit = std::max(unusedLimitByPercentage, umtx_loadAcquire(fMaxUnused));
     int32_t countOfItemsToEvict = std::max(0, evictableItems - unusedLimit);
     return countOfItemsToEvict;
 }
@@ -278,25 +476,163 @@ void UnifiedCache::_runEvictionSlice() const {
     if (maxItemsToEvict <= 0) {
         return;
     }
-    for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
+    UTRACE_ENTRY(UTRACE_UCACHE_EVICTION_SLICE);
+    // Visit the shards round robin, continuing where the previous slice
+    // stopped. Going one past the shard count lets the slice wrap around
+    // to the start of the shard it began in.
+    int32_t iterations = 0;
+    int32_t evicted = 0;
+    for (int32_t n = 0; n <= UNIFIED_CACHE_SHARD_COUNT; ++n) {
+        int32_t shardIndex = umtx_loadAcquire(fEvictShard);
+        UnifiedCacheShard &shard = fShards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        while (iterations < MAX_EVICT_ITERATIONS) {
+            const UHashElement *element =
+                    uhash_nextElement(shard.hashtable, &shard.evictPos);
+            if (element == nullptr) {
+                shard.evictPos = UHASH_FIRST;
+                umtx_storeRelease(
+                        fEvictShard, (shardIndex + 1) & (UNIFIED_CACHE_SHARD_COUNT - 1));
+                break;
+            }
+            ++iterations;
+            if (_isEvictable(element)) {
+                _evict(shard, element);   // Deletes sharedObject when SoftRefCount goes to zero.
+                ++evicted;
+                if (--maxItemsToEvict == 0) {
+                    break;
+                }
+            }
+        }
+        if (iterations >= MAX_EVICT_ITERATIONS || maxItemsToEvict == 0) {
+            break;
+        }
+    }
+    UTRACE_EXIT_VALUE(evicted);
+}
+
+namespace {
+
+// An evictable cache entry as seen by _computeMemoryEvictionCutoff().
+struct MemoryEvictionCandidate {
+    int64_t lastAccess;
+    int32_t bytes;
+};
+
+int32_t U_CALLCONV
+compareMemoryEvictionCandidates(const void * /*context*/, const void *left, const void *right) {
+    int64_t l = static_cast<const MemoryEvictionCandidate *>(left)->lastAccess;
+    int64_t r = static_cast<const MemoryEvictionCandidate *>(right)->lastAccess;
+    return l < r ? -1 : (l > r ? 1 : 0);
+}
+
+}  // namespace
+
+void UnifiedCache::_evictToMemoryLimit() const {
+    int64_t maxBytes = fMaxBytes.load();
+    if (maxBytes == 0 || fNumBytes.load() <= maxBytes) {
+        return;
+    }
+    // While the excess is held by values in use, scanning the whole cache
+    // again on every put and release would find nothing to evict.
+    if (fMemoryEvictionStalledAt.load() == fReleaseCount.load()) {
+        return;
+    }
+    // Only one thread at a time needs to do this. This also stops recursion
+    // when deleting an evicted value releases other cached values.
+    if (fEvictingToMemoryLimit.exchange(true)) {
+        return;
+    }
+    UTRACE_ENTRY(UTRACE_UCACHE_MEMORY_EVICTION);
+    UTRACE_DATA2(UTRACE_INFO, "%l bytes over limit %l", fNumBytes.load() - maxBytes, maxBytes);
+    int64_t stalledAt = -1;
+    for (int32_t round = 0; round < MAX_MEMORY_EVICT_ROUNDS; ++round) {
+        int64_t releaseCount = fReleaseCount.load();
+        int64_t excessBytes = fNumBytes.load() - maxBytes;
+        if (excessBytes <= 0) {
+            break;
+        }
+        int64_t cutoff = _computeMemoryEvictionCutoff(excessBytes);
+        if (cutoff == NO_MEMORY_EVICTION_CUTOFF || !_evictAccessedNoLaterThan(cutoff)) {
+            stalledAt = releaseCount;
             break;
         }
-        if (_isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
-            ++fAutoEvictedCount;
-            if (--maxItemsToEvict == 0) {
+    }
+    fMemoryEvictionStalledAt.store(stalledAt);
+    UTRACE_DATA1(UTRACE_INFO, "%l bytes left", fNumBytes.load());
+    UTRACE_EXIT();
+    fEvictingToMemoryLimit.store(false);
+}
+
+int64_t UnifiedCache::_computeMemoryEvictionCutoff(int64_t excessBytes) const {
+    // Collect the evictable entries whose eviction frees their value.
+    // Other evictable entries are non-primary keys, which are evicted along
+    // with any entry accessed no later than them but free no memory.
+    MaybeStackArray<MemoryEvictionCandidate, 64> candidates;
+    int32_t length = 0;
+    for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+        UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element;
+        while ((element = uhash_nextElement(shard.hashtable, &pos)) != nullptr) {
+            const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+            const SharedObject *theValue = (const SharedObject *) element->value.pointer;
+            if (!theKey->fIsPrimary || !_isEvictable(element)) {
+                continue;
+            }
+            if (length == candidates.getCapacity() &&
+                    candidates.resize(2 * length, length) == nullptr) {
+                // Out of memory: Work with the candidates we have.
                 break;
             }
+            candidates[length].lastAccess = theKey->fLastAccess;
+            candidates[length].bytes = theValue->getMemoryUsage();
+            ++length;
+        }
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    uprv_sortArray(candidates.getAlias(), length, (int32_t) sizeof(MemoryEvictionCandidate),
+                   compareMemoryEvictionCandidates, nullptr, false, &status);
+    if (U_FAILURE(status)) {
+        return NO_MEMORY_EVICTION_CUTOFF;
+    }
+    int64_t freedBytes = 0;
+    for (int32_t i = 0; i < length; ++i) {
+        freedBytes += candidates[i].bytes;
+        if (freedBytes >= excessBytes) {
+            return candidates[i].lastAccess;
+        }
+    }
+    return INT64_MAX;
+}
+
+UBool UnifiedCache::_evictAccessedNoLaterThan(int64_t cutoff) const {
+    UBool result = false;
+    for (int32_t i = 0; i < UNIFIED_CACHE_SHARD_COUNT; ++i) {
+        UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element;
+        while ((element = uhash_nextElement(shard.hashtable, &pos)) != nullptr) {
+            const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+            if (theKey->fLastAccess <= cutoff && _isEvictable(element)) {
+                _evict(shard, element);
+                result = true;
+            }
         }
     }
+    return result;
+}
+
+void UnifiedCache::_touch(const CacheKeyBase *theKey) const {
+    if (fMaxBytes.load(std::memory_order_relaxed) != 0) {
+        theKey->fLastAccess = fAccessClock.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
 }
 
 void UnifiedCache::_putNew(
+        UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -310,68 +646,99 @@ void UnifiedCache::_putNew(
         return;
     }
     keyToAdopt->fCreationStatus = creationStatus;
-    if (value->softRefCount == 0) {
+    keyToAdopt->fTypeIndex = _keyTypeIndex(key.typeName());
+    _touch(keyToAdopt);
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerPrimary(keyToAdopt, value);
     }
-    void *oldValue = uhash_put(fHashtable, keyToAdopt, (void *) value, &status);
+    void *oldValue = uhash_put(shard.hashtable, keyToAdopt, (void *) value, &status);
     U_ASSERT(oldValue == nullptr);
     (void)oldValue;
     if (U_SUCCESS(status)) {
-        value->softRefCount++;
+        umtx_atomic_inc(&value->softRefCount);
+        umtx_atomic_inc(&fNumItems);
     }
 }
 
 void UnifiedCache::_putIfAbsentAndGet(
         const CacheKeyBase &key,
         const SharedObject *&value,
+        int64_t creationNanos,
         UErrorCode &status) const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
-    if (element != NULL && !_inProgress(element)) {
-        _fetch(element, value, status);
-        return;
-    }
-    if (element == NULL) {
-        UErrorCode putError = U_ZERO_ERROR;
-        // best-effort basis only.
-        _putNew(key, value, status, putError);
-    } else {
-        _put(element, value, status);
+    UnifiedCacheShard &shard = _shardFor(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const UHashElement *element = uhash_find(shard.hashtable, &key);
+        UnifiedCacheKeyTypeStats &stats = shard.stats[element != NULL ?
+                ((const CacheKeyBase *) element->key.pointer)->fTypeIndex :
+                _keyTypeIndex(key.typeName())];
+        stats.creationNanos += creationNanos;
+        stats.maxCreationNanos = std::max(stats.maxCreationNanos, creationNanos);
+        if (element != NULL && !_inProgress(element)) {
+            _fetch(element, value, status);
+            _touch((const CacheKeyBase *) element->key.pointer);
+            return;
+        }
+        if (element == NULL) {
+            UErrorCode putError = U_ZERO_ERROR;
+            // best-effort basis only.
+            _putNew(shard, key, value, status, putError);
+        } else {
+            _put(shard, element, value, status);
+        }
     }
     // Run an eviction slice. This will run even if we added a primary entry
     // which doesn't increase the unused count, but that is still o.k
     _runEvictionSlice();
+    _evictToMemoryLimit();
 }
 
 
 UBool UnifiedCache::_poll(
         const CacheKeyBase &key,
         const SharedObject *&value,
+        int64_t &waitNanos,
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
-    std::unique_lock<std::mutex> lock(*gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    UnifiedCacheShard &shard = _shardFor(key);
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    const UHashElement *element = uhash_find(shard.hashtable, &key);
+    waitNanos = -1;
 
     // If the hash table contains an inProgress placeholder entry for this key,
     // this means that another thread is currently constructing the value object.
     // Loop, waiting for that construction to complete.
-     while (element != NULL && _inProgress(element)) {
-         gInProgressValueAddedCond->wait(lock);
-         element = uhash_find(fHashtable, &key);
+    if (element != NULL && _inProgress(element)) {
+        UnifiedCacheKeyTypeStats &stats =
+                shard.stats[((const CacheKeyBase *) element->key.pointer)->fTypeIndex];
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        do {
+            shard.inProgressValueAddedCond.wait(lock);
+            element = uhash_find(shard.hashtable, &key);
+        } while (element != NULL && _inProgress(element));
+        waitNanos = nanosSince(start);
+        ++stats.waits;
+        stats.waitNanos += waitNanos;
     }
 
     // If the hash table contains an entry for the key,
     // fetch out the contents and return them.
     if (element != NULL) {
+         const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
          _fetch(element, value, status);
+         _touch(theKey);
+         ++shard.stats[theKey->fTypeIndex].hits;
         return true;
     }
 
     // The hash table contained nothing for this key.
     // Insert an inProgress place holder value.
     // Our caller will create the final value and update the hash table.
-    _putNew(key, fNoValue, U_ZERO_ERROR, status);
+    _putNew(shard, key, fNoValue, U_ZERO_ERROR, status);
+    if (U_SUCCESS(status)) {
+        ++shard.stats[_keyTypeIndex(key.typeName())].misses;
+    }
     return false;
 }
 
@@ -382,7 +749,12 @@ void UnifiedCache::_get(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
-    if (_poll(key, value, status)) {
+    int64_t waitNanos;
+    UBool found = _poll(key, value, waitNanos, status);
+    if (waitNanos >= 0) {
+        traceWait(key, waitNanos);
+    }
+    if (found) {
         if (value == fNoValue) {
             SharedObject::clearPtr(value);
         }
@@ -391,27 +763,50 @@ void UnifiedCache::_get(
     if (U_FAILURE(status)) {
         return;
     }
-    value = key.createObject(creationContext, status);
+    int64_t creationNanos;
+    value = _createObject(key, creationContext, creationNanos, status);
     U_ASSERT(value == NULL || value->hasHardReferences());
     U_ASSERT(value != NULL || status != U_ZERO_ERROR);
     if (value == NULL) {
         SharedObject::copyPtr(fNoValue, value);
     }
-    _putIfAbsentAndGet(key, value, status);
+    _putIfAbsentAndGet(key, value, creationNanos, status);
     if (value == fNoValue) {
         SharedObject::clearPtr(value);
     }
 }
 
+const SharedObject *UnifiedCache::_createObject(
+        const CacheKeyBase &key,
+        const void *creationContext,
+        int64_t &nanos,
+        UErrorCode &status) const {
+    UTRACE_ENTRY(UTRACE_UCACHE_CREATE_OBJECT);
+#if U_ENABLE_TRACING
+    if (UTRACE_LEVEL(UTRACE_INFO)) {
+        char buffer[MAX_DESCRIPTION_LENGTH];
+        UTRACE_DATA2(UTRACE_INFO, "%s %s", key.typeName(),
+                     key.writeDescription(buffer, MAX_DESCRIPTION_LENGTH));
+    }
+#endif
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const SharedObject *value = key.createObject(creationContext, status);
+    nanos = nanosSince(start);
+    UTRACE_EXIT_STATUS(status);
+    return value;
+}
+
 void UnifiedCache::_registerPrimary(
             const CacheKeyBase *theKey, const SharedObject *value) const {
     theKey->fIsPrimary = true;
     value->cachePtr = this;
-    ++fNumValuesTotal;
-    ++fNumValuesInUse;
+    fNumBytes += value->getMemoryUsage();
+    umtx_atomic_inc(&fNumValuesTotal);
+    umtx_atomic_inc(&fNumValuesInUse);
 }
 
 void UnifiedCache::_put(
+        UnifiedCacheShard &shard,
         const UHashElement *element,
         const SharedObject *value,
         const UErrorCode status) const {
@@ -419,10 +814,11 @@ void UnifiedCache::_put(
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     const SharedObject *oldValue = (const SharedObject *) element->value.pointer;
     theKey->fCreationStatus = status;
-    if (value->softRefCount == 0) {
+    _touch(theKey);
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerPrimary(theKey, value);
     }
-    value->softRefCount++;
+    umtx_atomic_inc(&value->softRefCount);
     UHashElement *ptr = const_cast<UHashElement *>(element);
     ptr->value.pointer = (void *) value;
     U_ASSERT(oldValue == fNoValue);
@@ -430,7 +826,7 @@ void UnifiedCache::_put(
 
     // Tell waiting threads that we replace in-progress status with
     // an error.
-    gInProgressValueAddedCond->notify_all();
+    shard.inProgressValueAddedCond.notify_all();
 }
 
 void UnifiedCache::_fetch(
@@ -440,9 +836,9 @@ void UnifiedCache::_fetch(
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     status = theKey->fCreationStatus;
 
-    // Since we have the cache lock, calling regular SharedObject add/removeRef
+    // Since we have the shard lock, calling regular SharedObject add/removeRef
     // could cause us to deadlock on ourselves since they may need to lock
-    // the cache mutex.
+    // the shard mutex.
     removeHardRef(value);
     value = static_cast<const SharedObject *>(element->value.pointer);
     addHardRef(value);
@@ -476,14 +872,15 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
 
     // We can evict entries that are either not a primary or have just
     // one reference (The one reference being from the cache itself).
-    return (!theKey->fIsPrimary || (theValue->softRefCount == 1 && theValue->noHardReferences()));
+    return (!theKey->fIsPrimary || (umtx_loadAcquire(theValue->softRefCount) == 1 && theValue->noHardReferences()));
 }
 
 void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     U_ASSERT(value->cachePtr == this);
-    U_ASSERT(value->softRefCount > 0);
-    if (--value->softRefCount == 0) {
-        --fNumValuesTotal;
+    U_ASSERT(umtx_loadAcquire(value->softRefCount) > 0);
+    if (umtx_atomic_dec(&value->softRefCount) == 0) {
+        umtx_atomic_dec(&fNumValuesTotal);
+        fNumBytes -= value->getMemoryUsage();
         if (value->noHardReferences()) {
             delete value;
         } else {
@@ -501,7 +898,8 @@ int32_t UnifiedCache::removeHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_dec(&value->hardRefCount);
         U_ASSERT(refCount >= 0);
         if (refCount == 0) {
-            --fNumValuesInUse;
+            umtx_atomic_dec(&fNumValuesInUse);
+            ++fReleaseCount;
         }
     }
     return refCount;
@@ -513,10 +911,121 @@ int32_t UnifiedCache::addHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_inc(&value->hardRefCount);
         U_ASSERT(refCount >= 1);
         if (refCount == 1) {
-            fNumValuesInUse++;
+            umtx_atomic_inc(&fNumValuesInUse);
         }
     }
     return refCount;
 }
 
 U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI void U_EXPORT2
+ucache_setMemoryLimit(int64_t maxBytes, UErrorCode *status) {
+    UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    cache->setMemoryLimit(maxBytes, *status);
+}
+
+U_CAPI int64_t U_EXPORT2
+ucache_getMemoryLimit(UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    return cache->memoryLimit();
+}
+
+U_CAPI int64_t U_EXPORT2
+ucache_getByteCount(UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    return cache->byteCount();
+}
+
+U_CAPI int32_t U_EXPORT2
+ucache_getEntryCount(UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    return cache->keyCount();
+}
+
+U_CAPI int64_t U_EXPORT2
+ucache_getEvictionCount(UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    return cache->autoEvictedCount();
+}
+
+U_CAPI int32_t U_EXPORT2
+ucache_countKeyTypes(UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    return cache->keyTypeCount();
+}
+
+U_CAPI const char * U_EXPORT2
+ucache_getKeyTypeName(int32_t index, UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return nullptr;
+    }
+    const char *name = cache->keyTypeName(index);
+    if (name == nullptr) {
+        *status = U_INDEX_OUTOFBOUNDS_ERROR;
+    }
+    return name;
+}
+
+U_CAPI int64_t U_EXPORT2
+ucache_getKeyTypeStatistic(int32_t index, UCacheStatistic statistic, UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (index < 0 || index >= cache->keyTypeCount()) {
+        *status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+    UnifiedCacheKeyTypeStats stats;
+    cache->keyTypeStats(index, stats);
+    switch (statistic) {
+    case UCACHE_HITS:
+        return stats.hits;
+    case UCACHE_MISSES:
+        return stats.misses;
+    case UCACHE_WAITS:
+        return stats.waits;
+    case UCACHE_WAIT_NANOS:
+        return stats.waitNanos;
+    case UCACHE_CREATION_NANOS:
+        return stats.creationNanos;
+    case UCACHE_MAX_CREATION_NANOS:
+        return stats.maxCreationNanos;
+    case UCACHE_EVICTIONS:
+        return stats.evictions;
+    default:
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+}
+
+U_CAPI void U_EXPORT2
+ucache_resetStatistics(UErrorCode *status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    cache->resetStats();
+}
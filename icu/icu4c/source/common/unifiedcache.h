@@ -25,22 +25,46 @@
 struct UHashtable;
 struct UHashElement;
 
+/**
+ * The number of independently locked shards in the UnifiedCache.
+ * Keys are distributed over the shards by hash code, so that lookups of
+ * different keys from different threads rarely contend for the same mutex.
+ * Must be a power of two. Define as 1 to use a single cache-wide lock.
+ * @internal
+ */
+#ifndef UNIFIED_CACHE_SHARD_COUNT
+#define UNIFIED_CACHE_SHARD_COUNT 16
+#endif
+
+/**
+ * The maximum number of key types for which the UnifiedCache keeps separate
+ * statistics. Statistics for any further key types are merged into the last
+ * entry, named "(other)".
+ * @internal
+ */
+#ifndef UNIFIED_CACHE_MAX_KEY_TYPES
+#define UNIFIED_CACHE_MAX_KEY_TYPES 32
+#endif
+
 U_NAMESPACE_BEGIN
 
 class UnifiedCache;
+struct UnifiedCacheShard;
 
 /**
  * A base class for all cache keys.
  */
 class U_COMMON_API CacheKeyBase : public UObject {
  public:
-   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsPrimary(false) {}
+   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsPrimary(false), fLastAccess(0),
+                    fTypeIndex(0) {}
 
    /**
     * Copy constructor. Needed to support cloning.
     */
    CacheKeyBase(const CacheKeyBase &other) 
-           : UObject(other), fCreationStatus(other.fCreationStatus), fIsPrimary(false) { }
+           : UObject(other), fCreationStatus(other.fCreationStatus), fIsPrimary(false),
+             fLastAccess(0), fTypeIndex(0) { }
    virtual ~CacheKeyBase();
 
    /**
@@ -75,6 +99,13 @@ class U_COMMON_API CacheKeyBase : public UObject {
     */
    virtual char *writeDescription(char *buffer, int32_t bufSize) const = 0;
 
+   /**
+    * Returns the name of the type of value this key maps to. The cache keeps
+    * its statistics per type name. The returned string must remain valid
+    * for the lifetime of the cache.
+    */
+   virtual const char *typeName() const = 0;
+
    friend inline bool operator==(const CacheKeyBase& lhs,
                                  const CacheKeyBase& rhs) {
        return lhs.equals(rhs);
@@ -91,6 +122,12 @@ class U_COMMON_API CacheKeyBase : public UObject {
  private:
    mutable UErrorCode fCreationStatus;
    mutable UBool fIsPrimary;
+   // Value of the cache's access clock when this entry was last looked up.
+   // Only maintained while a memory limit is set.
+   mutable int64_t fLastAccess;
+   // Index of the statistics for this key's type, set when the key is
+   // stored in the cache.
+   mutable int32_t fTypeIndex;
    friend class UnifiedCache;
 };
 
@@ -122,6 +159,14 @@ class CacheKey : public CacheKeyBase {
        return buffer;
    }
 
+   /**
+    * Returns a fixed name for the value type, T.
+    * Each value type defines this specialization next to its
+    * LocaleCacheKey<T>::createObject(), rather than using typeid(T).name(),
+    * which differs between compilers.
+    */
+   virtual const char *typeName() const override;
+
  protected:
    /**
     * Two objects are equal if they are of the same type.
@@ -175,10 +220,36 @@ class LocaleCacheKey : public CacheKey<T> {
 
 };
 
+/**
+ * Statistics about the entries of one key type in the UnifiedCache.
+ * Times are measured with a monotonic clock, in nanoseconds.
+ */
+struct UnifiedCacheKeyTypeStats {
+    /** Lookups that found an entry, including entries with an error status. */
+    int64_t hits;
+    /** Lookups that found no entry and created the value. */
+    int64_t misses;
+    /** Lookups that waited for another thread to create the value. */
+    int64_t waits;
+    /** Total time spent waiting for other threads to create values. */
+    int64_t waitNanos;
+    /** Total time spent in CacheKeyBase::createObject(). */
+    int64_t creationNanos;
+    /** Longest single call to CacheKeyBase::createObject(). */
+    int64_t maxCreationNanos;
+    /** Entries auto evicted, not counting entries removed by flush(). */
+    int64_t evictions;
+};
+
 /**
  * The unified cache. A singleton type.
  * Design doc here:
  * https://docs.google.com/document/d/1RwGQJs4N4tawNbf809iYDRCvXoMKqDJihxzYt1ysmd8/edit?usp=sharing
+ *
+ * The cache is partitioned into UNIFIED_CACHE_SHARD_COUNT shards, each with
+ * its own hash table, mutex and in-progress condition variable. A key always
+ * lives in the shard selected by its hash code. Counts used by the eviction
+ * policy are kept across all shards.
  */
 class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
  public:
@@ -328,10 +399,42 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
            int32_t count, int32_t percentageOfInUseItems, UErrorCode &status);
 
 
+   /**
+    * Configures a limit on the approximate memory used by the values in this
+    * cache, as reported by SharedObject::getMemoryUsage(). Whenever the total
+    * exceeds maxBytes, unused entries are evicted, least recently used first,
+    * until the total is back under the limit. Entries for values that clients
+    * still hold references to are never evicted, so the limit cannot be
+    * honored if those values alone exceed it.
+    *
+    * The sizes are rough estimates of the heap memory that each value owns.
+    * Data that values share, or that is memory-mapped, does not count.
+    *
+    * This limit applies in addition to the count based policy set with
+    * setEvictionPolicy(). A maxBytes of 0, the default, means no limit.
+    * Setting a limit below the current total evicts immediately.
+    *
+    * If maxBytes is negative, sets status to U_ILLEGAL_ARGUMENT_ERROR.
+    */
+   void setMemoryLimit(int64_t maxBytes, UErrorCode &status);
+
+   /**
+    * Returns the memory limit set with setMemoryLimit(), or 0 if none.
+    */
+   int64_t memoryLimit() const;
+
+   /**
+    * Returns the approximate number of bytes used by the values in this
+    * cache, as reported by SharedObject::getMemoryUsage(). Each value is
+    * counted once, no matter how many keys refer to it.
+    */
+   int64_t byteCount() const;
+
    /**
     * Returns how many entries have been auto evicted during the lifetime
     * of this cache. This only includes auto evicted entries, not
-    * entries evicted because of a call to flush().
+    * entries evicted because of a call to flush(). Entries evicted to honor
+    * the memory limit are included.
     */
    int64_t autoEvictedCount() const;
 
@@ -341,27 +444,70 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     */
    int32_t unusedCount() const;
 
+   /**
+    * Returns the number of key types for which this cache has statistics.
+    * Key types are numbered in the order in which their first entry was
+    * added to the cache.
+    */
+   int32_t keyTypeCount() const;
+
+   /**
+    * Returns the name of the key type at index, as returned by
+    * CacheKeyBase::typeName(), or nullptr if index is out of range.
+    */
+   const char *keyTypeName(int32_t index) const;
+
+   /**
+    * Sums up the statistics for the key type at index over all shards.
+    * If index is out of range, sets all statistics to 0.
+    */
+   void keyTypeStats(int32_t index, UnifiedCacheKeyTypeStats &stats) const;
+
+   /**
+    * Resets all statistics to 0. Key types stay registered.
+    */
+   void resetStats() const;
+
    virtual void handleUnreferencedObject() const override;
    virtual ~UnifiedCache();
    
  private:
-   UHashtable *fHashtable;
-   mutable int32_t fEvictPos;
-   mutable int32_t fNumValuesTotal;
-   mutable int32_t fNumValuesInUse;
-   int32_t fMaxUnused;
-   int32_t fMaxPercentageOfInUse;
-   mutable int64_t fAutoEvictedCount;
+   UnifiedCacheShard *fShards;
+   mutable u_atomic_int32_t fEvictShard;
+   mutable u_atomic_int32_t fNumItems;
+   mutable u_atomic_int32_t fNumValuesTotal;
+   mutable u_atomic_int32_t fNumValuesInUse;
+   mutable u_atomic_int32_t fMaxUnused;
+   mutable u_atomic_int32_t fMaxPercentageOfInUse;
+   mutable std::atomic<int64_t> fAutoEvictedCount;
+   mutable std::atomic<int64_t> fNumBytes;
+   std::atomic<int64_t> fMaxBytes;
+   mutable std::atomic<int64_t> fAccessClock;
+   mutable std::atomic<bool> fEvictingToMemoryLimit;
+   // Counts events that can make entries evictable: values losing their
+   // last hard reference and entries being removed.
+   mutable std::atomic<int64_t> fReleaseCount;
+   // fReleaseCount as of the last memory eviction round that evicted
+   // nothing while over the limit, or -1. Until fReleaseCount changes,
+   // another scan could not evict anything either.
+   mutable std::atomic<int64_t> fMemoryEvictionStalledAt;
+   mutable const char *fKeyTypeNames[UNIFIED_CACHE_MAX_KEY_TYPES];
+   mutable u_atomic_int32_t fKeyTypeCount;
    SharedObject *fNoValue;
    
    UnifiedCache(const UnifiedCache &other) = delete;
    UnifiedCache &operator=(const UnifiedCache &other) = delete;
    
    /**
-    * Flushes the contents of the cache. If cache values hold references to other
+    * Returns the shard that holds the given key.
+    */
+   UnifiedCacheShard &_shardFor(const CacheKeyBase &key) const;
+
+   /**
+    * Flushes the contents of a shard. If cache values hold references to other
     * cache values then _flush should be called in a loop until it returns false.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     * On exit, those values with are evictable are flushed.
     * 
     *  @param all if false flush evictable items only, which are those with no external
@@ -372,11 +518,11 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     *                     _flush is not thread safe when all is true.
     *   @return true if any value in cache was flushed or false otherwise.
     */
-   UBool _flush(UBool all) const;
+   UBool _flush(UnifiedCacheShard &shard, UBool all) const;
    
    /**
     * Gets value out of cache.
-    * On entry. gCacheMutex must not be held. value must be NULL. status
+    * On entry. No shard mutex may be held. value must be NULL. status
     * must be U_ZERO_ERROR.
     * On exit. value and status set to what is in cache at key or on cache
     * miss the key's createObject() is called and value and status are set to
@@ -391,9 +537,21 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
            const void *creationContext,
            UErrorCode &status) const;
 
+   /**
+    * Calls the key's createObject() and traces the call.
+    * On entry, no shard mutex may be held.
+    * Returns the created object, or NULL on failure. Sets nanos to the time
+    * createObject() took.
+    */
+   const SharedObject *_createObject(
+           const CacheKeyBase &key,
+           const void *creationContext,
+           int64_t &nanos,
+           UErrorCode &status) const;
+
     /**
      * Attempts to fetch value and status for key from cache.
-     * On entry, gCacheMutex must not be held value must be NULL and status must
+     * On entry, no shard mutex may be held, value must be NULL and status must
      * be U_ZERO_ERROR.
      * On exit, either returns false (In this
      * case caller should try to create the object) or returns true with value
@@ -401,19 +559,24 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
      * false is returned status may be set to failure if an in progress hash
      * entry could not be made but value will remain unchanged. When true is
      * returned, caller must call removeRef() on value.
+     * waitNanos is set to the time spent waiting for another thread to create
+     * the value, or to -1 if there was no need to wait.
      */
     UBool _poll(
             const CacheKeyBase &key,
             const SharedObject *&value,
+            int64_t &waitNanos,
             UErrorCode &status) const;
     
     /**
      * Places a new value and creationStatus in the cache for the given key.
-     * On entry, gCacheMutex must be held. key must not exist in the cache. 
+     * On entry, the mutex of the key's shard must be held. key must not exist
+     * in the cache.
      * On exit, value and creation status placed under key. Soft reference added
      * to value on successful add. On error sets status.
      */
     void _putNew(
+        UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -424,25 +587,48 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
      * entry for key is in progress. Otherwise, it leaves the current value and
      * status there.
      * 
-     * On entry. gCacheMutex must not be held. Value must be
+     * On entry. No shard mutex may be held. Value must be
      * included in the reference count of the object to which it points.
      * 
      * On exit, value and status are changed to what was already in the cache if
      * something was there and not in progress. Otherwise, value and status are left
      * unchanged in which case they are placed in the cache on a best-effort basis.
      * Caller must call removeRef() on value.
+     *
+     * creationNanos is the time it took to create value, for the statistics.
      */
    void _putIfAbsentAndGet(
            const CacheKeyBase &key,
            const SharedObject *&value,
+           int64_t creationNanos,
            UErrorCode &status) const;
 
     /**
-     * Returns the next element in the cache round robin style.
-     * Returns nullptr if the cache is empty.
-     * On entry, gCacheMutex must be held.
+     * Returns the next element in the shard round robin style.
+     * Returns nullptr if the shard is empty.
+     * On entry, the shard's mutex must be held.
+     */
+    const UHashElement *_nextElement(UnifiedCacheShard &shard) const;
+
+    /**
+     * Removes element from its shard and drops the soft reference the shard
+     * held to its value.
+     * On entry, the shard's mutex must be held.
      */
-    const UHashElement *_nextElement() const;
+    void _removeElement(UnifiedCacheShard &shard, const UHashElement *element) const;
+
+    /**
+     * Auto evicts element, counting the eviction in the statistics.
+     * On entry, the shard's mutex must be held.
+     */
+    void _evict(UnifiedCacheShard &shard, const UHashElement *element) const;
+
+    /**
+     * Returns the index of the statistics for the given key type name,
+     * registering the key type if it is new.
+     * May be called with or without a shard mutex held.
+     */
+    int32_t _keyTypeIndex(const char *typeName) const;
    
    /**
     * Return the number of cache items that would need to be evicted
@@ -450,17 +636,52 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * 
     * An item corresponds to an entry in the hash table, a hash table element.
     * 
-    * On entry, gCacheMutex must be held.
+    * May be called with or without a shard mutex held. The result is a
+    * snapshot and may be slightly stale when other threads use the cache.
     */
    int32_t _computeCountOfItemsToEvict() const;
    
    /**
     * Run an eviction slice.
-    * On entry, gCacheMutex must be held.
+    * On entry, no shard mutex may be held.
     * _runEvictionSlice runs a slice of the evict pipeline by examining the next
     * 10 entries in the cache round robin style evicting them if they are eligible.
+    * Shards are visited in turn, locking one shard at a time.
     */
    void _runEvictionSlice() const;
+
+   /**
+    * Evicts unused entries, least recently used first, until the memory used
+    * by cached values drops below the memory limit or nothing more can be
+    * evicted. Does nothing if no memory limit is set, if another thread is
+    * already doing this, or if the last attempt evicted nothing and no entry
+    * can have become evictable since.
+    * On entry, no shard mutex may be held.
+    */
+   void _evictToMemoryLimit() const;
+
+   /**
+    * Returns the last access time such that evicting all evictable entries
+    * accessed no later than it frees at least excessBytes. Returns INT64_MAX
+    * if evicting all evictable entries would not free enough, and -1, which
+    * evicts nothing, if the entries cannot be sorted.
+    * On entry, no shard mutex may be held.
+    */
+   int64_t _computeMemoryEvictionCutoff(int64_t excessBytes) const;
+
+   /**
+    * Evicts all evictable entries whose last access time is no later than
+    * cutoff. Returns true if any entry was evicted.
+    * On entry, no shard mutex may be held.
+    */
+   UBool _evictAccessedNoLaterThan(int64_t cutoff) const;
+
+   /**
+    * Records an access of the entry for theKey, for least recently used
+    * ordering. Does nothing if no memory limit is set.
+    * On entry, the mutex of the key's shard must be held.
+    */
+   void _touch(const CacheKeyBase *theKey) const;
  
    /**
     * Register a primary cache entry. A primary key is the first key to create
@@ -468,7 +689,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * produce references to an already existing SharedObject are not primary -
     * they can be evicted and subsequently recreated.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the mutex of the key's shard must be held.
     * On exit, items in use count incremented, entry is marked as a primary
     * entry, and value registered with cache so that subsequent calls to
     * addRef() and removeRef() on it correctly interact with the cache.
@@ -477,27 +698,28 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
         
    /**
     * Store a value and creation error status in given hash entry.
-    * On entry, gCacheMutex must be held. Hash entry element must be in progress.
-    * value must be non NULL.
+    * On entry, the shard's mutex must be held. Hash entry element must be in
+    * progress. value must be non NULL.
     * On Exit, soft reference added to value. value and status stored in hash
-    * entry. Soft reference removed from previous stored value. Waiting
-    * threads notified.
+    * entry. Soft reference removed from previous stored value. Threads waiting
+    * on the shard notified.
     */
    void _put(
+           UnifiedCacheShard &shard,
            const UHashElement *element,
            const SharedObject *value,
            const UErrorCode status) const;
     /**
      * Remove a soft reference, and delete the SharedObject if no references remain.
      * To be used from within the UnifiedCache implementation only.
-     * gCacheMutex must be held by caller.
+     * The mutex of the shard that held the reference must be held by caller.
      * @param value the SharedObject to be acted on.
      */
    void removeSoftRef(const SharedObject *value) const;
    
    /**
     * Increment the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * The mutex of the shard holding the value's entry must be held by the caller.
     * Update numValuesEvictable on transitions between zero and one reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -507,7 +729,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
   /**
     * Decrement the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * The mutex of the shard holding the value's entry must be held by the caller.
     * Update numValuesEvictable on transitions between one and zero reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -517,12 +739,12 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
 
    
 #ifdef UNIFIED_CACHE_DEBUG
-   void _dumpContents() const;
+   int32_t _dumpContents(UnifiedCacheShard &shard) const;
 #endif
    
    /**
     *  Fetch value and error code from a particular hash entry.
-    *  On entry, gCacheMutex must be held. value must be either NULL or must be
+    *  On entry, the shard's mutex must be held. value must be either NULL or must be
     *  included in the ref count of the object to which it points.
     *  On exit, value and status set to what is in the hash entry. Caller must
     *  eventually call removeRef on value.
@@ -534,19 +756,19 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
                        
     /**
      * Determine if given hash entry is in progress.
-     * On entry, gCacheMutex must be held.
+     * On entry, the shard's mutex must be held.
      */
    UBool _inProgress(const UHashElement *element) const;
    
    /**
     * Determine if given hash entry is in progress.
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     */
    UBool _inProgress(const SharedObject *theValue, UErrorCode creationStatus) const;
    
    /**
     * Determine if given hash entry is eligible for eviction.
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     */
    UBool _isEvictable(const UHashElement *element) const;
 };
@@ -31,8 +31,8 @@
 #include "ucln_cmn.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "flathashmap.h"
 #include "mutex.h"
-#include "uhash.h"
 #include "unicode/uenum.h"
 #include "uenumimp.h"
 #include "ulocimp.h"
@@ -48,32 +48,33 @@ Static cache for already opened resource bundles - mostly for keeping fallback i
 TODO: This cache should probably be removed when the deprecated code is
       completely removed.
 */
-static UHashtable *cache = NULL;
-static icu::UInitOnce gCacheInitOnce {};
+namespace {
 
-static UMutex resbMutex;
+/* INTERNAL: hashes and compares cache entries by name and path, either of which can be NULL */
+struct EntryKeyTraits {
+    static inline uint32_t hashChars(const char *s) {
+        return s != NULL ? CharsKeyTraits::hash(s) : 0;
+    }
+    static inline UBool equalChars(const char *s1, const char *s2) {
+        return s1 == s2 || (s1 != NULL && s2 != NULL && uprv_strcmp(s1, s2) == 0);
+    }
+    static inline uint32_t hash(const UResourceDataEntry *b) {
+        return hashChars(b->fName) + 37u * hashChars(b->fPath);
+    }
+    static inline UBool equals(const UResourceDataEntry *b1, const UResourceDataEntry *b2) {
+        return equalChars(b1->fName, b2->fName) && equalChars(b1->fPath, b2->fPath);
+    }
+};
 
-/* INTERNAL: hashes an entry  */
-static int32_t U_CALLCONV hashEntry(const UHashTok parm) {
-    UResourceDataEntry *b = (UResourceDataEntry *)parm.pointer;
-    UHashTok namekey, pathkey;
-    namekey.pointer = b->fName;
-    pathkey.pointer = b->fPath;
-    return uhash_hashChars(namekey)+37u*uhash_hashChars(pathkey);
-}
+/* Maps each entry to itself; lookups use a stack entry with only the name and path set. */
+typedef FlatHashMap<const UResourceDataEntry *, UResourceDataEntry *, EntryKeyTraits> EntryCache;
 
-/* INTERNAL: compares two entries */
-static UBool U_CALLCONV compareEntries(const UHashTok p1, const UHashTok p2) {
-    UResourceDataEntry *b1 = (UResourceDataEntry *)p1.pointer;
-    UResourceDataEntry *b2 = (UResourceDataEntry *)p2.pointer;
-    UHashTok name1, name2, path1, path2;
-    name1.pointer = b1->fName;
-    name2.pointer = b2->fName;
-    path1.pointer = b1->fPath;
-    path2.pointer = b2->fPath;
-    return (UBool)(uhash_compareChars(name1, name2) &&
-        uhash_compareChars(path1, path2));
-}
+}  // namespace
+
+static EntryCache *cache = NULL;
+static icu::UInitOnce gCacheInitOnce {};
+
+static UMutex resbMutex;
 
 
 /**
@@ -383,7 +384,6 @@ static int32_t ures_flushCache()
     UResourceDataEntry *resB;
     int32_t pos;
     int32_t rbDeletedNum = 0;
-    const UHashElement *e;
     UBool deletedMore;
 
     /*if shared data hasn't even been lazy evaluated yet
@@ -397,10 +397,9 @@ static int32_t ures_flushCache()
     do {
         deletedMore = false;
         /*creates an enumeration to iterate through every element in the table */
-        pos = UHASH_FIRST;
-        while ((e = uhash_nextElement(cache, &pos)) != NULL)
+        for (pos = cache->nextPosition(-1); pos >= 0; pos = cache->nextPosition(pos))
         {
-            resB = (UResourceDataEntry *) e->value.pointer;
+            resB = cache->valueAt(pos);
             /* Deletes only if reference counter == 0
              * Don't worry about the children of this node.
              * Those will eventually get deleted too, if not already.
@@ -413,7 +412,7 @@ static int32_t ures_flushCache()
             if (resB->fCountExisting == 0) {
                 rbDeletedNum++;
                 deletedMore = true;
-                uhash_removeElement(cache, e);
+                cache->removeAt(pos);
                 free_entry(resB);
             }
         }
@@ -431,8 +430,7 @@ static int32_t ures_flushCache()
 
 U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
   UBool cacheNotEmpty = false;
-  int32_t pos = UHASH_FIRST;
-  const UHashElement *e;
+  int32_t pos;
   UResourceDataEntry *resB;
   
     Mutex lock(&resbMutex);
@@ -441,9 +439,9 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
       return false;
     }
 
-    while ((e = uhash_nextElement(cache, &pos)) != NULL) {
+    for (pos = cache->nextPosition(-1); pos >= 0; pos = cache->nextPosition(pos)) {
       cacheNotEmpty=true;
-      resB = (UResourceDataEntry *) e->value.pointer;
+      resB = cache->valueAt(pos);
       fprintf(stderr,"%s:%d: RB Cache: Entry @0x%p, refcount %d, name %s:%s.  Pool 0x%p, alias 0x%p, parent 0x%p\n",
               __FILE__, __LINE__,
               (void*)resB, resB->fCountExisting,
@@ -454,7 +452,7 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
               (void*)resB->fParent);       
     }
     
-    fprintf(stderr,"%s:%d: RB Cache still contains %d items.\n", __FILE__, __LINE__, uhash_count(cache));
+    fprintf(stderr,"%s:%d: RB Cache still contains %d items.\n", __FILE__, __LINE__, cache->count());
     return cacheNotEmpty;
 }
 
@@ -464,7 +462,7 @@ static UBool U_CALLCONV ures_cleanup(void)
 {
     if (cache != NULL) {
         ures_flushCache();
-        uhash_close(cache);
+        delete cache;
         cache = NULL;
     }
     gCacheInitOnce.reset();
@@ -474,7 +472,11 @@ static UBool U_CALLCONV ures_cleanup(void)
 /** INTERNAL: Initializes the cache for resources */
 static void U_CALLCONV createCache(UErrorCode &status) {
     U_ASSERT(cache == NULL);
-    cache = uhash_open(hashEntry, compareEntries, NULL, &status);
+    cache = new EntryCache();
+    if (cache == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
     ucln_common_registerCleanup(UCLN_COMMON_URES, ures_cleanup);
 }
      
@@ -540,7 +542,7 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
     /*hashValue = hashEntry(hashkey);*/
 
     /* check to see if we already have this entry */
-    r = (UResourceDataEntry *)uhash_get(cache, &find);
+    r = cache->get(&find);
     if(r == NULL) {
         /* if the entry is not yet in the hash table, we'll try to construct a new one */
         r = (UResourceDataEntry *) uprv_malloc(sizeof(UResourceDataEntry));
@@ -612,10 +614,10 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
 
         {
             UResourceDataEntry *oldR = NULL;
-            if((oldR = (UResourceDataEntry *)uhash_get(cache, r)) == NULL) { /* if the data is not cached */
+            if((oldR = cache->get(r)) == NULL) { /* if the data is not cached */
                 /* just insert it in the cache */
                 UErrorCode cacheStatus = U_ZERO_ERROR;
-                uhash_put(cache, (void *)r, r, &cacheStatus);
+                cache->put(r, r, cacheStatus);
                 if (U_FAILURE(cacheStatus)) {
                     *status = cacheStatus;
                     free_entry(r);
@@ -1034,7 +1036,7 @@ static void entryCloseInt(UResourceDataEntry *resB) {
          of the cache. */
 /*
         if(resB->fCountExisting <= 0) {
-            uhash_remove(cache, resB);
+            cache->remove(resB);
             if(resB->fBogus == U_ZERO_ERROR) {
                 res_unload(&(resB->fData));
             }
@@ -0,0 +1,388 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  usimd.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#include "unicode/utypes.h"
+#include "cmemory.h"
+#include "usimd.h"
+
+/*
+ * The vector code is selected at compile time, and only where the instruction set
+ * is part of the platform baseline, so that there is no runtime dispatch:
+ * SSE2 on x86-64 (and on x86 when the compiler targets it), NEON on AArch64.
+ * Define U_SIMD_DISABLE=1 to build only the portable code, for testing.
+ */
+#if defined(U_SIMD_DISABLE) && U_SIMD_DISABLE
+    // portable code only
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define U_SIMD_SSE2 1
+#   include <emmintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#   define U_SIMD_NEON 1
+#   include <arm_neon.h>
+#endif
+
+U_NAMESPACE_BEGIN
+
+namespace simd {
+
+U_COMMON_API int32_t U_EXPORT2
+widenASCII(const uint8_t *src, int32_t length, UChar *dest) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        if (_mm_movemask_epi8(v) != 0) { break; }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif U_SIMD_NEON
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        if (vmaxvq_u8(v) > 0x7f) { break; }
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i + 8), vmovl_high_u8(v));
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        uint64_t word;
+        uprv_memcpy(&word, src + i, 8);
+        if ((word & 0x8080808080808080ULL) != 0) { break; }
+        for (int32_t j = 0; j < 8; ++j) {
+            dest[i + j] = src[i + j];
+        }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API int32_t U_EXPORT2
+narrowASCII(const UChar *src, int32_t length, uint8_t *dest) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonASCII = _mm_set1_epi16((short)0xff80);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b), nonASCII);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xffff) { break; }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_packus_epi16(a, b));
+    }
+#elif U_SIMD_NEON
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i));
+        uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(a, b)) > 0x7f) { break; }
+        vst1q_u8(dest + i, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        uint64_t word;
+        uprv_memcpy(&word, src + i, 8);
+        if ((word & 0xff80ff80ff80ff80ULL) != 0) { break; }
+        for (int32_t j = 0; j < 4; ++j) {
+            dest[i + j] = (uint8_t)src[i + j];
+        }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API int32_t U_EXPORT2
+widenLatin1(const uint8_t *src, int32_t length, UChar *dest) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif U_SIMD_NEON
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i + 8), vmovl_high_u8(v));
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        for (int32_t j = 0; j < 8; ++j) {
+            dest[i + j] = src[i + j];
+        }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API int32_t U_EXPORT2
+narrowLatin1(const UChar *src, int32_t length, uint8_t *dest) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonLatin1 = _mm_set1_epi16((short)0xff00);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b), nonLatin1);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xffff) { break; }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_packus_epi16(a, b));
+    }
+#elif U_SIMD_NEON
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i));
+        uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(a, b)) > 0xff) { break; }
+        vst1q_u8(dest + i, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        uint64_t word;
+        uprv_memcpy(&word, src + i, 8);
+        if ((word & 0xff00ff00ff00ff00ULL) != 0) { break; }
+        for (int32_t j = 0; j < 4; ++j) {
+            dest[i + j] = (uint8_t)src[i + j];
+        }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API void U_EXPORT2
+fillOffsets(int32_t *offsets, int32_t length, int32_t sourceIndex) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    __m128i v = _mm_add_epi32(_mm_set1_epi32(sourceIndex), _mm_set_epi32(3, 2, 1, 0));
+    const __m128i four = _mm_set1_epi32(4);
+    for (; (length - i) >= 4; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(offsets + i), v);
+        v = _mm_add_epi32(v, four);
+    }
+#elif U_SIMD_NEON
+    static const int32_t steps[4] = { 0, 1, 2, 3 };
+    int32x4_t v = vaddq_s32(vdupq_n_s32(sourceIndex), vld1q_s32(steps));
+    const int32x4_t four = vdupq_n_s32(4);
+    for (; (length - i) >= 4; i += 4) {
+        vst1q_s32(offsets + i, v);
+        v = vaddq_s32(v, four);
+    }
+#endif
+    for (; i < length; ++i) {
+        offsets[i] = sourceIndex + i;
+    }
+}
+
+U_COMMON_API int32_t U_EXPORT2
+spanASCII(const uint8_t *src, int32_t length) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    // Test two blocks at a time where possible, to amortize the branch.
+    for (; (length - i) >= 32; i += 32) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+        if (_mm_movemask_epi8(_mm_or_si128(a, b)) != 0) { break; }
+    }
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        if (_mm_movemask_epi8(v) != 0) { break; }
+    }
+#elif U_SIMD_NEON
+    for (; (length - i) >= 16; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(src + i)) > 0x7f) { break; }
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        uint64_t word;
+        uprv_memcpy(&word, src + i, 8);
+        if ((word & 0x8080808080808080ULL) != 0) { break; }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API int32_t U_EXPORT2
+widenPrintableASCII(const uint8_t *src, int32_t length, UChar *dest, uint8_t stop) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i space = _mm_set1_epi8(0x20);
+    const __m128i stops = _mm_set1_epi8((char)stop);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        // Signed comparison: Bytes >=0x80 are negative and also less than 0x20.
+        __m128i bad = _mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, stops));
+        if (_mm_movemask_epi8(bad) != 0) { break; }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif U_SIMD_NEON
+    const uint8x16_t space = vdupq_n_u8(0x20);
+    const uint8x16_t del = vdupq_n_u8(0x7f);
+    const uint8x16_t stops = vdupq_n_u8(stop);
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        uint8x16_t bad = vorrq_u8(vorrq_u8(vcltq_u8(v, space), vcgtq_u8(v, del)), vceqq_u8(v, stops));
+        if (vmaxvq_u8(bad) != 0) { break; }
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i + 8), vmovl_high_u8(v));
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        int32_t j = 0;
+        while (j < 8 && (uint8_t)(src[i + j] - 0x20) <= 0x5f && src[i + j] != stop) { ++j; }
+        if (j < 8) { break; }
+        for (j = 0; j < 8; ++j) {
+            dest[i + j] = src[i + j];
+        }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API int32_t U_EXPORT2
+narrowPrintableASCII(const UChar *src, int32_t length, uint8_t *dest, uint8_t stop) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonASCII = _mm_set1_epi16((short)0xff80);
+    const __m128i space = _mm_set1_epi8(0x20);
+    const __m128i stops = _mm_set1_epi8((char)stop);
+    for (; (length - i) >= 16; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b), nonASCII);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xffff) { break; }
+        __m128i v = _mm_packus_epi16(a, b);
+        __m128i bad = _mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, stops));
+        if (_mm_movemask_epi8(bad) != 0) { break; }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), v);
+    }
+#elif U_SIMD_NEON
+    const uint8x16_t space = vdupq_n_u8(0x20);
+    const uint8x16_t stops = vdupq_n_u8(stop);
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i));
+        uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(a, b)) > 0x7f) { break; }
+        uint8x16_t v = vcombine_u8(vmovn_u16(a), vmovn_u16(b));
+        if (vmaxvq_u8(vorrq_u8(vcltq_u8(v, space), vceqq_u8(v, stops))) != 0) { break; }
+        vst1q_u8(dest + i, v);
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        int32_t j = 0;
+        while (j < 4 && (UChar)(src[i + j] - 0x20) <= 0x5f && src[i + j] != stop) { ++j; }
+        if (j < 4) { break; }
+        for (j = 0; j < 4; ++j) {
+            dest[i + j] = (uint8_t)src[i + j];
+        }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API int32_t U_EXPORT2
+spanBelow(const uint8_t *src, int32_t length, uint8_t limit) {
+    int32_t i = 0;
+    if (limit == 0) {
+        return 0;
+    }
+#if U_SIMD_SSE2
+    // Bytes below limit saturate to 0 when subtracting limit-1.
+    const __m128i max = _mm_set1_epi8((char)(limit - 1));
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 32; i += 32) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+        __m128i over = _mm_or_si128(_mm_subs_epu8(a, max), _mm_subs_epu8(b, max));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(over, zero)) != 0xffff) { break; }
+    }
+    for (; (length - i) >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(v, max), zero)) != 0xffff) { break; }
+    }
+#elif U_SIMD_NEON
+    for (; (length - i) >= 16; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(src + i)) >= limit) { break; }
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        int32_t j = 0;
+        while (j < 8 && src[i + j] < limit) { ++j; }
+        if (j < 8) { break; }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API int32_t U_EXPORT2
+spanBelow(const UChar *src, int32_t length, UChar limit) {
+    int32_t i = 0;
+    if (limit == 0) {
+        return 0;
+    }
+#if U_SIMD_SSE2
+    // UChars below limit saturate to 0 when subtracting limit-1.
+    const __m128i max = _mm_set1_epi16((short)(limit - 1));
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 16; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+        __m128i over = _mm_or_si128(_mm_subs_epu16(a, max), _mm_subs_epu16(b, max));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(over, zero)) != 0xffff) { break; }
+    }
+#elif U_SIMD_NEON
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i));
+        uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i + 8));
+        if (vmaxvq_u16(vmaxq_u16(a, b)) >= limit) { break; }
+    }
+#else
+    for (; (length - i) >= 4; i += 4) {
+        if (src[i] >= limit || src[i + 1] >= limit || src[i + 2] >= limit || src[i + 3] >= limit) {
+            break;
+        }
+    }
+#endif
+    return i;
+}
+
+U_COMMON_API UBool U_EXPORT2
+andWords(uint32_t *dest, const uint32_t *src, int32_t length) {
+    int32_t i = 0;
+    uint32_t any = 0;
+#if U_SIMD_SSE2
+    __m128i acc = _mm_setzero_si128();
+    for (; (length - i) >= 4; i += 4) {
+        __m128i v = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(dest + i)),
+                                  _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), v);
+        acc = _mm_or_si128(acc, v);
+    }
+    any = _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) != 0xffff;
+#elif U_SIMD_NEON
+    uint32x4_t acc = vdupq_n_u32(0);
+    for (; (length - i) >= 4; i += 4) {
+        uint32x4_t v = vandq_u32(vld1q_u32(dest + i), vld1q_u32(src + i));
+        vst1q_u32(dest + i, v);
+        acc = vorrq_u32(acc, v);
+    }
+    any = vmaxvq_u32(acc);
+#endif
+    for (; i < length; ++i) {
+        any |= (dest[i] &= src[i]);
+    }
+    return any == 0;
+}
+
+}  // namespace simd
+
+U_NAMESPACE_END
@@ -0,0 +1,139 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  usimd.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Block-wise kernels for hot text loops, with SSE2 and NEON versions
+*   and a portable version that works on 64-bit words.
+*   They are not inline, so that they do not perturb the code generation
+*   of the loops that call them.
+*/
+
+#ifndef __USIMD_H__
+#define __USIMD_H__
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+namespace simd {
+
+/**
+ * Copies leading ASCII bytes (<=0x7f) of src to dest, widened to UChars,
+ * in whole blocks of 16 (or 8) bytes. Stops before the first block that
+ * contains a non-ASCII byte or that would extend beyond length bytes,
+ * so that the caller continues with its own loop for the rest.
+ * Writes only as many UChars as it returns.
+ * @return the number of bytes copied
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+widenASCII(const uint8_t *src, int32_t length, UChar *dest);
+
+/**
+ * Copies leading ASCII UChars (<=0x7f) of src to dest, narrowed to bytes,
+ * in whole blocks of 16 (or 4) UChars. Stops before the first block that
+ * contains a non-ASCII UChar or that would extend beyond length UChars,
+ * so that the caller continues with its own loop for the rest.
+ * Writes only as many bytes as it returns.
+ * @return the number of UChars copied
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+narrowASCII(const UChar *src, int32_t length, uint8_t *dest);
+
+/**
+ * Widens src bytes (Latin-1) to UChars in dest, in whole blocks of 16 (or 8) bytes,
+ * up to length bytes. Writes only as many UChars as it returns.
+ * @return the number of bytes copied, length rounded down to whole blocks
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+widenLatin1(const uint8_t *src, int32_t length, UChar *dest);
+
+/**
+ * Copies leading UChars <=0xff of src to dest, narrowed to bytes,
+ * like narrowASCII() but for Latin-1.
+ * @return the number of UChars copied
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+narrowLatin1(const UChar *src, int32_t length, uint8_t *dest);
+
+/**
+ * Sets offsets[i]=sourceIndex+i for i=0..length-1,
+ * for the offsets output of converters that map one unit to one unit.
+ * @internal
+ */
+U_COMMON_API void U_EXPORT2
+fillOffsets(int32_t *offsets, int32_t length, int32_t sourceIndex);
+
+/**
+ * Counts leading ASCII bytes (<=0x7f) in whole blocks of 16 (or 8) bytes,
+ * like widenASCII() but without copying them.
+ * @return the number of bytes in the ASCII blocks
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+spanASCII(const uint8_t *src, int32_t length);
+
+/**
+ * Copies leading bytes 0x20..0x7f other than stop from src to dest, widened to UChars,
+ * like widenASCII() but also stopping before the first block with a C0 control byte
+ * or the stop byte, for converters where those change the state.
+ * @return the number of bytes copied
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+widenPrintableASCII(const uint8_t *src, int32_t length, UChar *dest, uint8_t stop);
+
+/**
+ * Copies leading UChars 0x20..0x7f other than stop from src to dest, narrowed to bytes,
+ * like narrowASCII() but also stopping before the first block with a C0 control
+ * or the stop character.
+ * @return the number of UChars copied
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+narrowPrintableASCII(const UChar *src, int32_t length, uint8_t *dest, uint8_t stop);
+
+/**
+ * Counts leading bytes below limit in whole blocks of 16 (or 8) bytes,
+ * like spanASCII() but with a variable limit, for example a UTF-8 lead byte.
+ * @return the number of bytes in the blocks below limit
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+spanBelow(const uint8_t *src, int32_t length, uint8_t limit);
+
+/**
+ * Counts leading UChars below limit in whole blocks of 16 (or 4) UChars,
+ * for skipping text below a minimum code point with nothing to do.
+ * @return the number of UChars in the blocks below limit
+ * @internal
+ */
+U_COMMON_API int32_t U_EXPORT2
+spanBelow(const UChar *src, int32_t length, UChar limit);
+
+/**
+ * ANDs length words of src into dest, in blocks of 4 words where possible.
+ * @return true if all of the dest words are 0 afterwards
+ * @internal
+ */
+U_COMMON_API UBool U_EXPORT2
+andWords(uint32_t *dest, const uint32_t *src, int32_t length);
+
+}  // namespace simd
+
+U_NAMESPACE_END
+
+#endif  // U_SHOW_CPLUSPLUS_API
+
+#endif  // __USIMD_H__
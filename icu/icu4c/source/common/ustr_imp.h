@@ -46,6 +46,22 @@ ustr_hashCharsN(const char *str, int32_t length);
 U_CAPI int32_t U_EXPORT2
 ustr_hashICharsN(const char *str, int32_t length);
 
+/**
+ * Returns the length of the longest prefix of s[0..length[ that is
+ * well-formed UTF-8, and counts its code points and UTF-16 code units.
+ * Runs of ASCII are skipped in blocks.
+ * Shared by the UTF-8 validation, pre-flighting and UTF-8-to-UTF-8 conversion code.
+ *
+ * @param s UTF-8 string
+ * @param length length of s, must be >=0
+ * @param pNumCodePoints receives the number of code points in the prefix; can be NULL
+ * @param pLength16 receives the number of UTF-16 code units for the prefix; can be NULL
+ * @return the length of the well-formed prefix, in bytes
+ */
+U_CAPI int32_t U_EXPORT2
+ustr_spanWellFormedUTF8(const uint8_t *s, int32_t length,
+                        int32_t *pNumCodePoints, int32_t *pLength16);
+
 /**
  * Convert an ASCII-range lowercase character to uppercase.
  * 
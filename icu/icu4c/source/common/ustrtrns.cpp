@@ -34,8 +34,11 @@
 #include "cstring.h"
 #include "cmemory.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 #include "uassert.h"
 
+U_NAMESPACE_USE
+
 U_CAPI UChar* U_EXPORT2 
 u_strFromUTF32WithSub(UChar *dest,
                int32_t destCapacity,
@@ -377,6 +380,7 @@ u_strFromUTF8WithSub(UChar *dest,
     } else /* srcLength >= 0 */ {
         /* Faster loop without ongoing checking for srcLength and pDestLimit. */
         int32_t i = 0;
+        int32_t checkInterval = 16;
         UChar32 c;
         for(;;) {
             /*
@@ -398,13 +402,33 @@ u_strFromUTF8WithSub(UChar *dest,
                 break;
             }
 
+            /*
+             * Copy ASCII in blocks, each byte counting as one iteration.
+             * Then convert a limited number of characters one by one
+             * before looking for ASCII blocks again.
+             */
+            int32_t n = simd::widenASCII((const uint8_t *)src + i, count, pDest);
+            if(n > 0) {
+                i += n;
+                pDest += n;
+                count -= n;
+                checkInterval = 16;
+            } else if(checkInterval < 1024) {
+                checkInterval <<= 1;
+            }
+            if(count == 0) {
+                continue;
+            } else if(count > checkInterval) {
+                count = checkInterval;
+            }
+
             do {
                 // modified copy of U8_NEXT()
                 c = (uint8_t)src[i++];
                 if(U8_IS_SINGLE(c)) {
                     *pDest++=(UChar)c;
                 } else {
-                    uint8_t __t1, __t2;
+                    uint8_t __t1, __t2, __t3;
                     if( /* handle U+0800..U+FFFF inline */
                             (0xe0<=(c) && (c)<0xf0) &&
                             ((i)+1)<srcLength &&
@@ -429,6 +453,19 @@ u_strFromUTF8WithSub(UChar *dest,
                             }
                         }
 
+                        if( /* handle U+10000..U+10FFFF inline */
+                                (uint8_t)(c-0xf0)<=4 &&
+                                ((i)+2)<srcLength &&
+                                U8_IS_VALID_LEAD4_AND_T1((c), src[i]) &&
+                                (__t2=src[(i)+1]-0x80)<=0x3f &&
+                                (__t3=src[(i)+2]-0x80)<=0x3f) {
+                            c = (((c)&7)<<18)|((src[i]&0x3f)<<12)|(__t2<<6)|__t3;
+                            i+=3;
+                            *(pDest++)=U16_LEAD(c);
+                            *(pDest++)=U16_TRAIL(c);
+                            continue;
+                        }
+
                         /* function call for "complicated" and error cases */
                         (c)=utf8_nextCharSafeBody((const uint8_t *)src, &(i), srcLength, c, -1);
                         if(c<0 && (++numSubstitutions, c = subchar) < 0) {
@@ -486,36 +523,20 @@ u_strFromUTF8WithSub(UChar *dest,
             }
         }
 
-        /* Pre-flight the rest of the string. */
+        /* Pre-flight the rest of the string, well-formed parts in bulk. */
         while(i < srcLength) {
-            // modified copy of U8_NEXT()
-            c = (uint8_t)src[i++];
-            if(U8_IS_SINGLE(c)) {
-                ++reqLength;
-            } else {
-                uint8_t __t1, __t2;
-                if( /* handle U+0800..U+FFFF inline */
-                        (0xe0<=(c) && (c)<0xf0) &&
-                        ((i)+1)<srcLength &&
-                        U8_IS_VALID_LEAD3_AND_T1((c), src[i]) &&
-                        (__t2=src[(i)+1]-0x80)<=0x3f) {
-                    ++reqLength;
-                    i+=2;
-                } else if( /* handle U+0080..U+07FF inline */
-                        ((c)<0xe0 && (c)>=0xc2) &&
-                        ((i)!=srcLength) &&
-                        (__t1=src[i]-0x80)<=0x3f) {
-                    ++reqLength;
-                    ++(i);
-                } else {
-                    /* function call for "complicated" and error cases */
-                    (c)=utf8_nextCharSafeBody((const uint8_t *)src, &(i), srcLength, c, -1);
-                    if(c<0 && (++numSubstitutions, c = subchar) < 0) {
-                        *pErrorCode = U_INVALID_CHAR_FOUND;
-                        return NULL;
-                    }
-                    reqLength += U16_LENGTH(c);
+            int32_t length16;
+            i += ustr_spanWellFormedUTF8((const uint8_t *)src + i, srcLength - i, NULL, &length16);
+            reqLength += length16;
+            if(i < srcLength) {
+                /* ill-formed sequence */
+                c = (uint8_t)src[i++];
+                (c)=utf8_nextCharSafeBody((const uint8_t *)src, &(i), srcLength, c, -1);
+                if(c<0 && (++numSubstitutions, c = subchar) < 0) {
+                    *pErrorCode = U_INVALID_CHAR_FOUND;
+                    return NULL;
                 }
+                reqLength += U16_LENGTH(c);
             }
         }
     }
@@ -767,6 +788,85 @@ u_strFromUTF8Lenient(UChar *dest,
     return dest;
 }
 
+U_CAPI int32_t U_EXPORT2
+ustr_spanWellFormedUTF8(const uint8_t *s, int32_t length,
+                        int32_t *pNumCodePoints, int32_t *pLength16) {
+    int32_t i = 0;
+    int32_t numCodePoints = 0;
+    int32_t numSupplementary = 0;
+    int32_t checkInterval = 16;
+    while(i < length) {
+        /*
+         * Skip ASCII in blocks.
+         * Then check a limited number of bytes one sequence at a time
+         * before looking for ASCII blocks again.
+         */
+        int32_t n = simd::spanASCII(s + i, length - i);
+        if(n > 0) {
+            i += n;
+            numCodePoints += n;
+            checkInterval = 16;
+        } else if(checkInterval < 1024) {
+            checkInterval <<= 1;
+        }
+        int32_t limit = (length - i) > checkInterval ? i + checkInterval : length;
+        while(i < limit) {
+            uint8_t c = s[i];
+            if(U8_IS_SINGLE(c)) {
+                ++i;
+            } else if( /* U+0800..U+FFFF */
+                    (0xe0 <= c && c < 0xf0) &&
+                    (i + 2) < length &&
+                    U8_IS_VALID_LEAD3_AND_T1(c, s[i + 1]) &&
+                    U8_IS_TRAIL(s[i + 2])) {
+                i += 3;
+            } else if( /* U+0080..U+07FF */
+                    (c < 0xe0 && c >= 0xc2) &&
+                    (i + 1) < length &&
+                    U8_IS_TRAIL(s[i + 1])) {
+                i += 2;
+            } else if( /* U+10000..U+10FFFF */
+                    (uint8_t)(c - 0xf0) <= 4 &&
+                    (i + 3) < length &&
+                    U8_IS_VALID_LEAD4_AND_T1(c, s[i + 1]) &&
+                    U8_IS_TRAIL(s[i + 2]) &&
+                    U8_IS_TRAIL(s[i + 3])) {
+                i += 4;
+                ++numSupplementary;
+            } else {
+                /* ill-formed */
+                length = i;
+                break;
+            }
+            ++numCodePoints;
+        }
+    }
+    if(pNumCodePoints != NULL) {
+        *pNumCodePoints = numCodePoints;
+    }
+    if(pLength16 != NULL) {
+        *pLength16 = numCodePoints + numSupplementary;
+    }
+    return i;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_validateUTF8(const char *src, int32_t srcLength,
+               int32_t *pNumCodePoints, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return -1;
+    }
+    if((src==NULL && srcLength!=0) || srcLength < -1) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+    if(srcLength < 0) {
+        srcLength = (int32_t)uprv_strlen(src);
+    }
+    int32_t length = ustr_spanWellFormedUTF8((const uint8_t *)src, srcLength, pNumCodePoints, NULL);
+    return length == srcLength ? -1 : length;
+}
+
 static inline uint8_t *
 _appendUTF8(uint8_t *pDest, UChar32 c) {
     /* it is 0<=c<=0x10ffff and not a surrogate if called by a validating function */
@@ -896,6 +996,7 @@ u_strToUTF8WithSub(char *dest,
     } else {
         const UChar *pSrcLimit = (pSrc!=NULL)?(pSrc+srcLength):NULL;
         int32_t count;
+        int32_t checkInterval = 16;
 
         /* Faster loop without ongoing checking for pSrcLimit and pDestLimit. */
         for(;;) {
@@ -917,6 +1018,28 @@ u_strToUTF8WithSub(char *dest,
                  */
                 break;
             }
+
+            /*
+             * Copy ASCII in blocks, each UChar counting as one iteration.
+             * Then convert a limited number of characters one by one
+             * before looking for ASCII blocks again.
+             * Skip the call if the next UChar is not ASCII anyway.
+             */
+            int32_t n = *pSrc <= 0x7f ? simd::narrowASCII(pSrc, count, pDest) : 0;
+            if(n > 0) {
+                pSrc += n;
+                pDest += n;
+                count -= n;
+                checkInterval = 16;
+            } else if(checkInterval < 1024) {
+                checkInterval <<= 1;
+            }
+            if(count == 0) {
+                continue;
+            } else if(count > checkInterval) {
+                count = checkInterval;
+            }
+
             do {
                 ch=*pSrc++;
                 if(ch <= 0x7f) {
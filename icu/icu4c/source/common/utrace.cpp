@@ -444,6 +444,7 @@ static const char * const
 trFnName[] = {
     "u_init",
     "u_cleanup",
+    "u_initCategory",
     NULL
 };
 
@@ -486,6 +487,16 @@ trResDataNames[] = {
     NULL
 };
 
+
+static const char* const
+trCacheNames[] = {
+    "ucache-create",
+    "ucache-wait",
+    "ucache-evict",
+    "ucache-memory-evict",
+    NULL
+};
+
                 
 U_CAPI const char * U_EXPORT2
 utrace_functionName(int32_t fnNumber) {
@@ -497,6 +508,8 @@ utrace_functionName(int32_t fnNumber) {
         return trCollNames[fnNumber - UTRACE_COLLATION_START];
     } else if(UTRACE_UDATA_START <= fnNumber && fnNumber < UTRACE_RES_DATA_LIMIT){
         return trResDataNames[fnNumber - UTRACE_UDATA_START];
+    } else if(UTRACE_UCACHE_START <= fnNumber && fnNumber < UTRACE_UCACHE_LIMIT){
+        return trCacheNames[fnNumber - UTRACE_UCACHE_START];
     } else {
         return "[BOGUS Trace Function Number]";
     }
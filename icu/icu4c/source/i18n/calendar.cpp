@@ -207,6 +207,22 @@ SharedCalendar::~SharedCalendar() {
     delete ptr;
 }
 
+int32_t
+SharedCalendar::getMemoryUsage() const {
+    // Roughly a calendar and its time zone.
+    // The time zone rules stay in the zoneinfo64 resource bundle.
+    int32_t size = (int32_t)sizeof(*this);
+    if (ptr != nullptr) {
+        size += (int32_t)(sizeof(GregorianCalendar) + sizeof(OlsonTimeZone));
+    }
+    return size;
+}
+
+template<> U_I18N_API
+const char *CacheKey<SharedCalendar>::typeName() const {
+    return "SharedCalendar";
+}
+
 template<> U_I18N_API
 const SharedCalendar *LocaleCacheKey<SharedCalendar>::createObject(
         const void * /*unusedCreationContext*/, UErrorCode &status) const {
@@ -48,6 +48,16 @@ CollationSettings::~CollationSettings() {
     }
 }
 
+int32_t
+CollationSettings::getMemoryUsage() const {
+    int32_t size = (int32_t)sizeof(*this);
+    if(reorderCodesCapacity != 0) {
+        // The codes, the ranges, and the table, see setReorderArrays().
+        size += reorderCodesCapacity * 4 + 256;
+    }
+    return size;
+}
+
 bool
 CollationSettings::operator==(const CollationSettings &other) const {
     if(options != other.options) { return false; }
@@ -115,6 +115,8 @@ struct U_I18N_API CollationSettings : public SharedObject {
     CollationSettings(const CollationSettings &other);
     virtual ~CollationSettings();
 
+    virtual int32_t getMemoryUsage() const override;
+
     bool operator==(const CollationSettings &other) const;
 
     inline bool operator!=(const CollationSettings &other) const {
@@ -104,10 +104,48 @@ CollationTailoring::getUCAVersion() const {
     return ((int32_t)version[1] << 4) | (version[2] >> 6);
 }
 
+int32_t
+CollationTailoring::getMemoryUsage() const {
+    int32_t size = (int32_t)sizeof(*this) + rules.length() * U_SIZEOF_UCHAR;
+    if(ownedData != NULL) {
+        size += (int32_t)sizeof(CollationData);
+        if(memory == NULL && bundle == NULL) {
+            // Built from rules: The data arrays and the trie are on the heap,
+            // rather than in memory-mapped data.
+            size += ownedData->ce32sLength * 4 + ownedData->cesLength * 8 +
+                    ownedData->contextsLength * U_SIZEOF_UCHAR +
+                    ownedData->fastLatinTableLength * 2;
+            if(trie != NULL) {
+                UErrorCode errorCode = U_ZERO_ERROR;
+                size += utrie2_serialize(trie, NULL, 0, &errorCode);
+            }
+        }
+    }
+    if(unsafeBackwardSet != NULL) {
+        size += (int32_t)sizeof(UnicodeSet) +
+                unsafeBackwardSet->getRangeCount() * 2 * (int32_t)sizeof(UChar32);
+    }
+    if(settings != NULL) {
+        size += settings->getMemoryUsage();
+    }
+    return size;
+}
+
 CollationCacheEntry::~CollationCacheEntry() {
     SharedObject::clearPtr(tailoring);
 }
 
+int32_t
+CollationCacheEntry::getMemoryUsage() const {
+    // A tailoring may be shared by the entries for several locales,
+    // in which case it is counted for each of them.
+    int32_t size = (int32_t)sizeof(*this);
+    if(tailoring != NULL) {
+        size += tailoring->getMemoryUsage();
+    }
+    return size;
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -62,6 +62,8 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     void setVersion(const UVersionInfo baseVersion, const UVersionInfo rulesVersion);
     int32_t getUCAVersion() const;
 
+    virtual int32_t getMemoryUsage() const override;
+
     // data for sorting etc.
     const CollationData *data;  // == base data or ownedData
     const CollationSettings *settings;  // reference-counted
@@ -103,6 +105,8 @@ struct U_I18N_API CollationCacheEntry : public SharedObject {
     }
     ~CollationCacheEntry();
 
+    virtual int32_t getMemoryUsage() const override;
+
     Locale validLocale;
     const CollationTailoring *tailoring;
 };
@@ -149,7 +149,7 @@ void CharsetDetector::setRecognizers(UErrorCode &status)
 
 CharsetDetector::CharsetDetector(UErrorCode &status)
   : textIn(new InputText(status)), resultArray(NULL),
-    resultCount(0), fStripTags(false), fFreshTextSet(false),
+    resultCount(0), fStripTags(false), fFreshTextSet(false), fNextRecognizer(0),
     fEnabledRecognizers(NULL)
 {
     if (U_FAILURE(status)) {
@@ -200,6 +200,12 @@ void CharsetDetector::setText(const char *in, int32_t len)
     fFreshTextSet = true;
 }
 
+void CharsetDetector::appendText(const char *in, int32_t len, UErrorCode &status)
+{
+    textIn->appendText(in, len, status);
+    fFreshTextSet = true;
+}
+
 UBool CharsetDetector::setStripTagsFlag(UBool flag)
 {
     UBool temp = fStripTags;
@@ -227,47 +233,66 @@ int32_t CharsetDetector::getDetectableCount()
     return fCSRecognizers_size; 
 }
 
-const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
+void CharsetDetector::runRecognizers(UBool stopWhenCertain, UErrorCode &status)
 {
-    int32_t maxMatchesFound = 0;
+    if (fFreshTextSet) {
+        textIn->MungeInput(fStripTags);
+        resultCount = 0;
+        fNextRecognizer = 0;
+        fFreshTextSet = false;
+    }
 
-    detectAll(maxMatchesFound, status);
+    if (fNextRecognizer == fCSRecognizers_size) {
+        return;
+    }
 
-    if(maxMatchesFound > 0) {
-        return resultArray[0];
-    } else {
-        return NULL;
+    // Iterate over the possible charsets not yet tried, remember all that
+    // give a match quality > 0.
+    // Nothing can outrank a match with confidence 100, and the stable sort keeps
+    // it ahead of later ones with the same confidence, so detect() can stop there
+    // and leave the remaining recognizers for a subsequent detectAll().
+    while (fNextRecognizer < fCSRecognizers_size) {
+        CharsetRecognizer *csr = fCSRecognizers[fNextRecognizer++]->recognizer;
+        if (csr->match(textIn, resultArray[resultCount])) {
+            if (resultArray[resultCount++]->getConfidence() >= 100 && stopWhenCertain) {
+                break;
+            }
+        }
+    }
+
+    if (resultCount > 1) {
+        uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, true, &status);
     }
 }
 
-const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound, UErrorCode &status)
+const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
 {
     if(!textIn->isSet()) {
         status = U_MISSING_RESOURCE_ERROR;// TODO:  Need to set proper status code for input text not set
 
         return NULL;
-    } else if (fFreshTextSet) {
-        CharsetRecognizer *csr;
-        int32_t            i;
+    }
 
-        textIn->MungeInput(fStripTags);
+    runRecognizers(true, status);
 
-        // Iterate over all possible charsets, remember all that
-        // give a match quality > 0.
-        resultCount = 0;
-        for (i = 0; i < fCSRecognizers_size; i += 1) {
-            csr = fCSRecognizers[i]->recognizer;
-            if (csr->match(textIn, resultArray[resultCount])) {
-                resultCount++;
-            }
-        }
+    if (resultCount == 0) {
+        status = U_INVALID_CHAR_FOUND;
+        return NULL;
+    }
 
-        if (resultCount > 1) {
-            uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, true, &status);
-        }
-        fFreshTextSet = false;
+    return resultArray[0];
+}
+
+const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound, UErrorCode &status)
+{
+    if(!textIn->isSet()) {
+        status = U_MISSING_RESOURCE_ERROR;// TODO:  Need to set proper status code for input text not set
+
+        return NULL;
     }
 
+    runRecognizers(false, status);
+
     maxMatchesFound = resultCount;
 
     if (maxMatchesFound == 0) {
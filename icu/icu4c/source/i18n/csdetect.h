@@ -30,7 +30,9 @@ class CharsetDetector : public UMemory
     int32_t resultCount;
     UBool fStripTags;   // If true, setText() will strip tags from input text.
     UBool fFreshTextSet;
+    int32_t fNextRecognizer;    // Index of the first recognizer not yet run on the current text.
     static void setRecognizers(UErrorCode &status);
+    void runRecognizers(UBool stopWhenCertain, UErrorCode &status);
 
     UBool *fEnabledRecognizers;  // If not null, active set of charset recognizers had
                                 // been changed from the default. The array index is
@@ -43,6 +45,8 @@ class CharsetDetector : public UMemory
 
     void setText(const char *in, int32_t len);
 
+    void appendText(const char *in, int32_t len, UErrorCode &status);
+
     const CharsetMatch * const *detectAll(int32_t &maxMatchesFound, UErrorCode &status);
 
     const CharsetMatch *detect(UErrorCode& status);
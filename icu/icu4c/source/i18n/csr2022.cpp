@@ -147,8 +147,10 @@ const char *CharsetRecog_2022JP::getName() const {
 }
 
 UBool CharsetRecog_2022JP::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes, 
-                                    textIn->fInputLen, 
+    // Without an ESC byte there are no escape sequences to match.
+    int32_t confidence = textIn->fByteStats[0x1B] == 0 ? 0 :
+                         match_2022(textIn->fInputBytes,
+                                    textIn->fInputLen,
                                     escapeSequences_2022JP, 
                                     UPRV_LENGTHOF(escapeSequences_2022JP));
     results->set(textIn, this, confidence);
@@ -163,8 +165,9 @@ const char *CharsetRecog_2022KR::getName() const {
 }
 
 UBool CharsetRecog_2022KR::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes, 
-                                    textIn->fInputLen, 
+    int32_t confidence = textIn->fByteStats[0x1B] == 0 ? 0 :
+                         match_2022(textIn->fInputBytes,
+                                    textIn->fInputLen,
                                     escapeSequences_2022KR, 
                                     UPRV_LENGTHOF(escapeSequences_2022KR));
     results->set(textIn, this, confidence);
@@ -178,7 +181,8 @@ const char *CharsetRecog_2022CN::getName() const {
 }
 
 UBool CharsetRecog_2022CN::match(InputText *textIn, CharsetMatch *results) const {
-    int32_t confidence = match_2022(textIn->fInputBytes,
+    int32_t confidence = textIn->fByteStats[0x1B] == 0 ? 0 :
+                         match_2022(textIn->fInputBytes,
                                     textIn->fInputLen,
                                     escapeSequences_2022CN,
                                     UPRV_LENGTHOF(escapeSequences_2022CN));
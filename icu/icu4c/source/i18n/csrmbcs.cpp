@@ -146,14 +146,41 @@ CharsetRecog_mbcs::~CharsetRecog_mbcs()
 }
 
 int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars[], int32_t commonCharsLen) const {
-    int32_t doubleByteCharCount = 0;
-    int32_t commonCharCount     = 0;
-    int32_t badCharCount        = 0;
-    int32_t totalCharCount      = 0;
+    // Continue where the scan of the text before any appended text stopped.
+    RawScanState *state = det->getRawScanState(this);
+    int32_t doubleByteCharCount = state->counts[0];
+    int32_t commonCharCount     = state->counts[1];
+    int32_t badCharCount        = state->counts[2];
+    int32_t totalCharCount      = state->counts[3];
     int32_t confidence          = 0;
+    UBool   cutOff              = false;
     IteratedChar iter;
 
+    if (state->done) {
+        // Bailed out on the text before any appended text.
+        return confidence;
+    }
+
+    // Each leading ASCII byte is a single-byte character in all of these charsets.
+    if (state->index < det->fRawASCIILength) {
+        totalCharCount += det->fRawASCIILength - state->index;
+        state->index = det->fRawASCIILength;
+    }
+
+    iter.nextIndex = state->index;
+
     while (nextChar(&iter, det)) {
+        if (iter.done) {
+            // The last character is cut off. Count it for now,
+            //   but scan it again with appended text.
+            state->index = iter.index;
+            state->counts[0] = doubleByteCharCount;
+            state->counts[1] = commonCharCount;
+            state->counts[2] = badCharCount;
+            state->counts[3] = totalCharCount;
+            cutOff = true;
+        }
+
         totalCharCount++;
 
         if (iter.error) {
@@ -174,10 +201,19 @@ int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars
         if (badCharCount >= 2 && badCharCount*5 >= doubleByteCharCount) {
             // Bail out early if the byte data is not matching the encoding scheme.
             // break detectBlock;
+            state->done = !cutOff;
             return confidence;
         }
     }
 
+    if (!cutOff) {
+        state->index = iter.nextIndex;
+        state->counts[0] = doubleByteCharCount;
+        state->counts[1] = commonCharCount;
+        state->counts[2] = badCharCount;
+        state->counts[3] = totalCharCount;
+    }
+
     if (doubleByteCharCount <= 10 && badCharCount == 0) {
         // Not many multi-byte chars.
         if (doubleByteCharCount == 0 && totalCharCount < 10) {
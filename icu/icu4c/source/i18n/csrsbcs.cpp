@@ -127,6 +127,140 @@ int32_t NGramParser::parse(InputText *det)
     // TODO: Is this OK? The buffer could have ended in the middle of a word...
     addByte(0x20);
 
+    return confidence(hitCount, ngramCount);
+}
+
+const NGramStats *NGramParser::getStats(InputText *det, const uint8_t *charMap)
+{
+    const NGramStats *found = det->getNGramStats(charMap);
+
+    if (found != NULL) {
+        return found;
+    }
+
+    int32_t *ngrams = det->getNGramScratch();
+
+    if (ngrams == NULL) {
+        return NULL;
+    }
+
+    // Same n-grams as parseCharacters() and parse().
+    int32_t *sorted = ngrams + det->fInputLen + 1;
+    int32_t ngramCount = 0;
+    int32_t ngram = 0;
+    bool ignoreSpace = false;
+
+    for (int32_t i = 0; i < det->fInputLen; i += 1) {
+        uint8_t mb = charMap[det->fInputBytes[i]];
+
+        if (mb != 0) {
+            if (!(mb == 0x20 && ignoreSpace)) {
+                ngram = ((ngram << 8) + mb) & N_GRAM_MASK;
+                ngrams[ngramCount++] = ngram;
+            }
+
+            ignoreSpace = (mb == 0x20);
+        }
+    }
+
+    ngram = ((ngram << 8) + 0x20) & N_GRAM_MASK;
+    ngrams[ngramCount++] = ngram;
+
+    // Radix sort, one byte of the n-grams per pass.
+    int32_t *src = ngrams;
+    int32_t *dest = sorted;
+
+    for (int32_t shift = 0; shift < N_GRAM_SIZE * 8; shift += 8) {
+        int32_t starts[256];
+        int32_t i, start;
+
+        uprv_memset(starts, 0, sizeof(starts));
+        for (i = 0; i < ngramCount; i += 1) {
+            starts[(src[i] >> shift) & 0xFF] += 1;
+        }
+
+        for (i = 0, start = 0; i < 256; i += 1) {
+            int32_t count = starts[i];
+            starts[i] = start;
+            start += count;
+        }
+
+        for (i = 0; i < ngramCount; i += 1) {
+            dest[starts[(src[i] >> shift) & 0xFF]++] = src[i];
+        }
+
+        int32_t *temp = src;
+        src = dest;
+        dest = temp;
+    }
+
+    int32_t length = 1;
+
+    for (int32_t i = 1; i < ngramCount; i += 1) {
+        if (src[i] != src[i - 1]) {
+            length += 1;
+        }
+    }
+
+    NGramStats *stats = det->addNGramStats(charMap, length);
+
+    if (stats == NULL) {
+        return NULL;
+    }
+
+    int32_t j = -1;
+
+    for (int32_t i = 0; i < ngramCount; i += 1) {
+        if (i == 0 || src[i] != src[i - 1]) {
+            j += 1;
+            stats->values[j] = src[i];
+            stats->counts[j] = 0;
+        }
+
+        stats->counts[j] += 1;
+    }
+
+    stats->total = ngramCount;
+    return stats;
+}
+
+int32_t NGramParser::parse(const NGramStats *stats, const int32_t *ngramList)
+{
+    int32_t hitCount = 0;
+    int32_t start = 0;
+
+    // Both lists are normally sorted: Look up each n-gram of the 64 in the rest of the statistics.
+    for (int32_t i = 0; i < 64; i += 1) {
+        int32_t value = ngramList[i];
+        int32_t limit = stats->length;
+
+        if (i > 0 && value <= ngramList[i - 1]) {
+            if (value == ngramList[i - 1]) {
+                continue;
+            }
+            start = 0;  // not sorted after all
+        }
+
+        while (start < limit) {
+            int32_t mid = (start + limit) / 2;
+
+            if (stats->values[mid] < value) {
+                start = mid + 1;
+            } else {
+                limit = mid;
+            }
+        }
+
+        if (start < stats->length && stats->values[start] == value) {
+            hitCount += stats->counts[start];
+        }
+    }
+
+    return confidence(hitCount, stats->total);
+}
+
+int32_t NGramParser::confidence(int32_t hitCount, int32_t ngramCount)
+{
     double rawPercent = (double) hitCount / (double) ngramCount;
 
     //            if (rawPercent <= 2.0) {
@@ -253,6 +387,13 @@ CharsetRecog_sbcs::~CharsetRecog_sbcs()
 
 int32_t CharsetRecog_sbcs::match_sbcs(InputText *det, const int32_t ngrams[],  const uint8_t byteMap[]) const
 {
+    // Recognizers and languages with the same byteMap share one n-gram count.
+    const NGramStats *stats = NGramParser::getStats(det, byteMap);
+
+    if (stats != NULL) {
+        return NGramParser::parse(stats, ngrams);
+    }
+
     NGramParser parser(ngrams, byteMap);
     int32_t result;
 
@@ -51,6 +51,21 @@ class NGramParser : public UMemory
 public:
     int32_t parse(InputText *det);
 
+    /*
+     * Returns the statistics of the n-grams that parse() looks up with charMap,
+     * computing them on first use for the current input,
+     * or NULL if they cannot be computed.
+     */
+    static const NGramStats *getStats(InputText *det, const uint8_t *charMap);
+
+    /*
+     * Returns the same confidence as parse() for the ngramList,
+     * from the statistics of its charMap.
+     */
+    static int32_t parse(const NGramStats *stats, const int32_t *ngramList);
+
+private:
+    static int32_t confidence(int32_t hitCount, int32_t ngramCount);
 };
 
 #if !UCONFIG_ONLY_HTML_CONVERSION
@@ -124,25 +124,38 @@ UBool CharsetRecog_UTF_32::match(InputText* textIn, CharsetMatch *results) const
 {
     const uint8_t *input = textIn->fRawInput;
     int32_t limit = (textIn->fRawLength / 4) * 4;
-    int32_t numValid = 0;
-    int32_t numInvalid = 0;
+    // Continue where the scan of the text before any appended text stopped.
+    RawScanState *state = textIn->getRawScanState(this);
+    int32_t numValid = state->counts[0];
+    int32_t numInvalid = state->counts[1];
     bool hasBOM = false;
     int32_t confidence = 0;
+    int32_t i;
 
     if (limit > 0 && getChar(input, 0) == 0x0000FEFFUL) {
         hasBOM = true;
     }
 
-    for(int32_t i = 0; i < limit; i += 4) {
+    for(i = state->index; i < limit; i += 4) {
         int32_t ch = getChar(input, i);
 
         if (ch < 0 || ch >= 0x10FFFF || (ch >= 0xD800 && ch <= 0xDFFF)) {
             numInvalid += 1;
+            // Stop when even all-valid remaining characters could not raise the confidence above 0.
+            // Appended text continues after this character.
+            if ((int64_t)numInvalid * 10 >= numValid + (limit - i) / 4) {
+                i += 4;
+                break;
+            }
         } else {
             numValid += 1;
         }
     }
 
+    state->index = i;
+    state->counts[0] = numValid;
+    state->counts[1] = numInvalid;
+
 
     // Cook up some sort of confidence score, based on presence of a BOM
     //    and the existence of valid and/or invalid multi-byte sequences.
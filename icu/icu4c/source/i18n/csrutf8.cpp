@@ -13,6 +13,7 @@
 
 #include "csrutf8.h"
 #include "csmatch.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
@@ -28,10 +29,13 @@ const char *CharsetRecog_UTF8::getName() const
 
 UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
     bool hasBOM = false;
-    int32_t numValid = 0;
-    int32_t numInvalid = 0;
+    // Continue where the scan of the text before any appended text stopped.
+    RawScanState *state = input->getRawScanState(this);
+    int32_t numValid = state->counts[0];
+    int32_t numInvalid = state->counts[1];
     const uint8_t *inputBytes = input->fRawInput;
     int32_t i;
+    int32_t scanLimit = input->fRawLength;
     int32_t trailBytes = 0;
     int32_t confidence;
 
@@ -41,11 +45,14 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
     }
 
     // Scan for multi-byte sequences
-    for (i=0; i < input->fRawLength; i += 1) {
+    i = state->index > input->fRawASCIILength ? state->index : input->fRawASCIILength;
+    for (; i < input->fRawLength; i += 1) {
         int32_t b = inputBytes[i];
 
         if ((b & 0x80) == 0) {
-            continue;   // ASCII
+            // ASCII, skip whole blocks of it
+            i += simd::spanASCII(inputBytes + i + 1, input->fRawLength - (i + 1));
+            continue;
         }
 
         // Hi bit on char found.  Figure out how long the sequence should be
@@ -61,10 +68,13 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
         }
 
         // Verify that we've got the right number of trail bytes in the sequence
+        int32_t start = i;
         for (;;) {
             i += 1;
 
             if (i >= input->fRawLength) {
+                // Truncated, neither valid nor invalid: Look at it again with appended text.
+                scanLimit = start;
                 break;
             }
 
@@ -83,6 +93,10 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
 
     }
 
+    state->index = scanLimit;
+    state->counts[0] = numValid;
+    state->counts[1] = numInvalid;
+
     // Cook up some sort of confidence score, based on presence of a BOM
     //    and the existence of valid and/or invalid multi-byte sequences.
     confidence = 0;
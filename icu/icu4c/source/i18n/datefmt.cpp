@@ -53,11 +53,21 @@ class DateFmtBestPattern : public SharedObject {
     DateFmtBestPattern(const UnicodeString &pattern)
             : fPattern(pattern) { }
     ~DateFmtBestPattern();
+    virtual int32_t getMemoryUsage() const override;
 };
 
 DateFmtBestPattern::~DateFmtBestPattern() {
 }
 
+int32_t DateFmtBestPattern::getMemoryUsage() const {
+    return (int32_t)sizeof(*this) + fPattern.length() * U_SIZEOF_UCHAR;
+}
+
+template<>
+const char *CacheKey<DateFmtBestPattern>::typeName() const {
+    return "DateFmtBestPattern";
+}
+
 template<> 
 const DateFmtBestPattern *LocaleCacheKey<DateFmtBestPattern>::createObject(
         const void * /*creationContext*/, UErrorCode &status) const {
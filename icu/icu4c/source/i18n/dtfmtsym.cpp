@@ -172,6 +172,59 @@ U_NAMESPACE_BEGIN
 SharedDateFormatSymbols::~SharedDateFormatSymbols() {
 }
 
+namespace {
+
+int32_t getStringsMemoryUsage(const UnicodeString *strings, int32_t count) {
+    int32_t size = count * (int32_t)sizeof(UnicodeString);
+    for (int32_t i = 0; i < count; ++i) {
+        size += strings[i].length() * U_SIZEOF_UCHAR;
+    }
+    return size;
+}
+
+}  // namespace
+
+int32_t
+SharedDateFormatSymbols::getMemoryUsage() const {
+    // Roughly the name arrays that DateFormatSymbols allocates.
+    // Most strings are short enough to fit into their UnicodeString objects,
+    // so this overestimates a little, which balances the arrays not counted here.
+    int32_t size = (int32_t)sizeof(*this);
+    int32_t count;
+    const UnicodeString *strings = dfs.getEras(count);
+    size += getStringsMemoryUsage(strings, count);
+    strings = dfs.getEraNames(count);
+    size += getStringsMemoryUsage(strings, count);
+    strings = dfs.getNarrowEras(count);
+    size += getStringsMemoryUsage(strings, count);
+    strings = dfs.getAmPmStrings(count);
+    size += getStringsMemoryUsage(strings, count);
+    static const DateFormatSymbols::DtWidthType widths[] = {
+        DateFormatSymbols::ABBREVIATED, DateFormatSymbols::WIDE,
+        DateFormatSymbols::NARROW, DateFormatSymbols::SHORT
+    };
+    for (int32_t context = 0; context < DateFormatSymbols::DT_CONTEXT_COUNT; ++context) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(widths); ++i) {
+            DateFormatSymbols::DtContextType contextType =
+                (DateFormatSymbols::DtContextType)context;
+            strings = dfs.getWeekdays(count, contextType, widths[i]);
+            size += getStringsMemoryUsage(strings, count);
+            if (widths[i] != DateFormatSymbols::SHORT) {
+                strings = dfs.getMonths(count, contextType, widths[i]);
+                size += getStringsMemoryUsage(strings, count);
+                strings = dfs.getQuarters(count, contextType, widths[i]);
+                size += getStringsMemoryUsage(strings, count);
+            }
+        }
+    }
+    return size;
+}
+
+template<> U_I18N_API
+const char *CacheKey<SharedDateFormatSymbols>::typeName() const {
+    return "SharedDateFormatSymbols";
+}
+
 template<> U_I18N_API
 const SharedDateFormatSymbols *
         LocaleCacheKey<SharedDateFormatSymbols>::createObject(
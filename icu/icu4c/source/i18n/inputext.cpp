@@ -15,6 +15,7 @@
 
 #include "cmemory.h"
 #include "cstring.h"
+#include "usimd.h"
 
 #include <string.h>
 
@@ -30,9 +31,17 @@ InputText::InputText(UErrorCode &status)
                                                  //   removed if appropriate.
       fByteStats(NEW_ARRAY(int16_t, 256)),       // byte frequency statistics for the input text.
                                                  //   Value is percent, not absolute.
+      fRawASCIILength(0),
       fDeclaredEncoding(0),
       fRawInput(0),
-      fRawLength(0)
+      fRawLength(0),
+      fNGramStatsCount(0),
+      fNGramScratch(0),
+      fRawScanStatesCount(0),
+      fOwnedInput(0),
+      fOwnedCapacity(0),
+      fInputFull(false),
+      fInputFullStripTags(false)
 {
     if (fInputBytes == NULL || fByteStats == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -41,6 +50,11 @@ InputText::InputText(UErrorCode &status)
 
 InputText::~InputText()
 {
+    for (int32_t i = 0; i < fNGramStatsCount; i += 1) {
+        DELETE_ARRAY(fNGramStats[i].values);
+    }
+    DELETE_ARRAY(fNGramScratch);
+    DELETE_ARRAY(fOwnedInput);
     DELETE_ARRAY(fDeclaredEncoding);
     DELETE_ARRAY(fByteStats);
     DELETE_ARRAY(fInputBytes);
@@ -50,8 +64,69 @@ void InputText::setText(const char *in, int32_t len)
 {
     fInputLen  = 0;
     fC1Bytes   = false;
+    fRawASCIILength = 0;
     fRawInput  = (const uint8_t *) in;
     fRawLength = len == -1? (int32_t)uprv_strlen(in) : len;
+    fRawScanStatesCount = 0;
+    fInputFull = false;
+}
+
+void InputText::appendText(const char *in, int32_t len, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if ((in == NULL && len != 0) || len < -1) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    if (len == -1) {
+        len = (int32_t)uprv_strlen(in);
+    }
+
+    if (len > INT32_MAX - fRawLength) {
+        status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return;
+    }
+
+    int32_t newLength = fRawLength + len;
+
+    if (newLength > fOwnedCapacity) {
+        // Grow geometrically so that appending is linear overall.
+        int32_t capacity = fOwnedCapacity <= INT32_MAX / 2 ? 2 * fOwnedCapacity : INT32_MAX;
+
+        if (capacity < newLength) {
+            capacity = newLength;
+        }
+        if (capacity < BUFFER_SIZE) {
+            capacity = BUFFER_SIZE;
+        }
+
+        uint8_t *buffer = NEW_ARRAY(uint8_t, capacity);
+
+        if (buffer == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+
+        if (fRawLength > 0) {
+            uprv_memcpy(buffer, fRawInput, fRawLength);
+        }
+
+        DELETE_ARRAY(fOwnedInput);
+        fOwnedInput = buffer;
+        fOwnedCapacity = capacity;
+    } else if (fRawInput != fOwnedInput && fRawLength > 0) {
+        uprv_memcpy(fOwnedInput, fRawInput, fRawLength);
+    }
+
+    fRawInput = fOwnedInput;
+    if (len > 0) {
+        uprv_memcpy(fOwnedInput + fRawLength, in, len);
+    }
+    fRawLength = newLength;
 }
 
 void InputText::setDeclaredEncoding(const char* encoding, int32_t len)
@@ -73,6 +148,93 @@ UBool InputText::isSet() const
     return fRawInput != NULL;
 }
 
+const NGramStats *InputText::getNGramStats(const uint8_t *charMap) const
+{
+    for (int32_t i = 0; i < fNGramStatsCount; i += 1) {
+        if (fNGramStats[i].charMap == charMap) {
+            return &fNGramStats[i];
+        }
+    }
+
+    return NULL;
+}
+
+int32_t *InputText::getNGramScratch()
+{
+    if (fNGramScratch == NULL) {
+        // The n-grams of BUFFER_SIZE bytes plus the trailing space, twice.
+        fNGramScratch = NEW_ARRAY(int32_t, 2 * (BUFFER_SIZE + 1));
+    }
+
+    return fNGramScratch;
+}
+
+NGramStats *InputText::addNGramStats(const uint8_t *charMap, int32_t length)
+{
+    if (fNGramStatsCount >= MAX_NGRAM_STATS) {
+        return NULL;
+    }
+
+    NGramStats *stats = &fNGramStats[fNGramStatsCount];
+    stats->values = NEW_ARRAY(int32_t, 2 * (length > 0 ? length : 1));
+    if (stats->values == NULL) {
+        return NULL;
+    }
+
+    stats->charMap = charMap;
+    stats->counts  = stats->values + length;
+    stats->length  = length;
+    stats->total   = 0;
+    fNGramStatsCount += 1;
+    return stats;
+}
+
+RawScanState *InputText::getRawScanState(const void *owner)
+{
+    RawScanState *state;
+
+    for (int32_t i = 0; i < fRawScanStatesCount; i += 1) {
+        if (fRawScanStates[i].owner == owner) {
+            return &fRawScanStates[i];
+        }
+    }
+
+    if (fRawScanStatesCount < MAX_RAW_SCAN_STATES) {
+        state = &fRawScanStates[fRawScanStatesCount++];
+    } else {
+        state = &fSpareRawScanState;
+    }
+
+    uprv_memset(state, 0, sizeof(*state));
+    state->owner = owner;
+    return state;
+}
+
+/*
+ * Adds the byte values of s to stats, with four partial tables so that
+ * runs of the same byte do not wait on a single counter.
+ */
+static void tallyBytes(const uint8_t *s, int32_t length, int16_t *stats)
+{
+    uint16_t partial[4][256];
+    int32_t  i;
+
+    uprv_memset(partial, 0, sizeof(partial));
+    for (i = 0; i + 4 <= length; i += 4) {
+        partial[0][s[i]] += 1;
+        partial[1][s[i + 1]] += 1;
+        partial[2][s[i + 2]] += 1;
+        partial[3][s[i + 3]] += 1;
+    }
+    for (; i < length; i += 1) {
+        partial[0][s[i]] += 1;
+    }
+
+    for (i = 0; i < 256; i += 1) {
+        stats[i] += (int16_t)(partial[0][i] + partial[1][i] + partial[2][i] + partial[3][i]);
+    }
+}
+
 /**
 *  MungeInput - after getting a set of raw input data to be analyzed, preprocess
 *               it by removing what appears to be html markup.
@@ -87,6 +249,24 @@ void InputText::MungeInput(UBool fStripTags) {
     int32_t openTags = 0;
     int32_t badTags  = 0;
 
+    //
+    // The multi-byte and Unicode recognizers look at all of the raw input.
+    // They can skip its leading ASCII bytes.
+    // With appended text, continue where the previous call stopped.
+    //
+    fRawASCIILength += simd::spanASCII(fRawInput + fRawASCIILength, fRawLength - fRawASCIILength);
+    while (fRawASCIILength < fRawLength && fRawInput[fRawASCIILength] <= 0x7F) {
+        fRawASCIILength += 1;
+    }
+
+    //
+    // Once fInputBytes is full, appended text changes neither it
+    //   nor the statistics derived from it.
+    //
+    if (fInputFull && fInputFullStripTags == fStripTags) {
+        return;
+    }
+
     //
     //  html / xml markup stripping.
     //     quick and dirty, not 100% accurate, but hopefully good enough, statistically.
@@ -133,30 +313,36 @@ void InputText::MungeInput(UBool fStripTags) {
             limit = BUFFER_SIZE;
         }
 
-        for (srci=0; srci<limit; srci++) {
-            fInputBytes[srci] = fRawInput[srci];
-        }
-
-        fInputLen = srci;
+        uprv_memcpy(fInputBytes, fRawInput, limit);
+        fInputLen = limit;
     }
 
+    // With markup stripping, the decision to strip can change until the
+    //   stripped text fills the buffer.
+    fInputFull = fStripTags ? dsti == BUFFER_SIZE : fInputLen == BUFFER_SIZE;
+    fInputFullStripTags = fStripTags;
+
     //
     // Tally up the byte occurrence statistics.
     // These are available for use by the various detectors.
     //
 
     uprv_memset(fByteStats, 0, (sizeof fByteStats[0]) * 256);
+    tallyBytes(fInputBytes, fInputLen, fByteStats);
 
-    for (srci = 0; srci < fInputLen; srci += 1) {
-        fByteStats[fInputBytes[srci]] += 1;
-    }
-
+    fC1Bytes = false;
     for (int32_t i = 0x80; i <= 0x9F; i += 1) {
         if (fByteStats[i] != 0) {
             fC1Bytes = true;
             break;
         }
     }
+
+    // The n-gram statistics of the previous input are stale.
+    for (int32_t i = 0; i < fNGramStatsCount; i += 1) {
+        DELETE_ARRAY(fNGramStats[i].values);
+    }
+    fNGramStatsCount = 0;
 }
 
 U_NAMESPACE_END
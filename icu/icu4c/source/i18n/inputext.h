@@ -25,6 +25,30 @@
 
 U_NAMESPACE_BEGIN 
 
+/**
+ * The 3-grams of the input text as seen through one charMap of the single-byte
+ * recognizers, computed once and shared by all of the languages and recognizers
+ * that use that charMap.
+ */
+struct NGramStats {
+    const uint8_t *charMap;
+    int32_t       *values;      // the distinct n-grams in ascending order
+    int32_t       *counts;      // how often each of them occurs
+    int32_t        length;      // number of distinct n-grams
+    int32_t        total;       // number of n-grams including repeats
+};
+
+/**
+ * How far one recognizer has scanned the raw input and what it counted there,
+ * so that it continues from there when more text is appended.
+ */
+struct RawScanState {
+    const void *owner;          // the recognizer
+    int32_t     index;          // raw input index where the scan continues
+    int32_t     counts[4];      // the recognizer's counters for the bytes before index
+    UBool       done;           // true if more text cannot change the result
+};
+
 class InputText : public UMemory
 {
     // Prevent copying
@@ -34,10 +58,27 @@ class InputText : public UMemory
     ~InputText();
 
     void setText(const char *in, int32_t len);
+    // Appends len bytes to the raw input, after copying the text so far
+    //   into a buffer owned by this object if it is not there yet.
+    void appendText(const char *in, int32_t len, UErrorCode &status);
     void setDeclaredEncoding(const char *encoding, int32_t len);
     UBool isSet() const; 
     void MungeInput(UBool fStripTags);
 
+    // Returns the n-gram statistics for charMap if they have been computed
+    //   for the current input, or else NULL.
+    const NGramStats *getNGramStats(const uint8_t *charMap) const;
+    // Returns a buffer for computing n-gram statistics, with room for twice
+    //   as many n-grams as fInputBytes can yield, or NULL if memory allocation fails.
+    int32_t *getNGramScratch();
+    // Returns a new NGramStats for charMap with room for length n-grams and counts,
+    //   or NULL if there are too many charMaps or memory allocation fails.
+    NGramStats *addNGramStats(const uint8_t *charMap, int32_t length);
+    // Returns the scan state of owner for the current raw input, with all counts 0
+    //   the first time. Never NULL: if there are too many owners, the state
+    //   is not kept and owner scans from the start every time.
+    RawScanState *getRawScanState(const void *owner);
+
     // The text to be checked.  Markup will have been
     //   removed if appropriate.
     uint8_t    *fInputBytes;
@@ -47,6 +88,7 @@ class InputText : public UMemory
     //   Value is rounded up, so zero really means zero occurrences. 
     int16_t  *fByteStats;
     UBool     fC1Bytes;          // True if any bytes in the range 0x80 - 0x9F are in the input;false by default
+    int32_t   fRawASCIILength;   // Number of leading ASCII bytes (<= 0x7F) in fRawInput.
     char     *fDeclaredEncoding;
 
     const uint8_t           *fRawInput;     // Original, untouched input bytes.
@@ -55,6 +97,23 @@ class InputText : public UMemory
     //   buffer here.
     int32_t                  fRawLength;    // Length of data in fRawInput array.
 
+private:
+    // One entry per charMap used so far on the current input, see getNGramStats().
+    enum { MAX_NGRAM_STATS = 16 };
+    NGramStats  fNGramStats[MAX_NGRAM_STATS];
+    int32_t     fNGramStatsCount;
+    int32_t    *fNGramScratch;
+
+    // One entry per recognizer that scanned the current raw input, see getRawScanState().
+    enum { MAX_RAW_SCAN_STATES = 16 };
+    RawScanState fRawScanStates[MAX_RAW_SCAN_STATES];
+    RawScanState fSpareRawScanState;
+    int32_t      fRawScanStatesCount;
+
+    uint8_t    *fOwnedInput;        // Buffer for appended text.
+    int32_t     fOwnedCapacity;
+    UBool       fInputFull;         // fInputBytes is full and will not change with appended text.
+    UBool       fInputFullStripTags;    // The fStripTags value with which fInputBytes was filled.
 };
 
 U_NAMESPACE_END
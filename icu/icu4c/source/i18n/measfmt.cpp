@@ -123,6 +123,7 @@ class MeasureFormatCacheData : public SharedObject {
 
     MeasureFormatCacheData();
     virtual ~MeasureFormatCacheData();
+    virtual int32_t getMemoryUsage() const override;
 
     void adoptCurrencyFormat(int32_t widthIndex, NumberFormat *nfToAdopt) {
         delete currencyFormats[widthIndex];
@@ -172,6 +173,18 @@ MeasureFormatCacheData::~MeasureFormatCacheData() {
     delete numericDateFormatters;
 }
 
+int32_t MeasureFormatCacheData::getMemoryUsage() const {
+    int32_t size = (int32_t)sizeof(*this);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(currencyFormats); ++i) {
+        size += SharedNumberFormat::getMemoryUsage(currencyFormats[i]);
+    }
+    size += SharedNumberFormat::getMemoryUsage(integerFormat);
+    if (numericDateFormatters != nullptr) {
+        size += (int32_t)sizeof(NumericDateFormatters);
+    }
+    return size;
+}
+
 static UBool isCurrency(const MeasureUnit &unit) {
     return (uprv_strcmp(unit.getType(), "currency") == 0);
 }
@@ -239,6 +252,11 @@ static NumericDateFormatters *loadNumericDateFormatters(
     return result;
 }
 
+template<>
+const char *CacheKey<MeasureFormatCacheData>::typeName() const {
+    return "MeasureFormatCacheData";
+}
+
 template<> 
 const MeasureFormatCacheData *LocaleCacheKey<MeasureFormatCacheData>::createObject(
         const void * /*unused*/, UErrorCode &status) const {
@@ -55,6 +55,7 @@
 #include "sharednumberformat.h"
 #include "unifiedcache.h"
 #include "number_decimalquantity.h"
+#include "number_mapper.h"
 #include "number_utils.h"
 
 //#define FMT_DEBUG
@@ -251,6 +252,28 @@ SharedNumberFormat::~SharedNumberFormat() {
     delete ptr;
 }
 
+int32_t
+SharedNumberFormat::getMemoryUsage() const {
+    return (int32_t)sizeof(*this) + getMemoryUsage(ptr);
+}
+
+int32_t
+SharedNumberFormat::getMemoryUsage(const NumberFormat *nf) {
+    if (nf == nullptr) {
+        return 0;
+    }
+    const DecimalFormat *df = dynamic_cast<const DecimalFormat *>(nf);
+    if (df == nullptr) {
+        // Other formats, such as those for algorithmic numbering systems,
+        // count only their base object.
+        return (int32_t)sizeof(NumberFormat);
+    }
+    // A DecimalFormat owns its fields: the pattern properties, twice,
+    // the number formatter settings, and a copy of the symbols.
+    return (int32_t)(sizeof(DecimalFormat) + sizeof(number::impl::DecimalFormatFields) +
+                     sizeof(DecimalFormatSymbols));
+}
+
 // -------------------------------------
 // copy constructor
 
@@ -1254,6 +1277,11 @@ static void U_CALLCONV nscacheInit() {
     uhash_setValueDeleter(NumberingSystem_cache, deleteNumberingSystem);
 }
 
+template<> U_I18N_API
+const char *CacheKey<SharedNumberFormat>::typeName() const {
+    return "SharedNumberFormat";
+}
+
 template<> U_I18N_API
 const SharedNumberFormat *LocaleCacheKey<SharedNumberFormat>::createObject(
         const void * /*unused*/, UErrorCode &status) const {
@@ -98,6 +98,33 @@ SharedPluralRules::~SharedPluralRules() {
     delete ptr;
 }
 
+int32_t
+SharedPluralRules::getMemoryUsage() const {
+    int32_t size = (int32_t)sizeof(*this);
+    if (ptr == nullptr) {
+        return size;
+    }
+    size += (int32_t)sizeof(PluralRules);
+    for (const RuleChain *rule = ptr->mRules; rule != nullptr; rule = rule->fNext) {
+        size += (int32_t)sizeof(RuleChain) +
+                (rule->fKeyword.length() + rule->fDecimalSamples.length() +
+                    rule->fIntegerSamples.length()) * U_SIZEOF_UCHAR;
+        for (const OrConstraint *orC = rule->ruleHeader; orC != nullptr; orC = orC->next) {
+            size += (int32_t)sizeof(OrConstraint);
+            for (const AndConstraint *andC = orC->childNode; andC != nullptr; andC = andC->next) {
+                size += (int32_t)sizeof(AndConstraint);
+                if (andC->rangeList != nullptr) {
+                    size += (int32_t)sizeof(UVector32) + andC->rangeList->size() * 4;
+                }
+            }
+        }
+    }
+    if (ptr->mStandardPluralRanges != nullptr) {
+        size += (int32_t)sizeof(StandardPluralRanges);
+    }
+    return size;
+}
+
 PluralRules*
 PluralRules::clone() const {
     // Since clone doesn't have a 'status' parameter, the best we can do is return nullptr if
@@ -185,6 +212,11 @@ PluralRules::createDefaultRules(UErrorCode& status) {
 /******************************************************************************/
 /* Create PluralRules cache */
 
+template<> U_I18N_API
+const char *CacheKey<SharedPluralRules>::typeName() const {
+    return "SharedPluralRules";
+}
+
 template<> U_I18N_API
 const SharedPluralRules *LocaleCacheKey<SharedPluralRules>::createObject(
         const void * /*unused*/, UErrorCode &status) const {
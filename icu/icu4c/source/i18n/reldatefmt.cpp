@@ -73,6 +73,7 @@ class RelativeDateTimeCacheData: public SharedObject {
         }
     }
     virtual ~RelativeDateTimeCacheData();
+    virtual int32_t getMemoryUsage() const override;
 
     // no numbers: e.g Next Tuesday; Yesterday; etc.
     UnicodeString absoluteUnits[UDAT_STYLE_COUNT][UDAT_ABSOLUTE_UNIT_COUNT][UDAT_DIRECTION_COUNT];
@@ -128,6 +129,27 @@ RelativeDateTimeCacheData::~RelativeDateTimeCacheData() {
     delete combinedDateAndTime;
 }
 
+int32_t RelativeDateTimeCacheData::getMemoryUsage() const {
+    // The absolute unit strings are mostly short enough
+    // to fit into their UnicodeString objects.
+    int32_t size = (int32_t)sizeof(*this);
+    for (int32_t style = 0; style < UDAT_STYLE_COUNT; ++style) {
+        for (int32_t relUnit = 0; relUnit < UDAT_REL_UNIT_COUNT; ++relUnit) {
+            for (int32_t pl = 0; pl < StandardPlural::COUNT; ++pl) {
+                for (int32_t pastFutureIndex = 0; pastFutureIndex < 2; ++pastFutureIndex) {
+                    if (relativeUnitsFormatters[style][relUnit][pastFutureIndex][pl] != nullptr) {
+                        size += (int32_t)sizeof(SimpleFormatter);
+                    }
+                }
+            }
+        }
+    }
+    if (combinedDateAndTime != nullptr) {
+        size += (int32_t)sizeof(SimpleFormatter);
+    }
+    return size;
+}
+
 
 // Use fallback cache for absolute units.
 const UnicodeString& RelativeDateTimeCacheData::getAbsoluteUnitString(
@@ -701,6 +723,11 @@ static UBool getDateTimePattern(
     return getStringByIndex(topLevel.getAlias(), dateTimeFormatOffset, result, status);
 }
 
+template<>
+const char *CacheKey<RelativeDateTimeCacheData>::typeName() const {
+    return "RelativeDateTimeCacheData";
+}
+
 template<> 
 const RelativeDateTimeCacheData *LocaleCacheKey<RelativeDateTimeCacheData>::createObject(const void * /*unused*/, UErrorCode &status) const {
     const char *localeId = fLoc.getName();
@@ -12,6 +12,7 @@
 */
 #include "sharedbreakiterator.h"
 #include "unicode/brkiter.h"
+#include "unicode/rbbi.h"
 
 #if !UCONFIG_NO_BREAK_ITERATION
 
@@ -24,6 +25,16 @@ SharedBreakIterator::~SharedBreakIterator() {
   delete ptr;
 }
 
+int32_t SharedBreakIterator::getMemoryUsage() const {
+  // The break iterator itself. Its rules data is shared by all
+  // break iterators of the same type, and usually memory-mapped.
+  int32_t size = (int32_t)sizeof(*this);
+  if (ptr != nullptr) {
+    size += (int32_t)sizeof(RuleBasedBreakIterator);
+  }
+  return size;
+}
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
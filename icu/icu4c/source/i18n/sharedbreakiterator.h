@@ -32,6 +32,7 @@ class U_I18N_API SharedBreakIterator : public SharedObject {
 public:
     SharedBreakIterator(BreakIterator *biToAdopt);
     virtual ~SharedBreakIterator();
+    virtual int32_t getMemoryUsage() const override;
 
     BreakIterator *get() const { return ptr; }
     BreakIterator *operator->() const { return ptr; }
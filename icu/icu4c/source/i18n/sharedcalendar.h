@@ -23,6 +23,7 @@ class U_I18N_API SharedCalendar : public SharedObject {
 public:
     SharedCalendar(Calendar *calToAdopt) : ptr(calToAdopt) { }
     virtual ~SharedCalendar();
+    virtual int32_t getMemoryUsage() const override;
     const Calendar *get() const { return ptr; }
     const Calendar *operator->() const { return ptr; }
     const Calendar &operator*() const { return *ptr; }
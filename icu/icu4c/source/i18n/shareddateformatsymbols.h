@@ -28,6 +28,7 @@ class U_I18N_API SharedDateFormatSymbols : public SharedObject {
             const Locale &loc, const char *type, UErrorCode &status)
             : dfs(loc, type, status) { }
     virtual ~SharedDateFormatSymbols();
+    virtual int32_t getMemoryUsage() const override;
     const DateFormatSymbols &get() const { return dfs; }
 private:
     DateFormatSymbols dfs;
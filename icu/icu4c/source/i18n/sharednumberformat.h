@@ -23,6 +23,12 @@ class U_I18N_API SharedNumberFormat : public SharedObject {
 public:
     SharedNumberFormat(NumberFormat *nfToAdopt) : ptr(nfToAdopt) { }
     virtual ~SharedNumberFormat();
+    virtual int32_t getMemoryUsage() const override;
+    /**
+     * Returns a rough estimate of the memory that a NumberFormat uses,
+     * for getMemoryUsage() of cached objects that own NumberFormats.
+     */
+    static int32_t getMemoryUsage(const NumberFormat *nf);
     const NumberFormat *get() const { return ptr; }
     const NumberFormat *operator->() const { return ptr; }
     const NumberFormat &operator*() const { return *ptr; }
@@ -23,6 +23,7 @@ class U_I18N_API SharedPluralRules : public SharedObject {
 public:
     SharedPluralRules(PluralRules *prToAdopt) : ptr(prToAdopt) { }
     virtual ~SharedPluralRules();
+    virtual int32_t getMemoryUsage() const override;
     const PluralRules *operator->() const { return ptr; }
     const PluralRules &operator*() const { return *ptr; }
 private:
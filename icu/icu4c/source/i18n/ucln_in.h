@@ -62,6 +62,7 @@ typedef enum ECleanupI18NType {
     UCLN_I18N_REGION,
     UCLN_I18N_LIST_FORMATTER,
     UCLN_I18N_NUMSYS,
+    UCLN_I18N_INIT_CATEGORIES,
     UCLN_I18N_COUNT /* This must be last */
 } ECleanupI18NType;
 
@@ -134,6 +134,11 @@ CollationLoader::loadRules(const char *localeID, const char *collationType,
     }
 }
 
+template<> U_I18N_API
+const char *CacheKey<CollationCacheEntry>::typeName() const {
+    return "CollationCacheEntry";
+}
+
 template<> U_I18N_API
 const CollationCacheEntry *
 LocaleCacheKey<CollationCacheEntry>::createObject(const void *creationContext,
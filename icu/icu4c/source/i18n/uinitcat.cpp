@@ -0,0 +1,230 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  uinitcat.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Eager initialization of ICU singletons, by category.
+*   Lives in the i18n library because some categories
+*   (collation, time zones) are implemented here.
+*/
+
+#include <chrono>
+
+#include "unicode/utypes.h"
+#include "unicode/brkiter.h"
+#include "unicode/locid.h"
+#include "unicode/normalizer2.h"
+#include "unicode/timezone.h"
+#include "unicode/uinitcat.h"
+#include "unicode/uloc.h"
+#include "cmemory.h"
+#include "collationroot.h"
+#include "loclikelysubtags.h"
+#include "ucln_in.h"
+#include "uinitcatpool.h"
+#include "umutex.h"
+#include "utracimp.h"
+#include "zonemeta.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+UInitOnce gCategoryInitOnce[U_INIT_CATEGORY_COUNT] {};
+
+// Incremented by calls that want to initialize a category;
+// the one that increments it to 1 initializes it without waiting.
+u_atomic_int32_t gCategoryClaims[U_INIT_CATEGORY_COUNT] {};
+
+// Written before gCategoryInitDone is set, read only after it is set.
+int64_t gCategoryInitNanos[U_INIT_CATEGORY_COUNT] = {};
+
+// Set to 1 with release semantics when a category has been initialized.
+u_atomic_int32_t gCategoryInitDone[U_INIT_CATEGORY_COUNT] {};
+
+const char *const gCategoryNames[U_INIT_CATEGORY_COUNT] = {
+    "normalization",
+    "break-iteration",
+    "likely-subtags",
+    "collation",
+    "time-zones"
+};
+
+}  // namespace
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV uinitcat_cleanup() {
+    for (int32_t i = 0; i < U_INIT_CATEGORY_COUNT; ++i) {
+        gCategoryInitOnce[i].reset();
+        gCategoryClaims[i] = 0;
+        gCategoryInitNanos[i] = 0;
+        gCategoryInitDone[i] = 0;
+    }
+    return true;
+}
+U_CDECL_END
+
+namespace {
+
+void initNormalization(UErrorCode &errorCode) {
+#if !UCONFIG_NO_NORMALIZATION
+    // NFD and NFKD share the data of NFC and NFKC.
+    Normalizer2::getNFCInstance(errorCode);
+    Normalizer2::getNFKCInstance(errorCode);
+    Normalizer2::getNFKCCasefoldInstance(errorCode);
+#else
+    (void)errorCode;
+#endif
+}
+
+void initBreakIteration(UErrorCode &errorCode) {
+#if !UCONFIG_NO_BREAK_ITERATION
+    // Break iterators are not cached, but creating one of each type
+    // loads and caches the rules data and the resource bundles that select it.
+    const Locale &locale = Locale::getDefault();
+    delete BreakIterator::createCharacterInstance(locale, errorCode);
+    delete BreakIterator::createWordInstance(locale, errorCode);
+    delete BreakIterator::createLineInstance(locale, errorCode);
+    delete BreakIterator::createSentenceInstance(locale, errorCode);
+#else
+    (void)errorCode;
+#endif
+}
+
+void initLikelySubtags(UErrorCode &errorCode) {
+    XLikelySubtags::getSingleton(errorCode);
+    // uloc_addLikelySubtags() reads the likelySubtags resource bundle instead.
+    char maximized[ULOC_FULLNAME_CAPACITY];
+    uloc_addLikelySubtags("und", maximized, UPRV_LENGTHOF(maximized), &errorCode);
+}
+
+void initCollation(UErrorCode &errorCode) {
+#if !UCONFIG_NO_COLLATION
+    CollationRoot::getRoot(errorCode);
+#else
+    (void)errorCode;
+#endif
+}
+
+void initTimeZones(UErrorCode &errorCode) {
+#if !UCONFIG_NO_FORMATTING
+    LocalPointer<TimeZone> zone(TimeZone::createDefault());
+    if (zone.isNull()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    UnicodeString id;
+    zone->getID(id);
+    // Custom zones like "GMT+05:00" have no canonical ID, which is not an error here:
+    // The lookup still loads the canonical ID data.
+    UErrorCode localErrorCode = U_ZERO_ERROR;
+    ZoneMeta::getCanonicalCLDRID(id, localErrorCode);
+    ZoneMeta::getMetazoneMappings(id);
+    UnicodeString country;
+    ZoneMeta::getCanonicalCountry(id, country);
+    if (ZoneMeta::getAvailableMetazoneIDs() == nullptr) {
+        errorCode = U_MISSING_RESOURCE_ERROR;
+    }
+#else
+    (void)errorCode;
+#endif
+}
+
+void U_CALLCONV initCategory(UInitCategory category, UErrorCode &errorCode) {
+    ucln_i18n_registerCleanup(UCLN_I18N_INIT_CATEGORIES, uinitcat_cleanup);
+    UTRACE_ENTRY_OC(UTRACE_U_INIT_CATEGORY);
+    UTRACE_DATA1(UTRACE_OPEN_CLOSE, "%s", gCategoryNames[category]);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    switch (category) {
+    case U_INIT_NORMALIZATION:
+        initNormalization(errorCode);
+        break;
+    case U_INIT_BREAK_ITERATION:
+        initBreakIteration(errorCode);
+        break;
+    case U_INIT_LIKELY_SUBTAGS:
+        initLikelySubtags(errorCode);
+        break;
+    case U_INIT_COLLATION:
+        initCollation(errorCode);
+        break;
+    case U_INIT_TIME_ZONES:
+        initTimeZones(errorCode);
+        break;
+    default:
+        break;
+    }
+    gCategoryInitNanos[category] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    umtx_storeRelease(gCategoryInitDone[category], 1);
+    UTRACE_EXIT_STATUS(errorCode);
+}
+
+/**
+ * Initializes the category, or waits for another thread to finish initializing it.
+ * Keeps the first error in status but continues with the other categories,
+ * so that one missing category does not keep the others from loading.
+ */
+void initCategoryOnce(int32_t category, UErrorCode &status) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    umtx_initOnce(gCategoryInitOnce[category], &initCategory, (UInitCategory)category, errorCode);
+    if (U_FAILURE(errorCode) && U_SUCCESS(status)) {
+        status = errorCode;
+    }
+}
+
+/**
+ * Initializes a category claimed by this call, on any thread.
+ * The UInitOnce keeps the error for the waiting loop in u_initCategories().
+ */
+void U_CALLCONV initClaimedCategory(int32_t category) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    initCategoryOnce(category, errorCode);
+}
+
+}  // namespace
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI void U_EXPORT2
+u_initCategories(uint32_t categoryMask, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    // First initialize the categories that no other call has claimed yet,
+    // so that concurrent calls work on different categories.
+    // This thread takes one of them, and other threads take the rest.
+    int32_t claimed[U_INIT_CATEGORY_COUNT];
+    int32_t claimedCount = 0;
+    for (int32_t i = 0; i < U_INIT_CATEGORY_COUNT; ++i) {
+        if ((categoryMask & U_INIT_MASK(i)) != 0 &&
+                umtx_loadAcquire(gCategoryClaims[i]) == 0 &&
+                umtx_atomic_inc(&gCategoryClaims[i]) == 1) {
+            claimed[claimedCount++] = i;
+        }
+    }
+    uinitcat_runTasks(&initClaimedCategory, claimed, claimedCount);
+    // Then wait for the categories that other calls are initializing,
+    // and collect the errors of all of them.
+    for (int32_t i = 0; i < U_INIT_CATEGORY_COUNT; ++i) {
+        if ((categoryMask & U_INIT_MASK(i)) != 0) {
+            initCategoryOnce(i, *status);
+        }
+    }
+}
+
+U_CAPI int64_t U_EXPORT2
+u_getCategoryInitTime(UInitCategory category) {
+    if (category < 0 || category >= U_INIT_CATEGORY_COUNT ||
+            umtx_loadAcquire(gCategoryInitDone[category]) == 0) {
+        return -1;
+    }
+    return gCategoryInitNanos[category];
+}
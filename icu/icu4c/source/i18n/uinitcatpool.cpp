@@ -0,0 +1,71 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  uinitcatpool.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   A small thread pool for u_initCategories().
+*   In a separate file so that the rest of the initialization code
+*   does not start threads.
+*/
+
+#include <thread>
+
+#include "unicode/utypes.h"
+#include "uinitcatpool.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// There are only a few categories, and each one loads data that
+// mostly waits for the disk or page faults.
+constexpr int32_t MAX_THREAD_COUNT = 4;
+
+/**
+ * Starts a thread that calls task(category).
+ * @return false if the thread could not be created
+ */
+bool startThread(std::thread &thread, UInitCategoryTask *task, int32_t category) {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    // ICU APIs do not throw: Report the failure instead of
+    // the std::system_error. Without exceptions, it is fatal.
+    try {
+        thread = std::thread(task, category);
+    } catch (...) {
+        return false;
+    }
+#else
+    thread = std::thread(task, category);
+#endif
+    return true;
+}
+
+}  // namespace
+
+void uinitcat_runTasks(UInitCategoryTask *task, const int32_t categories[], int32_t count) {
+    if (count <= 0) {
+        return;
+    }
+    std::thread threads[MAX_THREAD_COUNT];
+    int32_t threadCount = 0;
+    int32_t next = 1;
+    while (next < count && threadCount < MAX_THREAD_COUNT &&
+            startThread(threads[threadCount], task, categories[next])) {
+        ++threadCount;
+        ++next;
+    }
+    task(categories[0]);
+    for (; next < count; ++next) {
+        task(categories[next]);
+    }
+    for (int32_t i = 0; i < threadCount; ++i) {
+        threads[i].join();
+    }
+}
+
+U_NAMESPACE_END
@@ -0,0 +1,34 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  uinitcatpool.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Runs the category initializations of u_initCategories() on several threads.
+*/
+
+#ifndef __UINITCATPOOL_H__
+#define __UINITCATPOOL_H__
+
+#include "unicode/utypes.h"
+
+U_NAMESPACE_BEGIN
+
+typedef void U_CALLCONV UInitCategoryTask(int32_t category);
+
+/**
+ * Calls task(categories[i]) for each of the count categories, and returns when
+ * all of them are done. The calling thread runs the first one,
+ * and a new thread runs each of the others, up to a small number of threads.
+ * The calling thread also runs the ones left over, including any for which
+ * a thread could not be started.
+ */
+void uinitcat_runTasks(UInitCategoryTask *task, const int32_t categories[], int32_t count);
+
+U_NAMESPACE_END
+
+#endif  // __UINITCATPOOL_H__
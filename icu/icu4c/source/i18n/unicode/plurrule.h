@@ -579,6 +579,7 @@ class U_I18N_API PluralRules : public UObject {
     UErrorCode mInternalStatus;
 
     friend class PluralRuleParser;
+    friend class SharedPluralRules;
 };
 
 U_NAMESPACE_END
@@ -130,6 +130,37 @@ U_NAMESPACE_END
 U_CAPI void U_EXPORT2
 ucsdet_setText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+  * Append more input byte data to the text whose charset is to be detected,
+  * for detecting the charset of a stream of bytes as it arrives, for example
+  * from a network connection.
+  *
+  * Unlike ucsdet_setText(), this function copies the bytes,
+  * so the caller may reuse its buffer for the next chunk.
+  * If the current text was set with ucsdet_setText(), it is copied as well
+  * and then continued. To start a new stream, call ucsdet_setText() with
+  * an empty text.
+  *
+  * ucsdet_detect() and ucsdet_detectAll() may be called after each chunk.
+  * They report the same matches as for all of the text so far passed
+  * to ucsdet_setText() at once, but the recognizers continue where they
+  * stopped, so that the cost of each call grows with the length of the new
+  * chunk rather than with the length of the whole text.
+  * The caller can stop reading once the best match is good enough.
+  * Appending text invalidates the UCharsetMatch objects returned so far.
+  *
+  * @param ucsd   the charset detector to be used.
+  * @param textIn the next chunk of input text of unknown encoding.
+  * @param len    the length of the chunk, or -1 if it is NUL terminated.
+  * @param status any error conditions are reported back in this variable.
+  *
+  * @draft ICU 73
+  */
+U_CAPI void U_EXPORT2
+ucsdet_appendText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
+#endif  // U_HIDE_DRAFT_API
+
 
 /** Set the declared encoding for charset detection.
  *  The declared encoding of an input text is an encoding obtained
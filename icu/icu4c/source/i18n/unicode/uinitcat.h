@@ -0,0 +1,137 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+*
+*   file name:  uinitcat.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+******************************************************************************
+*/
+
+#ifndef __UINITCAT_H__
+#define __UINITCAT_H__
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C API: Eager initialization of ICU singletons
+ *
+ * ICU loads shared data such as normalization data, break iteration rules,
+ * likely subtags, the root collator and time zone metadata lazily, on first
+ * use. For a server, that cost shows up as latency on the first requests.
+ * These functions initialize selected categories of such data ahead of time
+ * and report how long each category took.
+ *
+ * u_initCategories() initializes the selected categories concurrently:
+ * The calling thread initializes one of them, and a few short-lived threads
+ * initialize the others. If a thread cannot be started, the calling thread
+ * initializes the remaining categories itself.
+ *
+ * Concurrent calls share the work. Each call claims the categories that no
+ * other call has started yet, initializes them, and then waits for the ones
+ * started by other calls, so each category is initialized only once.
+ *
+ * Initialization is safe while other threads use the same services;
+ * they wait for, or share, the same singletons.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Categories of ICU singletons that u_initCategories() can initialize.
+ * @draft ICU 73
+ */
+typedef enum UInitCategory {
+    /**
+     * The NFC, NFKC and NFKC_Casefold normalization data.
+     * @draft ICU 73
+     */
+    U_INIT_NORMALIZATION,
+    /**
+     * The character, word, line and sentence break rules
+     * for the default locale.
+     * @draft ICU 73
+     */
+    U_INIT_BREAK_ITERATION,
+    /**
+     * The likely subtags data used for locale matching and
+     * uloc_addLikelySubtags().
+     * @draft ICU 73
+     */
+    U_INIT_LIKELY_SUBTAGS,
+    /**
+     * The root collator, on which all tailorings are based.
+     * @draft ICU 73
+     */
+    U_INIT_COLLATION,
+    /**
+     * The default time zone, and the time zone metadata:
+     * canonical IDs, metazones and their mappings, and zone countries.
+     * @draft ICU 73
+     */
+    U_INIT_TIME_ZONES,
+#ifndef U_HIDE_DEPRECATED_API
+    /**
+     * One more than the highest normal UInitCategory value.
+     * @deprecated ICU 58 The numeric value may change over time, see ICU ticket #12420.
+     */
+    U_INIT_CATEGORY_COUNT
+#endif  // U_HIDE_DEPRECATED_API
+} UInitCategory;
+
+/**
+ * Returns the bit for a UInitCategory in a category mask
+ * for u_initCategories().
+ * @draft ICU 73
+ */
+#define U_INIT_MASK(category) ((uint32_t)1 << (category))
+
+/**
+ * Category mask for u_initCategories() with all categories.
+ * @draft ICU 73
+ */
+#define U_INIT_ALL_CATEGORIES ((uint32_t)0xffffffff)
+
+/**
+ * Initializes the ICU singletons of the selected categories.
+ * When this function returns successfully, the selected data is loaded,
+ * whether by this call or by concurrent ones.
+ *
+ * Categories of services that are disabled with UCONFIG_NO_... switches
+ * are ignored, and so are mask bits of unknown categories.
+ * The data stays loaded until u_cleanup().
+ *
+ * @param categoryMask a bit set of categories, built with U_INIT_MASK(),
+ *                     or U_INIT_ALL_CATEGORIES.
+ * @param status       ICU error code. Set to the first error of a selected
+ *                     category, for example U_MISSING_RESOURCE_ERROR
+ *                     if its data is not available.
+ * @draft ICU 73
+ */
+U_CAPI void U_EXPORT2
+u_initCategories(uint32_t categoryMask, UErrorCode *status);
+
+/**
+ * Returns how long the initialization of a category took
+ * in u_initCategories(), measured with a monotonic clock.
+ *
+ * The time covers the loading that was still needed when the category was
+ * initialized; singletons that other ICU functions had loaded before
+ * do not count.
+ *
+ * @param category the category.
+ * @return the initialization time in nanoseconds, or -1 if u_initCategories()
+ *         has not (yet) completed the initialization of this category since
+ *         ICU was last cleaned up.
+ * @draft ICU 73
+ */
+U_CAPI int64_t U_EXPORT2
+u_getCategoryInitTime(UInitCategory category);
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // __UINITCAT_H__
@@ -23,6 +23,7 @@
 #include "unicode/uloc.h"
 #include "unicode/ucnv.h"
 #include "unicode/ucnv_err.h"
+#include "unicode/ucnvpool.h"
 #include "unicode/putil.h"
 #include "unicode/uset.h"
 #include "unicode/ustring.h"
@@ -73,6 +74,8 @@ static void TestConvertSafeCloneCallback(void);
 
 static void TestEBCDICSwapLFNL(void);
 static void TestConvertEx(void);
+static void TestConvertExMBCSUTF8(void);
+static void TestConvertExMBCSUTF8Errors(void);
 static void TestConvertExFromUTF8(void);
 static void TestConvertExFromUTF8_C5F0(void);
 static void TestConvertAlgorithmic(void);
@@ -86,6 +89,9 @@ static void TestSubstString(void);
 static void InvalidArguments(void);
 static void TestGetName(void);
 static void TestUTFBOM(void);
+static void TestConverterPool(void);
+static void TestConvertBatch(void);
+static void TestConvertParallel(void);
 
 void addTestConvert(TestNode** root);
 
@@ -109,6 +115,8 @@ void addTestConvert(TestNode** root)
 #endif
     addTest(root, &TestEBCDICSwapLFNL,          "tsconv/ccapitst/TestEBCDICSwapLFNL");
     addTest(root, &TestConvertEx,               "tsconv/ccapitst/TestConvertEx");
+    addTest(root, &TestConvertExMBCSUTF8,       "tsconv/ccapitst/TestConvertExMBCSUTF8");
+    addTest(root, &TestConvertExMBCSUTF8Errors, "tsconv/ccapitst/TestConvertExMBCSUTF8Errors");
     addTest(root, &TestConvertExFromUTF8,       "tsconv/ccapitst/TestConvertExFromUTF8");
     addTest(root, &TestConvertExFromUTF8_C5F0,  "tsconv/ccapitst/TestConvertExFromUTF8_C5F0");
     addTest(root, &TestConvertAlgorithmic,      "tsconv/ccapitst/TestConvertAlgorithmic");
@@ -124,6 +132,9 @@ void addTestConvert(TestNode** root)
     addTest(root, &InvalidArguments,            "tsconv/ccapitst/InvalidArguments");
     addTest(root, &TestGetName,                 "tsconv/ccapitst/TestGetName");
     addTest(root, &TestUTFBOM,                  "tsconv/ccapitst/TestUTFBOM");
+    addTest(root, &TestConverterPool,           "tsconv/ccapitst/TestConverterPool");
+    addTest(root, &TestConvertBatch,            "tsconv/ccapitst/TestConvertBatch");
+    addTest(root, &TestConvertParallel,         "tsconv/ccapitst/TestConvertParallel");
 }
 
 static void ListNames(void) {
@@ -2536,6 +2547,237 @@ static void TestConvertEx() {
 #endif
 }
 
+/*
+ * Test the direct conversion between UTF-8 and MBCS charsets
+ * that are not "UTF-8-friendly":
+ * ASCII runs, multi-byte and extension mappings, and SI/SO.
+ */
+static void TestConvertExMBCSUTF8() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const uint8_t
+    utf8GB18030[]={
+        /* "a..z0..9" 4e00 00e9 3042 "A" 0080 1f600 "z" */
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+        0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+        0x79, 0x7a, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xe4, 0xb8, 0x80, 0xc3, 0xa9, 0xe3, 0x81, 0x82, 0x41, 0xc2, 0x80, 0xf0,
+        0x9f, 0x98, 0x80, 0x7a
+    },
+    gb18030[]={
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+        0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+        0x79, 0x7a, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xd2, 0xbb, 0xa8, 0xa6, 0xa4, 0xa2, 0x41, 0x81, 0x30, 0x81, 0x30, 0x94,
+        0x39, 0xfc, 0x36, 0x7a
+    },
+    utf8EUCJP[]={
+        /* "a..z0..9" 4e00 3042 ff61 4e02 "z" */
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+        0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+        0x79, 0x7a, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xe4, 0xb8, 0x80, 0xe3, 0x81, 0x82, 0xef, 0xbd, 0xa1, 0xe4, 0xb8, 0x82,
+        0x7a
+    },
+    eucJP[]={
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+        0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+        0x79, 0x7a, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xb0, 0xec, 0xa4, 0xa2, 0x8e, 0xa1, 0x8f, 0xb0, 0xa1, 0x7a
+    },
+    utf8IBM930[]={
+        /* "A..Z0..9" 4e00 3042 "A" 4e00 */
+        0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+        0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+        0x59, 0x5a, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xe4, 0xb8, 0x80, 0xe3, 0x81, 0x82, 0x41, 0xe4, 0xb8, 0x80
+    },
+    ibm930[]={
+        /* ends with SI after the last double-byte character */
+        0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xd1, 0xd2, 0xd3,
+        0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+        0xe8, 0xe9, 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+        0x0e, 0x45, 0x41, 0x44, 0x81, 0x0f, 0xc1, 0x0e, 0x45, 0x41, 0x0f
+    };
+
+    static const struct {
+        const char *name;
+        const uint8_t *utf8, *bytes;
+        int32_t utf8Length, length;
+    } cases[]={
+        { "gb18030", utf8GB18030, gb18030, sizeof(utf8GB18030), sizeof(gb18030) },
+        { "EUC-JP", utf8EUCJP, eucJP, sizeof(utf8EUCJP), sizeof(eucJP) },
+        { "ibm-930", utf8IBM930, ibm930, sizeof(utf8IBM930), sizeof(ibm930) }
+    };
+
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+    char testName[40];
+    int32_t i;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("unable to open a UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(cases); ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(cases[i].name, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open a %s converter - %s\n", cases[i].name, u_errorName(errorCode));
+            continue;
+        }
+
+        strcpy(testName, "UTF-8 -> ");
+        strcat(testName, cases[i].name);
+        convertExMultiStreaming(utf8Cnv, cnv,
+            (const char *)cases[i].utf8, cases[i].utf8Length,
+            (const char *)cases[i].bytes, cases[i].length,
+            testName, U_ZERO_ERROR);
+
+        strcpy(testName, cases[i].name);
+        strcat(testName, " -> UTF-8");
+        convertExMultiStreaming(cnv, utf8Cnv,
+            (const char *)cases[i].bytes, cases[i].length,
+            (const char *)cases[i].utf8, cases[i].utf8Length,
+            testName, U_ZERO_ERROR);
+
+        ucnv_close(cnv);
+    }
+    ucnv_close(utf8Cnv);
+#endif
+}
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * Converts UTF-8 to cnv's charset by pivoting through UTF-16 explicitly,
+ * for the expected output of ucnv_convertEx() with the same settings.
+ */
+static int32_t pivotFromUTF8(UConverter *utf8Cnv, UConverter *cnv,
+                             const char *src, int32_t srcLength,
+                             char *dest, int32_t destCapacity,
+                             const char *testName) {
+    UChar pivot[200];
+    int32_t pivotLength, length;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    pivotLength=ucnv_toUChars(utf8Cnv, pivot, UPRV_LENGTHOF(pivot), src, srcLength, &errorCode);
+    length=ucnv_fromUChars(cnv, dest, destCapacity, pivot, pivotLength, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("%s: unable to pivot through UTF-16 - %s\n", testName, u_errorName(errorCode));
+        return 0;
+    }
+    return length;
+}
+#endif
+
+/*
+ * Test the direct conversion from UTF-8 to MBCS charsets
+ * with input that it hands off to pivoting through UTF-16:
+ * ill-formed UTF-8, unmappable characters with substitution and
+ * stop callbacks, and fallbacks, with SI/SO state across buffer boundaries.
+ */
+static void TestConvertExMBCSUTF8Errors() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const uint8_t
+    utf8[]={
+        /* "ab" 4e00 FF "c" E3 81 "d" 3004 2015 4fe0 ff5e 00a5 2014 "0..9a..z" 3042 "e" 4e00 E3 81 */
+        0x61, 0x62, 0xe4, 0xb8, 0x80, 0xff, 0x63, 0xe3, 0x81, 0x64,
+        0xe3, 0x80, 0x84, 0xe2, 0x80, 0x95, 0xe4, 0xbf, 0xa0, 0xef, 0xbd, 0x9e,
+        0xc2, 0xa5, 0xe2, 0x80, 0x94,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62,
+        0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
+        0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+        0xe3, 0x81, 0x82, 0x65, 0xe4, 0xb8, 0x80, 0xe3, 0x81
+    },
+    /* "ab" 4e00 "x" 3004 "yz": 3004 is unmappable */
+    utf8Unmappable[]={ 0x61, 0x62, 0xe4, 0xb8, 0x80, 0x78, 0xe3, 0x80, 0x84, 0x79, 0x7a },
+    /* "ab" 4e00 "x" FF "yz" */
+    utf8Illegal[]={ 0x61, 0x62, 0xe4, 0xb8, 0x80, 0x78, 0xff, 0x79, 0x7a };
+    /*
+     * ibm-930 is EBCDIC_STATEFUL, and has fallbacks for U+2015 and U+4FE0
+     * in its extension table and for U+FF5E in its base table.
+     * EUC-JP has fallbacks for U+00A5 and U+2014.
+     */
+    static const char *const names[]={ "ibm-930", "ibm-943", "EUC-JP", "windows-949" };
+
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+    char expected[400], testName[80];
+    int32_t expectedLength;
+    int32_t i, fallback;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("unable to open a UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(names[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open a %s converter - %s\n", names[i], u_errorName(errorCode));
+            continue;
+        }
+
+        /* substitution callbacks, without and with fallbacks */
+        for(fallback=0; fallback<=1; ++fallback) {
+            ucnv_setFallback(cnv, (UBool)fallback);
+            sprintf(testName, "UTF-8 -> %s with errors%s", names[i], fallback ? " and fallbacks" : "");
+            expectedLength=pivotFromUTF8(utf8Cnv, cnv, (const char *)utf8, sizeof(utf8),
+                                         expected, sizeof(expected), testName);
+            convertExMultiStreaming(utf8Cnv, cnv,
+                (const char *)utf8, sizeof(utf8),
+                expected, expectedLength,
+                testName, U_ZERO_ERROR);
+            convertExStreaming(utf8Cnv, cnv,
+                (const char *)utf8, sizeof(utf8),
+                expected, expectedLength,
+                CHUNK_SIZE, testName, U_ZERO_ERROR);
+        }
+        ucnv_setFallback(cnv, false);
+
+        /* stop callbacks: the output ends before the character that stopped the conversion */
+        sprintf(testName, "UTF-8 -> %s with unmappable input and a stop callback", names[i]);
+        expectedLength=pivotFromUTF8(utf8Cnv, cnv, (const char *)utf8Unmappable, 6,
+                                     expected, sizeof(expected), testName);
+        ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+        convertExMultiStreaming(utf8Cnv, cnv,
+            (const char *)utf8Unmappable, sizeof(utf8Unmappable),
+            expected, expectedLength,
+            testName, U_INVALID_CHAR_FOUND);
+        convertExStreaming(utf8Cnv, cnv,
+            (const char *)utf8Unmappable, sizeof(utf8Unmappable),
+            expected, expectedLength,
+            CHUNK_SIZE, testName, U_INVALID_CHAR_FOUND);
+        ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_SUBSTITUTE, NULL, NULL, NULL, &errorCode);
+
+        sprintf(testName, "UTF-8 -> %s with ill-formed input and a stop callback", names[i]);
+        expectedLength=pivotFromUTF8(utf8Cnv, cnv, (const char *)utf8Illegal, 6,
+                                     expected, sizeof(expected), testName);
+        ucnv_setToUCallBack(utf8Cnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+        convertExMultiStreaming(utf8Cnv, cnv,
+            (const char *)utf8Illegal, sizeof(utf8Illegal),
+            expected, expectedLength,
+            testName, U_ILLEGAL_CHAR_FOUND);
+        convertExStreaming(utf8Cnv, cnv,
+            (const char *)utf8Illegal, sizeof(utf8Illegal),
+            expected, expectedLength,
+            CHUNK_SIZE, testName, U_ILLEGAL_CHAR_FOUND);
+        ucnv_setToUCallBack(utf8Cnv, UCNV_TO_U_CALLBACK_SUBSTITUTE, NULL, NULL, NULL, &errorCode);
+
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to set %s callbacks - %s\n", names[i], u_errorName(errorCode));
+        }
+        ucnv_close(cnv);
+    }
+    ucnv_close(utf8Cnv);
+#endif
+}
+
 /* Test illegal UTF-8 input: Data and functions for TestConvertExFromUTF8(). */
 static const char *const badUTF8[]={
     /* trail byte */
@@ -3892,3 +4134,464 @@ static void TestUTFBOM() {
         ucnv_close(cnv);
     }
 }
+
+static void TestConverterPool() {
+    static const UChar abc[] = { 0x61, 0x62, 0x63, 0x20ac, 0x100 };
+    static const char expected[] = { 0x61, 0x62, 0x63, 0x1a, 0x1a };
+    UConverterPool *pool;
+    UConverter *cnv1, *cnv2, *cnv, *other;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UConverterFromUCallback fromUAction;
+    UConverterToUCallback toUAction;
+    const void *context;
+    char bytes[10], subChars[4];
+    int8_t subLength;
+    int32_t i, length;
+
+    pool = ucnvpool_open(&errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("ucnvpool_open() failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    /* a converter is handed out only once until it is released */
+    cnv1 = ucnvpool_acquire(pool, "ISO-8859-1", &errorCode);
+    cnv2 = ucnvpool_acquire(pool, "ISO-8859-1", &errorCode);
+    if(U_FAILURE(errorCode) || cnv1 == NULL || cnv1 == cnv2) {
+        log_err("ucnvpool_acquire(ISO-8859-1) failed - %s\n", u_errorName(errorCode));
+        ucnvpool_close(pool);
+        return;
+    }
+
+    /* change the settings and leave a pending lead surrogate */
+    ucnv_setFromUCallBack(cnv1, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    ucnv_setToUCallBack(cnv1, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    ucnv_setFallback(cnv1, true);
+    {
+        static const UChar lead[] = { 0xd800 };
+        const UChar *source = lead;
+        char *target = bytes;
+        ucnv_fromUnicode(cnv1, &target, bytes + sizeof(bytes), &source, lead + 1, NULL, false, &errorCode);
+    }
+    ucnvpool_release(pool, cnv1);
+    ucnvpool_release(pool, cnv2);
+
+    /* a released converter is reused, reset and with the default settings */
+    cnv = ucnvpool_acquire(pool, "ISO-8859-1", &errorCode);
+    if(U_FAILURE(errorCode) || (cnv != cnv1 && cnv != cnv2)) {
+        log_err("ucnvpool_acquire(ISO-8859-1) did not reuse a released converter - %s\n",
+                u_errorName(errorCode));
+    }
+    if(U_SUCCESS(errorCode)) {
+        ucnv_getFromUCallBack(cnv, &fromUAction, &context);
+        if(fromUAction != UCNV_FROM_U_CALLBACK_SUBSTITUTE || context != NULL) {
+            log_err("pooled converter does not have the default fromUnicode callback\n");
+        }
+        ucnv_getToUCallBack(cnv, &toUAction, &context);
+        if(toUAction != UCNV_TO_U_CALLBACK_SUBSTITUTE || context != NULL) {
+            log_err("pooled converter does not have the default toUnicode callback\n");
+        }
+        if(ucnv_usesFallback(cnv)) {
+            log_err("pooled converter uses fallbacks\n");
+        }
+        length = ucnv_fromUChars(cnv, bytes, (int32_t)sizeof(bytes), abc, UPRV_LENGTHOF(abc), &errorCode);
+        if(U_FAILURE(errorCode) || length != (int32_t)sizeof(expected) ||
+                0 != memcmp(bytes, expected, length)) {
+            log_err("pooled converter converts incorrectly - %s\n", u_errorName(errorCode));
+        }
+
+        /* a converter with other substitution characters is not kept */
+        other = cnv == cnv1 ? cnv2 : cnv1;
+        ucnv_setSubstChars(cnv, "?", 1, &errorCode);
+        ucnvpool_release(pool, cnv);
+        cnv1 = ucnvpool_acquire(pool, "ISO-8859-1", &errorCode);
+        cnv2 = ucnvpool_acquire(pool, "ISO-8859-1", &errorCode);
+        if(U_FAILURE(errorCode) || cnv1 != other) {
+            log_err("ucnvpool_acquire(ISO-8859-1) did not reuse the unchanged converter - %s\n",
+                    u_errorName(errorCode));
+        }
+        for(i = 0; i < 2 && U_SUCCESS(errorCode); ++i) {
+            subLength = (int8_t)sizeof(subChars);
+            ucnv_getSubstChars(i == 0 ? cnv1 : cnv2, subChars, &subLength, &errorCode);
+            if(U_FAILURE(errorCode) || subLength != 1 || subChars[0] != 0x1a) {
+                log_err("pooled converter has changed substitution characters\n");
+            }
+        }
+        ucnvpool_release(pool, cnv1);
+        ucnvpool_release(pool, cnv2);
+    }
+
+    /* names are matched as strings, and errors are reported as by ucnv_open() */
+    cnv = ucnvpool_acquire(pool, "latin1", &errorCode);
+    if(U_FAILURE(errorCode) || strcmp(ucnv_getName(cnv, &errorCode), "ISO-8859-1") != 0) {
+        log_err("ucnvpool_acquire(latin1) failed - %s\n", u_errorName(errorCode));
+    }
+    ucnvpool_release(pool, cnv);
+    errorCode = U_ZERO_ERROR;
+    cnv = ucnvpool_acquire(pool, "no-such-charset", &errorCode);
+    if(errorCode != U_FILE_ACCESS_ERROR || cnv != NULL) {
+        log_err("ucnvpool_acquire(no-such-charset) did not fail - %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    ucnvpool_release(pool, NULL);
+
+    /* NULL is the default converter, as for ucnv_open() */
+    cnv = ucnvpool_acquire(pool, NULL, &errorCode);
+    other = ucnv_open(NULL, &errorCode);
+    if(U_FAILURE(errorCode) ||
+            strcmp(ucnv_getName(cnv, &errorCode), ucnv_getName(other, &errorCode)) != 0) {
+        log_err("ucnvpool_acquire(NULL) did not return the default converter - %s\n",
+                u_errorName(errorCode));
+    }
+    ucnv_close(other);
+    ucnvpool_release(pool, cnv);
+    cnv2 = ucnvpool_acquire(pool, NULL, &errorCode);
+    if(U_FAILURE(errorCode) || cnv2 != cnv) {
+        log_err("ucnvpool_acquire(NULL) did not reuse the idle default converter - %s\n",
+                u_errorName(errorCode));
+    }
+    ucnvpool_release(pool, cnv2);
+    errorCode = U_ZERO_ERROR;
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /*
+     * the pool keeps the data of a converter that it has no idle converters for,
+     * so that ucnv_flushCache() cannot free it and other converter data
+     * cannot take its place
+     */
+    errorCode = U_ZERO_ERROR;
+    cnv = ucnvpool_acquire(pool, "ibm-1047", &errorCode);
+    ucnv_close(cnv);
+    ucnv_flushCache();
+    {
+        static const char *const names[] = { "ibm-37", "ibm-273", "ibm-500", "ibm-1026", "ibm-1140" };
+        for(i = 0; i < UPRV_LENGTHOF(names) && U_SUCCESS(errorCode); ++i) {
+            ucnvpool_release(pool, ucnvpool_acquire(pool, names[i], &errorCode));
+        }
+    }
+    cnv = ucnvpool_acquire(pool, "ibm-1047", &errorCode);
+    if(U_FAILURE(errorCode) || strcmp(ucnv_getName(cnv, &errorCode), "ibm-1047_P100-1995") != 0) {
+        log_err("ucnvpool_acquire(ibm-1047) after ucnv_flushCache() returned %s - %s\n",
+                U_SUCCESS(errorCode) ? ucnv_getName(cnv, &errorCode) : "NULL", u_errorName(errorCode));
+    }
+    ucnvpool_release(pool, cnv);
+#endif
+
+    /* closes the idle converters */
+    ucnvpool_close(pool);
+}
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * Checks batch output and offsets against the concatenated expected strings,
+ * with enough capacity, with exactly enough (no NUL), with too little, and preflighting.
+ */
+static void checkBatchResult(const char *name, int32_t destCapacity, int32_t count,
+                             int32_t length, const int32_t destOffsets[],
+                             const int32_t expectedOffsets[], UErrorCode errorCode) {
+    int32_t expectedLength = expectedOffsets[count];
+    UErrorCode expectedErrorCode =
+        destCapacity < expectedLength ? U_BUFFER_OVERFLOW_ERROR :
+        destCapacity == expectedLength ? U_STRING_NOT_TERMINATED_WARNING : U_ZERO_ERROR;
+    if(errorCode != expectedErrorCode || length != expectedLength) {
+        log_err("%s(capacity %d) sets %s and returns %d, expected %s and %d\n",
+                name, (int)destCapacity, u_errorName(errorCode), (int)length,
+                u_errorName(expectedErrorCode), (int)expectedLength);
+    } else if(0 != memcmp(destOffsets, expectedOffsets, (count + 1) * sizeof(int32_t))) {
+        log_err("%s(capacity %d) sets the wrong destOffsets\n", name, (int)destCapacity);
+    }
+}
+#endif
+
+static void TestConvertBatch() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /* "abc", "", 65e5 672c 8a9e, "xyz", 3042 "1" 4e00 */
+    static const UChar u0[] = { 0x61, 0x62, 0x63 }, u2[] = { 0x65e5, 0x672c, 0x8a9e },
+        u3[] = { 0x78, 0x79, 0x7a, 0 }, u4[] = { 0x3042, 0x31, 0x4e00 };
+    static const UChar *const uSources[] = { u0, NULL, u2, u3, u4 };
+    static const int32_t uLengths[] = { 3, 0, 3, -1, 3 };
+    static const char *const utf8Sources[] = {
+        "abc", "", "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "xyz", "\xe3\x81\x82" "1" "\xe4\xb8\x80"
+    };
+    static const int32_t utf8Lengths[] = { 3, 0, 9, -1, 7 };
+    enum { COUNT = UPRV_LENGTHOF(uSources) };
+    /* ISO-2022-JP is stateful: each string is converted by a reset converter */
+    static const char *const names[] = { "ISO-2022-JP", "Shift_JIS", "UTF-8" };
+
+    char expected[200], bytes[200];
+    UChar expectedUChars[100], uchars[100];
+    const char *sources[COUNT];
+    int32_t lengths[COUNT];
+    int32_t expectedOffsets[COUNT + 1], uExpectedOffsets[COUNT + 1], destOffsets[COUNT + 1];
+    int32_t i, j, length, capacity;
+    UConverter *cnv, *utf8Cnv;
+    UErrorCode errorCode = U_ZERO_ERROR;
+
+    utf8Cnv = ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open a UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+    for(i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        cnv = ucnv_open(names[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open a %s converter - %s\n", names[i], u_errorName(errorCode));
+            break;
+        }
+
+        /* expected: the same as separate ucnv_fromUChars() calls */
+        length = 0;
+        for(j = 0; j < COUNT; ++j) {
+            expectedOffsets[j] = length;
+            length += ucnv_fromUChars(cnv, expected + length, (int32_t)sizeof(expected) - length,
+                                      uSources[j], uLengths[j], &errorCode);
+        }
+        expectedOffsets[COUNT] = length;
+        if(U_FAILURE(errorCode)) {
+            log_err("%s ucnv_fromUChars() failed - %s\n", names[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            break;
+        }
+
+        /* Unicode to codepage */
+        for(capacity = length + 1; capacity >= 0; capacity -= capacity > expectedOffsets[COUNT] - 2 ? 1 : 4) {
+            memset(bytes, 0x55, sizeof(bytes));
+            errorCode = U_ZERO_ERROR;
+            length = ucnv_fromUCharsBatch(cnv, capacity == 0 ? NULL : bytes, capacity,
+                                          uSources, uLengths, COUNT, destOffsets, &errorCode);
+            checkBatchResult("ucnv_fromUCharsBatch", capacity, COUNT,
+                             length, destOffsets, expectedOffsets, errorCode);
+            if(0 != memcmp(bytes, expected, (capacity < expectedOffsets[COUNT] ? capacity : expectedOffsets[COUNT])) ||
+                    (capacity > expectedOffsets[COUNT] && bytes[expectedOffsets[COUNT]] != 0) ||
+                    (capacity < (int32_t)sizeof(bytes) && bytes[capacity] != 0x55)) {
+                log_err("%s ucnv_fromUCharsBatch(capacity %d) wrong output\n", names[i], (int)capacity);
+            }
+        }
+
+        /* codepage to Unicode: the same as separate ucnv_toUChars() calls */
+        errorCode = U_ZERO_ERROR;
+        length = 0;
+        for(j = 0; j < COUNT; ++j) {
+            sources[j] = expected + expectedOffsets[j];
+            lengths[j] = expectedOffsets[j + 1] - expectedOffsets[j];
+            uExpectedOffsets[j] = length;
+            length += ucnv_toUChars(cnv, expectedUChars + length, UPRV_LENGTHOF(expectedUChars) - length,
+                                    sources[j], expectedOffsets[j + 1] - expectedOffsets[j], &errorCode);
+        }
+        uExpectedOffsets[COUNT] = length;
+        for(capacity = length + 1; capacity >= 0 && U_SUCCESS(errorCode); --capacity) {
+            memset(uchars, 0x55, sizeof(uchars));
+            errorCode = U_ZERO_ERROR;
+            length = ucnv_toUCharsBatch(cnv, capacity == 0 ? NULL : uchars, capacity,
+                                        sources, lengths, COUNT, destOffsets, &errorCode);
+            checkBatchResult("ucnv_toUCharsBatch", capacity, COUNT,
+                             length, destOffsets, uExpectedOffsets, errorCode);
+            if(0 != memcmp(uchars, expectedUChars, (capacity < uExpectedOffsets[COUNT] ? capacity : uExpectedOffsets[COUNT]) * U_SIZEOF_UCHAR)) {
+                log_err("%s ucnv_toUCharsBatch(capacity %d) wrong output\n", names[i], (int)capacity);
+            }
+            if(U_FAILURE(errorCode) && errorCode != U_BUFFER_OVERFLOW_ERROR) {
+                break;
+            }
+            errorCode = U_ZERO_ERROR;
+        }
+
+        /* UTF-8 to codepage, and back */
+        for(capacity = expectedOffsets[COUNT] + 1; capacity >= 0; --capacity) {
+            memset(bytes, 0x55, sizeof(bytes));
+            errorCode = U_ZERO_ERROR;
+            length = ucnv_convertBatch(cnv, utf8Cnv, capacity == 0 ? NULL : bytes, capacity,
+                                       utf8Sources, utf8Lengths, COUNT, destOffsets, &errorCode);
+            checkBatchResult("ucnv_convertBatch", capacity, COUNT,
+                             length, destOffsets, expectedOffsets, errorCode);
+            if(0 != memcmp(bytes, expected, (capacity < expectedOffsets[COUNT] ? capacity : expectedOffsets[COUNT])) ||
+                    (capacity < (int32_t)sizeof(bytes) && bytes[capacity] != 0x55)) {
+                log_err("%s ucnv_convertBatch(capacity %d) wrong output\n", names[i], (int)capacity);
+            }
+        }
+        errorCode = U_ZERO_ERROR;
+        length = ucnv_convertBatch(utf8Cnv, cnv, bytes, (int32_t)sizeof(bytes),
+                                   sources, lengths, COUNT, destOffsets, &errorCode);
+        for(j = 0; U_SUCCESS(errorCode) && j < COUNT; ++j) {
+            const char *s = utf8Sources[j];
+            int32_t sLength = utf8Lengths[j] < 0 ? (int32_t)strlen(s) : utf8Lengths[j];
+            if(destOffsets[j + 1] - destOffsets[j] != sLength ||
+                    0 != memcmp(bytes + destOffsets[j], s, sLength)) {
+                log_err("%s ucnv_convertBatch() to UTF-8 wrong output for string %d\n", names[i], (int)j);
+            }
+        }
+        if(U_FAILURE(errorCode)) {
+            log_err("%s ucnv_convertBatch() to UTF-8 failed - %s\n", names[i], u_errorName(errorCode));
+        }
+
+        ucnv_close(cnv);
+    }
+
+    /* conversion errors stop the batch */
+    errorCode = U_ZERO_ERROR;
+    cnv = ucnv_open("ISO-8859-1", &errorCode);
+    ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open an ISO-8859-1 converter - %s\n", u_errorName(errorCode));
+    } else {
+        destOffsets[3] = -1;
+        length = ucnv_fromUCharsBatch(cnv, bytes, (int32_t)sizeof(bytes),
+                                      uSources, uLengths, COUNT, destOffsets, &errorCode);
+        if(errorCode != U_INVALID_CHAR_FOUND || length != 3 ||
+                destOffsets[0] != 0 || destOffsets[1] != 3 || destOffsets[2] != 3 || destOffsets[3] != -1) {
+            log_err("ucnv_fromUCharsBatch(ISO-8859-1, stop) sets %s and returns %d\n",
+                    u_errorName(errorCode), (int)length);
+        }
+    }
+    ucnv_close(cnv);
+
+    /* illegal arguments */
+    errorCode = U_ZERO_ERROR;
+    length = ucnv_fromUCharsBatch(utf8Cnv, bytes, (int32_t)sizeof(bytes),
+                                  uSources, uLengths, COUNT, NULL, &errorCode);
+    if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_fromUCharsBatch(destOffsets=NULL) sets %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    length = ucnv_toUCharsBatch(utf8Cnv, uchars, UPRV_LENGTHOF(uchars),
+                                NULL, utf8Lengths, COUNT, destOffsets, &errorCode);
+    if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_toUCharsBatch(sources=NULL) sets %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    length = ucnv_convertBatch(utf8Cnv, utf8Cnv, bytes, (int32_t)sizeof(bytes),
+                               utf8Sources, utf8Lengths, -1, destOffsets, &errorCode);
+    if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_convertBatch(count=-1) sets %s\n", u_errorName(errorCode));
+    }
+
+    /* no strings */
+    errorCode = U_ZERO_ERROR;
+    length = ucnv_toUCharsBatch(utf8Cnv, uchars, UPRV_LENGTHOF(uchars),
+                                NULL, NULL, 0, destOffsets, &errorCode);
+    if(U_FAILURE(errorCode) || length != 0 || destOffsets[0] != 0 || uchars[0] != 0) {
+        log_err("ucnv_toUCharsBatch(count=0) sets %s\n", u_errorName(errorCode));
+    }
+    ucnv_close(utf8Cnv);
+#endif
+}
+
+static void TestConvertParallel() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /* UTF-8 lines: "line \t" 65e5 672c 8a9e, a line number, and "\r\n" */
+    static const char line[] = "line \t\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e";
+    /* ISO-2022-JP is stateful and converted on one thread */
+    static const char *const names[] = {
+        "Shift_JIS", "GB18030", "UTF-16LE", "UTF-32BE", "ISO-2022-JP", "ibm-930"
+    };
+    enum { SOURCE_CAPACITY = 200000, DEST_CAPACITY = 1000000 };
+    char *utf8 = (char *)malloc(SOURCE_CAPACITY);
+    char *expected = (char *)malloc(DEST_CAPACITY);
+    char *dest = (char *)malloc(DEST_CAPACITY);
+    char *back = (char *)malloc(SOURCE_CAPACITY);
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode = U_ZERO_ERROR, expectedErrorCode;
+    int32_t i, utf8Length, expectedLength, length, backLength;
+
+    if(utf8 == NULL || expected == NULL || dest == NULL || back == NULL) {
+        log_err("out of memory\n");
+        free(utf8); free(expected); free(dest); free(back);
+        return;
+    }
+    utf8Length = 0;
+    for(i = 0; utf8Length < SOURCE_CAPACITY - 100; ++i) {
+        utf8Length += sprintf(utf8 + utf8Length, "%s %d\r\n", line, (int)i);
+    }
+
+    utf8Cnv = ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open a UTF-8 converter - %s\n", u_errorName(errorCode));
+        free(utf8); free(expected); free(dest); free(back);
+        return;
+    }
+    for(i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        cnv = ucnv_open(names[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open a %s converter - %s\n", names[i], u_errorName(errorCode));
+            errorCode = U_ZERO_ERROR;
+            continue;
+        }
+
+        /* the same as one ucnv_convertEx() call */
+        {
+            char *target = expected;
+            const char *source = utf8;
+            ucnv_convertEx(cnv, utf8Cnv, &target, expected + DEST_CAPACITY,
+                           &source, utf8 + utf8Length, NULL, NULL, NULL, NULL,
+                           true, true, &errorCode);
+            expectedLength = (int32_t)(target - expected);
+        }
+        length = ucnv_convertParallel(cnv, utf8Cnv, dest, DEST_CAPACITY,
+                                      utf8, utf8Length, 4, &errorCode);
+        if(U_FAILURE(errorCode) || length != expectedLength ||
+                0 != memcmp(dest, expected, length) || dest[length] != 0) {
+            log_err("ucnv_convertParallel(UTF-8 to %s) differs from ucnv_convertEx() - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+
+        /* and back to UTF-8 */
+        backLength = ucnv_convertParallel(utf8Cnv, cnv, back, SOURCE_CAPACITY,
+                                          expected, expectedLength, 3, &errorCode);
+        if(U_FAILURE(errorCode) || backLength != utf8Length || 0 != memcmp(back, utf8, utf8Length)) {
+            log_err("ucnv_convertParallel(%s to UTF-8) does not round-trip - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+
+        /* preflighting, and too little capacity */
+        length = ucnv_convertParallel(cnv, utf8Cnv, NULL, 0, utf8, utf8Length, 4, &errorCode);
+        if(errorCode != U_BUFFER_OVERFLOW_ERROR || length != expectedLength) {
+            log_err("ucnv_convertParallel(UTF-8 to %s, preflighting) - %s length %d\n",
+                    names[i], u_errorName(errorCode), (int)length);
+        }
+        errorCode = U_ZERO_ERROR;
+        memset(dest, 0x55, expectedLength);
+        length = ucnv_convertParallel(cnv, utf8Cnv, dest, expectedLength - 1000,
+                                      utf8, utf8Length, 4, &errorCode);
+        if(errorCode != U_BUFFER_OVERFLOW_ERROR || length != expectedLength ||
+                0 != memcmp(dest, expected, expectedLength - 1000) ||
+                dest[expectedLength - 1000] != 0x55) {
+            log_err("ucnv_convertParallel(UTF-8 to %s, overflow) - %s length %d\n",
+                    names[i], u_errorName(errorCode), (int)length);
+        }
+        errorCode = U_ZERO_ERROR;
+        ucnv_close(cnv);
+    }
+
+    /* a conversion error is reported for the first piece where it occurs */
+    cnv = ucnv_open("US-ASCII", &errorCode);
+    ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    if(U_SUCCESS(errorCode)) {
+        char *target = expected;
+        const char *source = utf8;
+        ucnv_convertEx(cnv, utf8Cnv, &target, expected + DEST_CAPACITY,
+                       &source, utf8 + utf8Length, NULL, NULL, NULL, NULL,
+                       true, true, &errorCode);
+        expectedErrorCode = errorCode;
+        expectedLength = (int32_t)(target - expected);
+        errorCode = U_ZERO_ERROR;
+        length = ucnv_convertParallel(cnv, utf8Cnv, dest, DEST_CAPACITY,
+                                      utf8, utf8Length, 4, &errorCode);
+        if(expectedErrorCode != U_INVALID_CHAR_FOUND || errorCode != expectedErrorCode ||
+                length != expectedLength || 0 != memcmp(dest, expected, length)) {
+            log_err("ucnv_convertParallel(UTF-8 to US-ASCII, stop) - %s length %d\n",
+                    u_errorName(errorCode), (int)length);
+        }
+    }
+    ucnv_close(cnv);
+
+    errorCode = U_ZERO_ERROR;
+    ucnv_convertParallel(utf8Cnv, utf8Cnv, dest, DEST_CAPACITY, utf8, utf8Length, 0, &errorCode);
+    if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_convertParallel(threadCount=0) - %s\n", u_errorName(errorCode));
+    }
+    ucnv_close(utf8Cnv);
+    free(utf8);
+    free(expected);
+    free(dest);
+    free(back);
+#endif
+}
@@ -39,6 +39,8 @@ static void Test_strFromUTF32_surrogates(void);
 static void Test_UChar_UTF8_API(void);
 static void Test_FromUTF8(void);
 static void Test_FromUTF8Lenient(void);
+static void Test_UTF8_Blocks(void);
+static void Test_ValidateUTF8(void);
 static void Test_UChar_WCHART_API(void);
 static void Test_widestrs(void);
 static void Test_WCHART_LongString(void);
@@ -56,6 +58,8 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_UChar_UTF8_API, "custrtrn/Test_UChar_UTF8_API");
    addTest(root, &Test_FromUTF8, "custrtrn/Test_FromUTF8");
    addTest(root, &Test_FromUTF8Lenient, "custrtrn/Test_FromUTF8Lenient");
+   addTest(root, &Test_UTF8_Blocks, "custrtrn/Test_UTF8_Blocks");
+   addTest(root, &Test_ValidateUTF8, "custrtrn/Test_ValidateUTF8");
    addTest(root, &Test_UChar_WCHART_API,  "custrtrn/Test_UChar_WCHART_API");
    addTest(root, &Test_widestrs,  "custrtrn/Test_widestrs");
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
@@ -929,6 +933,211 @@ Test_FromUTF8(void) {
     }
 }
 
+/*
+ * Test u_strFromUTF8WithSub() and u_strToUTF8WithSub() with ASCII text around
+ * one other sequence at each position, so that it occurs at every position
+ * in the blocks of ASCII that the conversion copies at once.
+ * Compare with conversions via the U8_NEXT() and U16_NEXT() macros.
+ */
+static void
+Test_UTF8_Blocks(void) {
+    static const char *const sequences[]={
+        "\xc3\xa9",                 /* U+00E9 */
+        "\xe4\xb8\x80",             /* U+4E00 */
+        "\xf0\x9f\x98\x80",         /* U+1F600 */
+        "\xf4\x8f\xbf\xbf",         /* U+10FFFF */
+        "\x80",                     /* ill-formed: trail byte */
+        "\xf0\x9f\x98",             /* ill-formed: truncated */
+        "\xf4\x90\x80\x80",         /* ill-formed: above U+10FFFF */
+        "\xf0\x80\x80\x80",         /* ill-formed: non-shortest form */
+        "\xf8\x88\x80\x80\x80",     /* ill-formed: 5-byte form */
+        "\xed\xa0\x80"              /* ill-formed: surrogate */
+    };
+    static const int32_t lengths[]={ 17, 40, 75 };
+    char text8[80], dest8[240], expected8[240];
+    UChar text16[80], dest16[80], expected16[80];
+    int32_t s, l, pos;
+
+    for(s=0; s<UPRV_LENGTHOF(sequences); ++s) {
+        int32_t seqLength=(int32_t)uprv_strlen(sequences[s]);
+        for(l=0; l<UPRV_LENGTHOF(lengths); ++l) {
+            int32_t length=lengths[l];
+            for(pos=0; pos<=length-seqLength; ++pos) {
+                int32_t i, j, expectedLength, expectedSubs, destLength, numSubs;
+                UErrorCode errorCode;
+                UChar32 c;
+
+                for(i=0; i<length; ++i) {
+                    text8[i]=(char)(0x61+i%26);
+                }
+                uprv_memcpy(text8+pos, sequences[s], seqLength);
+
+                /* UTF-8 to UTF-16 */
+                expectedLength=expectedSubs=0;
+                for(i=0; i<length;) {
+                    U8_NEXT(text8, i, length, c);
+                    if(c<0) {
+                        c=0xfffd;
+                        ++expectedSubs;
+                    }
+                    U16_APPEND_UNSAFE(expected16, expectedLength, c);
+                }
+                errorCode=U_ZERO_ERROR;
+                /* with a capacity for exactly the output, as well as with some extra */
+                for(j=0; j<2; ++j) {
+                    u_strFromUTF8WithSub(dest16, j==0 ? expectedLength : UPRV_LENGTHOF(dest16),
+                                         &destLength, text8, length,
+                                         0xfffd, &numSubs, &errorCode);
+                    if(U_FAILURE(errorCode) || destLength!=expectedLength || numSubs!=expectedSubs ||
+                            uprv_memcmp(dest16, expected16, expectedLength*U_SIZEOF_UCHAR)!=0) {
+                        log_err("error: u_strFromUTF8WithSub(sequence %d at %d in length %d) "
+                                "wrong result - %s\n",
+                                (int)s, (int)pos, (int)length, u_errorName(errorCode));
+                    }
+                }
+                /* pre-flighting */
+                errorCode=U_ZERO_ERROR;
+                u_strFromUTF8WithSub(NULL, 0, &destLength, text8, length,
+                                     0xfffd, &numSubs, &errorCode);
+                if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=expectedLength ||
+                        numSubs!=expectedSubs) {
+                    log_err("error: u_strFromUTF8WithSub(sequence %d at %d in length %d) "
+                            "wrong pre-flighting result - %s\n",
+                            (int)s, (int)pos, (int)length, u_errorName(errorCode));
+                }
+                errorCode=U_ZERO_ERROR;
+
+                /* UTF-16 to UTF-8, with the UTF-16 text from above */
+                u_memcpy(text16, expected16, expectedLength);
+                length=expectedLength;
+                expectedLength=0;
+                for(i=0; i<length;) {
+                    U16_NEXT(text16, i, length, c);
+                    U8_APPEND_UNSAFE(expected8, expectedLength, c);
+                }
+                for(j=0; j<2; ++j) {
+                    u_strToUTF8WithSub(dest8, j==0 ? expectedLength : UPRV_LENGTHOF(dest8),
+                                       &destLength, text16, length,
+                                       0xfffd, &numSubs, &errorCode);
+                    if(U_FAILURE(errorCode) || destLength!=expectedLength || numSubs!=0 ||
+                            uprv_memcmp(dest8, expected8, expectedLength)!=0) {
+                        log_err("error: u_strToUTF8WithSub(sequence %d at %d in length %d) "
+                                "wrong result - %s\n",
+                                (int)s, (int)pos, (int)length, u_errorName(errorCode));
+                    }
+                }
+                length=lengths[l];
+            }
+        }
+    }
+
+    /* an unpaired surrogate at each position, substituted in UTF-8 */
+    for(pos=0; pos<UPRV_LENGTHOF(text16); ++pos) {
+        int32_t destLength, numSubs;
+        UErrorCode errorCode=U_ZERO_ERROR;
+        for(l=0; l<UPRV_LENGTHOF(text16); ++l) {
+            text16[l]=(UChar)(0x61+l%26);
+        }
+        text16[pos]=0xdc00;
+        u_strToUTF8WithSub(dest8, UPRV_LENGTHOF(dest8), &destLength,
+                           text16, UPRV_LENGTHOF(text16), 0xfffd, &numSubs, &errorCode);
+        if(U_FAILURE(errorCode) || destLength!=UPRV_LENGTHOF(text16)+2 || numSubs!=1 ||
+                uprv_memcmp(dest8+pos, "\xef\xbf\xbd", 3)!=0 ||
+                (pos+1<UPRV_LENGTHOF(text16) && dest8[pos+3]!=(char)(0x61+(pos+1)%26))) {
+            log_err("error: u_strToUTF8WithSub(unpaired surrogate at %d) wrong result - %s\n",
+                    (int)pos, u_errorName(errorCode));
+        }
+    }
+}
+
+/* test u_validateUTF8() against U8_NEXT() */
+static void
+Test_ValidateUTF8(void) {
+    static const char *const sequences[]={
+        "\xc3\xa9",                 /* U+00E9 */
+        "\xe4\xb8\x80",             /* U+4E00 */
+        "\xf0\x9f\x98\x80",         /* U+1F600 */
+        "\xc2\x80\xdf\xbf",         /* U+0080 U+07FF */
+        "\xc1\xbf",                 /* ill-formed: non-shortest form */
+        "\xe0\x9f\xbf",             /* ill-formed: non-shortest form */
+        "\xed\xbf\xbf",             /* ill-formed: surrogate */
+        "\xf4\x90\x80\x80",         /* ill-formed: above U+10FFFF */
+        "\xe4\xb8",                 /* ill-formed: truncated */
+        "\xff"                      /* ill-formed: not a UTF-8 byte */
+    };
+    static const int32_t lengths[]={ 3, 17, 40, 75 };
+    char text8[80];
+    int32_t s, l, pos, index, numCodePoints;
+    UErrorCode errorCode;
+
+    for(s=0; s<UPRV_LENGTHOF(sequences); ++s) {
+        int32_t seqLength=(int32_t)uprv_strlen(sequences[s]);
+        for(l=0; l<UPRV_LENGTHOF(lengths); ++l) {
+            int32_t length=lengths[l];
+            for(pos=0; pos<=length-seqLength; ++pos) {
+                int32_t i, expectedIndex=-1, expectedNumCodePoints=0;
+                UChar32 c;
+
+                for(i=0; i<length; ++i) {
+                    text8[i]=(char)(0x61+i%26);
+                }
+                text8[length]=0;
+                uprv_memcpy(text8+pos, sequences[s], seqLength);
+                for(i=0; i<length;) {
+                    int32_t start=i;
+                    U8_NEXT(text8, i, length, c);
+                    if(c<0) {
+                        expectedIndex=start;
+                        break;
+                    }
+                    ++expectedNumCodePoints;
+                }
+
+                errorCode=U_ZERO_ERROR;
+                index=u_validateUTF8(text8, length, &numCodePoints, &errorCode);
+                if(U_FAILURE(errorCode) || index!=expectedIndex ||
+                        numCodePoints!=expectedNumCodePoints) {
+                    log_err("error: u_validateUTF8(sequence %d at %d in length %d)=%d "
+                            "with %d code points, expected %d with %d - %s\n",
+                            (int)s, (int)pos, (int)length, (int)index, (int)numCodePoints,
+                            (int)expectedIndex, (int)expectedNumCodePoints,
+                            u_errorName(errorCode));
+                }
+                index=u_validateUTF8(text8, -1, NULL, &errorCode);
+                if(U_FAILURE(errorCode) || index!=expectedIndex) {
+                    log_err("error: u_validateUTF8(sequence %d at %d in length %d, NUL-terminated)"
+                            "=%d, expected %d - %s\n",
+                            (int)s, (int)pos, (int)length, (int)index, (int)expectedIndex,
+                            u_errorName(errorCode));
+                }
+            }
+        }
+    }
+
+    /* empty strings */
+    errorCode=U_ZERO_ERROR;
+    numCodePoints=99;
+    index=u_validateUTF8(NULL, 0, &numCodePoints, &errorCode);
+    if(U_FAILURE(errorCode) || index!=-1 || numCodePoints!=0) {
+        log_err("error: u_validateUTF8(NULL, 0)=%d - %s\n", (int)index, u_errorName(errorCode));
+    }
+    index=u_validateUTF8("", -1, &numCodePoints, &errorCode);
+    if(U_FAILURE(errorCode) || index!=-1 || numCodePoints!=0) {
+        log_err("error: u_validateUTF8(\"\", -1)=%d - %s\n", (int)index, u_errorName(errorCode));
+    }
+
+    /* illegal arguments */
+    index=u_validateUTF8(NULL, 1, NULL, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR || index!=-1) {
+        log_err("error: u_validateUTF8(NULL, 1)=%d - %s\n", (int)index, u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    index=u_validateUTF8("a", -2, NULL, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR || index!=-1) {
+        log_err("error: u_validateUTF8(\"a\", -2)=%d - %s\n", (int)index, u_errorName(errorCode));
+    }
+}
+
 /* test u_strFromUTF8Lenient() */
 static void
 Test_FromUTF8Lenient(void) {
@@ -15,6 +15,7 @@
 #include "unicode/uclean.h"
 #include "unicode/uchar.h"
 #include "unicode/ures.h"
+#include "unicode/uinitcat.h"
 #include "cintltst.h"
 #include "unicode/utrace.h"
 #include <stdlib.h>
@@ -30,6 +31,7 @@ typedef union {
 } ctest_AlignedMemory;
 
 static void TestHeapFunctions(void);
+static void TestInitCategories(void);
 
 void addHeapMutexTest(TestNode **root);
 
@@ -38,6 +40,7 @@ void
 addHeapMutexTest(TestNode** root)
 {
     addTest(root, &TestHeapFunctions,       "hpmufn/TestHeapFunctions"  );
+    addTest(root, &TestInitCategories,      "hpmufn/TestInitCategories" );
 }
 
 static int32_t gMutexFailures = 0;
@@ -200,3 +203,54 @@ static void TestHeapFunctions() {
 }
 
 
+/*
+ *  Eager initialization of ICU singletons by category.
+ */
+static void TestInitCategories() {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t    i;
+    int64_t    collationTime;
+
+    /* Start from scratch, in case an earlier test initialized some categories. */
+    ctest_resetICU();
+    for (i = 0; i < U_INIT_CATEGORY_COUNT; ++i) {
+        TEST_ASSERT(u_getCategoryInitTime((UInitCategory)i) == -1);
+    }
+    TEST_ASSERT(u_getCategoryInitTime((UInitCategory)-1) == -1);
+    TEST_ASSERT(u_getCategoryInitTime(U_INIT_CATEGORY_COUNT) == -1);
+
+    /* A failure on input is passed through without doing anything. */
+    status = U_ILLEGAL_ARGUMENT_ERROR;
+    u_initCategories(U_INIT_ALL_CATEGORIES, &status);
+    TEST_STATUS(status, U_ILLEGAL_ARGUMENT_ERROR);
+    TEST_ASSERT(u_getCategoryInitTime(U_INIT_NORMALIZATION) == -1);
+
+    status = U_ZERO_ERROR;
+    u_initCategories(U_INIT_MASK(U_INIT_NORMALIZATION) | U_INIT_MASK(U_INIT_COLLATION), &status);
+    if (U_FAILURE(status)) {
+        log_data_err("u_initCategories() failed - %s (Are you missing data?)\n", u_errorName(status));
+        return;
+    }
+    TEST_ASSERT(u_getCategoryInitTime(U_INIT_NORMALIZATION) >= 0);
+    TEST_ASSERT(u_getCategoryInitTime(U_INIT_COLLATION) >= 0);
+    TEST_ASSERT(u_getCategoryInitTime(U_INIT_BREAK_ITERATION) == -1);
+    TEST_ASSERT(u_getCategoryInitTime(U_INIT_TIME_ZONES) == -1);
+
+    /* Initialized categories are not initialized again. */
+    collationTime = u_getCategoryInitTime(U_INIT_COLLATION);
+    u_initCategories(U_INIT_ALL_CATEGORIES, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("u_initCategories(all) failed - %s (Are you missing data?)\n", u_errorName(status));
+        return;
+    }
+    TEST_ASSERT(u_getCategoryInitTime(U_INIT_COLLATION) == collationTime);
+    for (i = 0; i < U_INIT_CATEGORY_COUNT; ++i) {
+        TEST_ASSERT(u_getCategoryInitTime((UInitCategory)i) >= 0);
+    }
+
+    /* u_cleanup() unloads the singletons, so they need to be initialized again. */
+    ctest_resetICU();
+    for (i = 0; i < U_INIT_CATEGORY_COUNT; ++i) {
+        TEST_ASSERT(u_getCategoryInitTime((UInitCategory)i) == -1);
+    }
+}
@@ -52,6 +52,8 @@ static void TestUTF32(void);
 static void TestUTF32BE(void);
 static void TestUTF32LE(void);
 static void TestLATIN1(void);
+static void TestLatin1Blocks(void);
+static void TestSBCSBlocks(void);
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
 static void TestSBCS(void);
@@ -86,6 +88,8 @@ static void TestSCSU(void);
 #if !UCONFIG_NO_LEGACY_CONVERSION
 static void TestEBCDIC_STATEFUL(void);
 static void TestGB18030(void);
+static void TestGB18030Ranges(void);
+static void TestStatefulASCIIRuns(void);
 static void TestLMBCS(void);
 static void TestJitterbug255(void);
 static void TestEBCDICUS4XML(void);
@@ -275,6 +279,8 @@ void addTestNewConvert(TestNode** root)
 #endif
 
    addTest(root, &TestLATIN1, "tsconv/nucnvtst/TestLATIN1");
+   addTest(root, &TestLatin1Blocks, "tsconv/nucnvtst/TestLatin1Blocks");
+   addTest(root, &TestSBCSBlocks, "tsconv/nucnvtst/TestSBCSBlocks");
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
    addTest(root, &TestSBCS, "tsconv/nucnvtst/TestSBCS");
@@ -308,6 +314,8 @@ void addTestNewConvert(TestNode** root)
 #if !UCONFIG_NO_LEGACY_CONVERSION
    addTest(root, &TestEBCDIC_STATEFUL, "tsconv/nucnvtst/TestEBCDIC_STATEFUL");
    addTest(root, &TestGB18030, "tsconv/nucnvtst/TestGB18030");
+   addTest(root, &TestGB18030Ranges, "tsconv/nucnvtst/TestGB18030Ranges");
+   addTest(root, &TestStatefulASCIIRuns, "tsconv/nucnvtst/TestStatefulASCIIRuns");
    addTest(root, &TestJitterbug255, "tsconv/nucnvtst/TestJitterbug255");
    addTest(root, &TestEBCDICUS4XML, "tsconv/nucnvtst/TestEBCDICUS4XML");
    addTest(root, &TestISCII, "tsconv/nucnvtst/TestISCII");
@@ -2529,6 +2537,210 @@ TestLATIN1() {
     ucnv_close(cnv);
 }
 
+/*
+ * Latin-1 and US-ASCII convert blocks of text at a time.
+ * Put an unmappable character at each position of texts of various lengths,
+ * and check that the conversion stops exactly there, with correct offsets.
+ */
+static void
+TestLatin1Blocks() {
+    static const char *const names[]={ "ISO-8859-1", "US-ASCII" };
+    static const UChar unmappable[]={ 0x100, 0x80 };
+    static const int32_t lengths[]={ 15, 16, 33, 70 };
+    UChar text16[80], dest16[80];
+    char text8[80], dest8[80];
+    int32_t offsets[80];
+    int32_t n, l, pos, i;
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(names[n], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open a %s converter: %s\n", names[n], u_errorName(errorCode));
+            continue;
+        }
+        ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+        ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+        for(l=0; l<UPRV_LENGTHOF(lengths); ++l) {
+            int32_t length=lengths[l];
+            /* pos==length: no unmappable character */
+            for(pos=0; pos<=length; ++pos) {
+                const UChar *source16;
+                const char *source8;
+                char *target8;
+                UChar *target16;
+                int32_t expectedLength= pos<length ? pos : length;
+
+                for(i=0; i<length; ++i) {
+                    text16[i]=(UChar)(n==0 ? 0x20+(i*7)%0xe0 : 0x20+(i*7)%0x60);
+                    text8[i]=(char)text16[i];
+                }
+
+                /* from Unicode */
+                if(pos<length) {
+                    text16[pos]=unmappable[n];
+                }
+                ucnv_resetFromUnicode(cnv);
+                source16=text16;
+                target8=dest8;
+                errorCode=U_ZERO_ERROR;
+                ucnv_fromUnicode(cnv, &target8, dest8+UPRV_LENGTHOF(dest8),
+                                 &source16, text16+length, offsets, true, &errorCode);
+                if((pos<length ? errorCode!=U_INVALID_CHAR_FOUND : U_FAILURE(errorCode)) ||
+                        (target8-dest8)!=expectedLength ||
+                        (source16-text16)!=(pos<length ? pos+1 : length)) {
+                    log_err("%s fromUnicode(length %d, unmappable at %d) stopped at %d - %s\n",
+                            names[n], (int)length, (int)pos, (int)(target8-dest8),
+                            u_errorName(errorCode));
+                    continue;
+                }
+                for(i=0; i<expectedLength; ++i) {
+                    if(dest8[i]!=text8[i] || offsets[i]!=i) {
+                        log_err("%s fromUnicode(length %d, unmappable at %d) wrong output "
+                                "or offset at %d\n",
+                                names[n], (int)length, (int)pos, (int)i);
+                        break;
+                    }
+                }
+
+                /* to Unicode */
+                if(pos<length) {
+                    if(n==0) {
+                        /* all bytes are valid Latin-1 */
+                        text8[pos]=(char)0xff;
+                        expectedLength=length;
+                    } else {
+                        text8[pos]=(char)0x80;
+                    }
+                }
+                for(i=0; i<length; ++i) {
+                    text16[i]=(uint8_t)text8[i];
+                }
+                ucnv_resetToUnicode(cnv);
+                source8=text8;
+                target16=dest16;
+                errorCode=U_ZERO_ERROR;
+                ucnv_toUnicode(cnv, &target16, dest16+UPRV_LENGTHOF(dest16),
+                               &source8, text8+length, offsets, true, &errorCode);
+                if((expectedLength<length ? errorCode!=U_ILLEGAL_CHAR_FOUND : U_FAILURE(errorCode)) ||
+                        (target16-dest16)!=expectedLength) {
+                    log_err("%s toUnicode(length %d, illegal at %d) stopped at %d - %s\n",
+                            names[n], (int)length, (int)pos, (int)(target16-dest16),
+                            u_errorName(errorCode));
+                    continue;
+                }
+                for(i=0; i<expectedLength; ++i) {
+                    if(dest16[i]!=text16[i] || offsets[i]!=i) {
+                        log_err("%s toUnicode(length %d, illegal at %d) wrong output "
+                                "or offset at %d\n",
+                                names[n], (int)length, (int)pos, (int)i);
+                        break;
+                    }
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
+/*
+ * Runs of ASCII in table-based SBCS codepages where all of ASCII round-trips
+ * are converted in blocks. Mix such runs with other characters,
+ * and put an unmappable character or byte at each position.
+ */
+static void
+TestSBCSBlocks() {
+    static const int32_t lengths[]={ 15, 16, 33, 70 };
+    UChar text16[80], dest16[80];
+    char text8[80], dest8[80];
+    int32_t offsets[80];
+    int32_t l, pos, i;
+
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UConverter *cnv=ucnv_open("windows-1253", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("Unable to open a windows-1253 converter: %s\n", u_errorName(errorCode));
+        return;
+    }
+    ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    for(l=0; l<UPRV_LENGTHOF(lengths); ++l) {
+        int32_t length=lengths[l];
+        /* pos==length: no unmappable character */
+        for(pos=0; pos<=length; ++pos) {
+            const UChar *source16;
+            const char *source8;
+            char *target8;
+            UChar *target16;
+            int32_t expectedLength= pos<length ? pos : length;
+
+            for(i=0; i<length; ++i) {
+                if(((i/20)%3)==2) {
+                    /* Greek small letters U+03B1..U+03C9 map to 0xe1..0xf9 */
+                    text16[i]=(UChar)(0x3b1+i%25);
+                    text8[i]=(char)(0xe1+i%25);
+                } else {
+                    text16[i]=(UChar)(0x20+(i*7)%0x5f);
+                    text8[i]=(char)text16[i];
+                }
+            }
+
+            /* from Unicode */
+            if(pos<length) {
+                text16[pos]=0x100;
+            }
+            ucnv_resetFromUnicode(cnv);
+            source16=text16;
+            target8=dest8;
+            errorCode=U_ZERO_ERROR;
+            ucnv_fromUnicode(cnv, &target8, dest8+UPRV_LENGTHOF(dest8),
+                             &source16, text16+length, offsets, true, &errorCode);
+            if((pos<length ? errorCode!=U_INVALID_CHAR_FOUND : U_FAILURE(errorCode)) ||
+                    (target8-dest8)!=expectedLength ||
+                    (source16-text16)!=(pos<length ? pos+1 : length)) {
+                log_err("windows-1253 fromUnicode(length %d, unmappable at %d) stopped at %d - %s\n",
+                        (int)length, (int)pos, (int)(target8-dest8), u_errorName(errorCode));
+                continue;
+            }
+            for(i=0; i<expectedLength; ++i) {
+                if(dest8[i]!=text8[i] || offsets[i]!=i) {
+                    log_err("windows-1253 fromUnicode(length %d, unmappable at %d) wrong output "
+                            "or offset at %d\n",
+                            (int)length, (int)pos, (int)i);
+                    break;
+                }
+            }
+
+            /* to Unicode; 0xd2 is unassigned */
+            if(pos<length) {
+                text8[pos]=(char)0xd2;
+                text16[pos]=0x100;
+            }
+            ucnv_resetToUnicode(cnv);
+            source8=text8;
+            target16=dest16;
+            errorCode=U_ZERO_ERROR;
+            ucnv_toUnicode(cnv, &target16, dest16+UPRV_LENGTHOF(dest16),
+                           &source8, text8+length, offsets, true, &errorCode);
+            if((pos<length ? errorCode!=U_INVALID_CHAR_FOUND : U_FAILURE(errorCode)) ||
+                    (target16-dest16)!=expectedLength) {
+                log_err("windows-1253 toUnicode(length %d, unassigned at %d) stopped at %d - %s\n",
+                        (int)length, (int)pos, (int)(target16-dest16), u_errorName(errorCode));
+                continue;
+            }
+            for(i=0; i<expectedLength; ++i) {
+                if(dest16[i]!=text16[i] || offsets[i]!=i) {
+                    log_err("windows-1253 toUnicode(length %d, unassigned at %d) wrong output "
+                            "or offset at %d\n",
+                            (int)length, (int)pos, (int)i);
+                    break;
+                }
+            }
+        }
+    }
+    ucnv_close(cnv);
+}
+
 static void
 TestSBCS() {
     /* test input */
@@ -4783,6 +4995,393 @@ TestGB18030() {
     ucnv_close(cnv);
 }
 
+/*
+ * Converts the first and last code points of each GB 18030 four-byte range
+ * together with their neighbors, with the whole text at once,
+ * with small buffers that split four-byte sequences and surrogate pairs,
+ * via UTF-8, and with ucnv_getNextUChar().
+ */
+static void
+TestGB18030Ranges() {
+    /* start & end code points and four-byte sequences of the ranges */
+    static const uint32_t ranges[][4]={
+        { 0x0452, 0x1e3e, 0x8130d330, 0x8135f436 },
+        { 0x1e40, 0x200f, 0x8135f438, 0x8136a531 },
+        { 0x2643, 0x2e80, 0x8137a839, 0x8138fd38 },
+        { 0x361b, 0x3917, 0x8230a633, 0x8230f237 },
+        { 0x3ce1, 0x4055, 0x8231d438, 0x8232af32 },
+        { 0x4160, 0x4336, 0x8232c937, 0x8232f837 },
+        { 0x44d7, 0x464b, 0x8233a339, 0x8233c931 },
+        { 0x478e, 0x4946, 0x8233e838, 0x82349638 },
+        { 0x49b8, 0x4c76, 0x8234a131, 0x8234e733 },
+        { 0x9fa6, 0xd7ff, 0x82358f33, 0x8336c738 },
+        { 0xe865, 0xf92b, 0x8336d030, 0x84308534 },
+        { 0xfa2a, 0xfe2f, 0x84309c38, 0x84318537 },
+        { 0xffe6, 0xffff, 0x8431a234, 0x8431a439 },
+        { 0x10000, 0x10ffff, 0x90308130, 0xe3329a35 }
+    };
+    UChar text[200], text2[200];
+    char gb[300], gb2[300], utf8[400], utf8b[400];
+    int32_t offsets[300];
+    int32_t textLength=0, gbLength=0, utf8Length=0, length;
+    int32_t i, j, chunk;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UConverter *cnv, *utf8Cnv;
+
+    cnv=ucnv_open("gb18030", &errorCode);
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("Unable to open a gb18030 converter: %s\n", u_errorName(errorCode));
+        ucnv_close(cnv);
+        ucnv_close(utf8Cnv);
+        return;
+    }
+
+    /* the range boundaries in both encodings, with a two-byte character between them */
+    for(i=0; i<UPRV_LENGTHOF(ranges); ++i) {
+        for(j=0; j<2; ++j) {
+            uint32_t bytes=ranges[i][2+j];
+            U16_APPEND_UNSAFE(text, textLength, (UChar32)ranges[i][j]);
+            gb[gbLength++]=(char)(bytes>>24);
+            gb[gbLength++]=(char)(bytes>>16);
+            gb[gbLength++]=(char)(bytes>>8);
+            gb[gbLength++]=(char)bytes;
+            text[textLength++]=0x4e00;
+            gb[gbLength++]=(char)0xd2;
+            gb[gbLength++]=(char)0xbb;
+        }
+    }
+
+    length=ucnv_fromUChars(cnv, gb2, UPRV_LENGTHOF(gb2), text, textLength, &errorCode);
+    if(U_FAILURE(errorCode) || length!=gbLength || 0!=uprv_memcmp(gb, gb2, gbLength)) {
+        log_err("gb18030 ucnv_fromUChars(range boundaries) failed: %s\n", u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    length=ucnv_toUChars(cnv, text2, UPRV_LENGTHOF(text2), gb, gbLength, &errorCode);
+    if(U_FAILURE(errorCode) || length!=textLength || 0!=u_memcmp(text, text2, textLength)) {
+        log_err("gb18030 ucnv_toUChars(range boundaries) failed: %s\n", u_errorName(errorCode));
+    }
+
+    /* small target buffers, with offsets */
+    for(chunk=1; chunk<=5; ++chunk) {
+        const UChar *source=text;
+        const char *gbSource=gb;
+        char *target=gb2;
+        UChar *target16=text2;
+        int32_t *pOffsets=offsets;
+
+        ucnv_resetFromUnicode(cnv);
+        errorCode=U_ZERO_ERROR;
+        do {
+            char *limit=target+chunk;
+            if(limit>gb2+UPRV_LENGTHOF(gb2)) {
+                break;
+            }
+            int32_t sourceIndex=(int32_t)(source-text);
+            errorCode=U_ZERO_ERROR;
+            ucnv_fromUnicode(cnv, &target, limit, &source, text+textLength,
+                             pOffsets, true, &errorCode);
+            /* offsets are relative to the source of each call, or -1 for buffered output */
+            for(; pOffsets<offsets+(target-gb2); ++pOffsets) {
+                if(*pOffsets>=0) {
+                    *pOffsets+=sourceIndex;
+                }
+            }
+        } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+        if(U_FAILURE(errorCode) || (target-gb2)!=gbLength || 0!=uprv_memcmp(gb, gb2, gbLength)) {
+            log_err("gb18030 ucnv_fromUnicode(range boundaries, %d-byte buffers) failed: %s\n",
+                    (int)chunk, u_errorName(errorCode));
+        } else {
+            /* each code point's bytes point to its first UChar */
+            for(i=j=0; i<gbLength; i+=(uint8_t)gb[i]==0xd2 ? 2 : 4) {
+                if((offsets[i]!=j && offsets[i]!=-1) || (offsets[i+1]!=j && offsets[i+1]!=-1)) {
+                    log_err("gb18030 ucnv_fromUnicode(%d-byte buffers) offsets[%d]=%d!=%d\n",
+                            (int)chunk, (int)i, (int)offsets[i], (int)j);
+                    break;
+                }
+                j+=U16_IS_LEAD(text[j]) ? 2 : 1;
+            }
+        }
+
+        ucnv_resetToUnicode(cnv);
+        pOffsets=offsets;
+        do {
+            UChar *limit=target16+chunk;
+            if(limit>text2+UPRV_LENGTHOF(text2)) {
+                break;
+            }
+            int32_t sourceIndex=(int32_t)(gbSource-gb);
+            errorCode=U_ZERO_ERROR;
+            ucnv_toUnicode(cnv, &target16, limit, &gbSource, gb+gbLength,
+                           pOffsets, true, &errorCode);
+            for(; pOffsets<offsets+(target16-text2); ++pOffsets) {
+                if(*pOffsets>=0) {
+                    *pOffsets+=sourceIndex;
+                }
+            }
+        } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+        if(U_FAILURE(errorCode) || (target16-text2)!=textLength || 0!=u_memcmp(text, text2, textLength)) {
+            log_err("gb18030 ucnv_toUnicode(range boundaries, %d-UChar buffers) failed: %s\n",
+                    (int)chunk, u_errorName(errorCode));
+        } else {
+            /* each UChar points to the first byte of its sequence */
+            for(i=j=0; i<textLength; ++i) {
+                if(offsets[i]!=j && offsets[i]!=-1) {
+                    log_err("gb18030 ucnv_toUnicode(%d-UChar buffers) offsets[%d]=%d!=%d\n",
+                            (int)chunk, (int)i, (int)offsets[i], (int)j);
+                    break;
+                }
+                if(!U16_IS_LEAD(text[i])) {
+                    j+=(uint8_t)gb[j]==0xd2 ? 2 : 4;
+                }
+            }
+        }
+    }
+
+    /* directly between UTF-8 and GB 18030 */
+    errorCode=U_ZERO_ERROR;
+    u_strToUTF8(utf8, UPRV_LENGTHOF(utf8), &utf8Length, text, textLength, &errorCode);
+    length=ucnv_convert("gb18030", "UTF-8", gb2, UPRV_LENGTHOF(gb2), utf8, utf8Length, &errorCode);
+    if(U_FAILURE(errorCode) || length!=gbLength || 0!=uprv_memcmp(gb, gb2, gbLength)) {
+        log_err("gb18030 from UTF-8(range boundaries) failed: %s\n", u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    length=ucnv_convert("UTF-8", "gb18030", utf8b, UPRV_LENGTHOF(utf8b), gb, gbLength, &errorCode);
+    if(U_FAILURE(errorCode) || length!=utf8Length || 0!=uprv_memcmp(utf8, utf8b, utf8Length)) {
+        log_err("gb18030 to UTF-8(range boundaries) failed: %s\n", u_errorName(errorCode));
+    }
+
+    /* ucnv_getNextUChar() */
+    {
+        const char *source=gb, *sourceLimit=gb+gbLength;
+        ucnv_resetToUnicode(cnv);
+        errorCode=U_ZERO_ERROR;
+        for(i=0; i<textLength && U_SUCCESS(errorCode);) {
+            UChar32 c, expected;
+            U16_NEXT(text, i, textLength, expected);
+            c=ucnv_getNextUChar(cnv, &source, sourceLimit, &errorCode);
+            if(c!=expected) {
+                log_err("gb18030 ucnv_getNextUChar(range boundaries)=U+%04lx!=U+%04lx %s\n",
+                        (long)c, (long)expected, u_errorName(errorCode));
+                break;
+            }
+        }
+    }
+
+    /* the code points just outside the ranges round-trip as well */
+    ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    for(i=0; i<UPRV_LENGTHOF(ranges)-1; ++i) {
+        UChar32 neighbors[2]={ (UChar32)ranges[i][0]-1, (UChar32)ranges[i][1]+1 };
+        for(j=0; j<2; ++j) {
+            UChar32 c=neighbors[j];
+            if(U_IS_SURROGATE(c)) {
+                continue;
+            }
+            textLength=0;
+            U16_APPEND_UNSAFE(text, textLength, c);
+            errorCode=U_ZERO_ERROR;
+            length=ucnv_fromUChars(cnv, gb2, UPRV_LENGTHOF(gb2), text, textLength, &errorCode);
+            length=ucnv_toUChars(cnv, text2, UPRV_LENGTHOF(text2), gb2, length, &errorCode);
+            if(U_FAILURE(errorCode) || length!=textLength || text2[0]!=text[0]) {
+                log_err("gb18030 round trip of U+%04lx next to a range failed: %s\n",
+                        (long)c, u_errorName(errorCode));
+            }
+        }
+    }
+
+    ucnv_close(utf8Cnv);
+    ucnv_close(cnv);
+}
+
+/* converts in chunks of at most chunk units of source and target, with offsets relative to the whole text */
+static int32_t
+fromUnicodeInChunks(UConverter *cnv, const UChar *text, int32_t textLength,
+                    char *bytes, int32_t capacity, int32_t *offsets, int32_t chunk,
+                    UErrorCode *pErrorCode) {
+    const UChar *source=text, *sourceLimit=text+textLength;
+    char *target=bytes;
+    int32_t *pOffsets=offsets;
+    ucnv_resetFromUnicode(cnv);
+    do {
+        const UChar *limit=sourceLimit-source>chunk ? source+chunk : sourceLimit;
+        int32_t sourceIndex=(int32_t)(source-text);
+        if(target+chunk>bytes+capacity) {
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+            break;
+        }
+        *pErrorCode=U_ZERO_ERROR;
+        ucnv_fromUnicode(cnv, &target, target+chunk, &source, limit,
+                         pOffsets, limit==sourceLimit, pErrorCode);
+        for(; pOffsets<offsets+(target-bytes); ++pOffsets) {
+            if(*pOffsets>=0) {
+                *pOffsets+=sourceIndex;
+            }
+        }
+    } while(U_SUCCESS(*pErrorCode) ? source<sourceLimit : *pErrorCode==U_BUFFER_OVERFLOW_ERROR);
+    return (int32_t)(target-bytes);
+}
+
+static int32_t
+toUnicodeInChunks(UConverter *cnv, const char *bytes, int32_t length,
+                  UChar *text, int32_t capacity, int32_t *offsets, int32_t chunk,
+                  UErrorCode *pErrorCode) {
+    const char *source=bytes, *sourceLimit=bytes+length;
+    UChar *target=text;
+    int32_t *pOffsets=offsets;
+    ucnv_resetToUnicode(cnv);
+    do {
+        const char *limit=sourceLimit-source>chunk ? source+chunk : sourceLimit;
+        int32_t sourceIndex=(int32_t)(source-bytes);
+        if(target+chunk>text+capacity) {
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+            break;
+        }
+        *pErrorCode=U_ZERO_ERROR;
+        ucnv_toUnicode(cnv, &target, target+chunk, &source, limit,
+                       pOffsets, limit==sourceLimit, pErrorCode);
+        for(; pOffsets<offsets+(target-text); ++pOffsets) {
+            if(*pOffsets>=0) {
+                *pOffsets+=sourceIndex;
+            }
+        }
+    } while(U_SUCCESS(*pErrorCode) ? source<sourceLimit : *pErrorCode==U_BUFFER_OVERFLOW_ERROR);
+    return (int32_t)(target-text);
+}
+
+/*
+ * Converts text with long ASCII runs in both directions, in one piece and in chunks,
+ * and checks the results against expected bytes and offsets if given,
+ * and otherwise against each other.
+ */
+static void
+checkASCIIRuns(const char *name, const UChar *text, int32_t textLength,
+               const char *expected, const int32_t *expectedOffsets, int32_t expectedLength) {
+    char bytes[1000], bytes2[1000];
+    UChar text2[600];
+    int32_t offsets[1000], offsets2[1000];
+    int32_t length, length2, i, chunk;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UConverter *cnv=ucnv_open(name, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("Unable to open a %s converter: %s\n", name, u_errorName(errorCode));
+        return;
+    }
+
+    length=fromUnicodeInChunks(cnv, text, textLength, bytes, UPRV_LENGTHOF(bytes), offsets,
+                               UPRV_LENGTHOF(bytes), &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("%s fromUnicode(ASCII runs) failed: %s\n", name, u_errorName(errorCode));
+        ucnv_close(cnv);
+        return;
+    }
+    if(expected!=NULL &&
+            (length!=expectedLength || 0!=uprv_memcmp(bytes, expected, length) ||
+             0!=uprv_memcmp(offsets, expectedOffsets, length*4))) {
+        log_err("%s fromUnicode(ASCII runs) wrong bytes or offsets\n", name);
+    }
+    for(chunk=1; chunk<=20; chunk+=chunk<4 ? 1 : 7) {
+        length2=fromUnicodeInChunks(cnv, text, textLength, bytes2, UPRV_LENGTHOF(bytes2), offsets2,
+                                    chunk, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("%s fromUnicode(ASCII runs, %d-unit chunks) failed: %s\n",
+                    name, (int)chunk, u_errorName(errorCode));
+            continue;
+        }
+        if(length2!=length || 0!=uprv_memcmp(bytes, bytes2, length)) {
+            /* SCSU may choose different windows and modes when it sees less of the text */
+            length2=ucnv_toUChars(cnv, text2, UPRV_LENGTHOF(text2), bytes2, length2, &errorCode);
+            if(uprv_strcmp(name, "SCSU")!=0 ||
+                    U_FAILURE(errorCode) || length2!=textLength || 0!=u_memcmp(text, text2, textLength)) {
+                log_err("%s fromUnicode(ASCII runs, %d-unit chunks) wrong bytes: %s\n",
+                        name, (int)chunk, u_errorName(errorCode));
+            }
+            continue;
+        }
+        for(i=0; i<length; ++i) {
+            if(offsets2[i]!=offsets[i] && offsets2[i]!=-1) {
+                log_err("%s fromUnicode(ASCII runs, %d-unit chunks) offsets[%d]=%d!=%d\n",
+                        name, (int)chunk, (int)i, (int)offsets2[i], (int)offsets[i]);
+                break;
+            }
+        }
+    }
+
+    for(chunk=length; chunk>=1; chunk=chunk>20 ? 20 : chunk>4 ? chunk-7 : chunk-1) {
+        length2=toUnicodeInChunks(cnv, bytes, length, text2, UPRV_LENGTHOF(text2), offsets2,
+                                  chunk, &errorCode);
+        if(U_FAILURE(errorCode) || length2!=textLength || 0!=u_memcmp(text, text2, textLength)) {
+            log_err("%s toUnicode(ASCII runs, %d-byte chunks) wrong text: %s\n",
+                    name, (int)chunk, u_errorName(errorCode));
+            continue;
+        }
+        /* an ASCII character comes from the same byte, or has offset -1 if it was buffered */
+        for(i=0; i<textLength; ++i) {
+            if(text[i]<=0x7f && offsets2[i]>=0 && (uint8_t)bytes[offsets2[i]]!=text[i]) {
+                log_err("%s toUnicode(ASCII runs, %d-byte chunks) offsets[%d]=%d\n",
+                        name, (int)chunk, (int)i, (int)offsets2[i]);
+                break;
+            }
+        }
+    }
+    ucnv_close(cnv);
+}
+
+static void
+TestStatefulASCIIRuns() {
+    static const char line[]="The quick brown fox jumps over the lazy dog (0123456789)! ~{~}\r\n";
+    UChar text[600];
+    char expected[700];
+    int32_t expectedOffsets[700];
+    int32_t textLength=0, expectedLength=0, i, j;
+
+    /* ISO-2022-JP: ASCII lines around a JIS X 0208 character, with expected bytes and offsets */
+    for(j=0; j<3; ++j) {
+        for(i=0; line[i]!=0; ++i) {
+            expectedOffsets[expectedLength]=textLength;
+            expected[expectedLength++]=line[i];
+            text[textLength++]=(UChar)(uint8_t)line[i];
+        }
+        if(j<2) {
+            static const char hiragana[]="\x1b$B$\"\x1b(B";
+            for(i=0; hiragana[i]!=0; ++i) {
+                expectedOffsets[expectedLength]= i<5 ? textLength : textLength+1;
+                expected[expectedLength++]=hiragana[i];
+            }
+            text[textLength++]=0x3042;
+        }
+    }
+    checkASCIIRuns("ISO-2022-JP", text, textLength, expected, expectedOffsets, expectedLength);
+
+    /* G2 Latin-1 and Greek designations that CR/LF must reset in the middle of ASCII runs */
+    textLength=0;
+    for(j=0; j<6; ++j) {
+        for(i=0; line[i]!=0; ++i) {
+            text[textLength++]=(UChar)(uint8_t)line[i];
+            if(i==20) {
+                text[textLength++]= j&1 ? 0x3b1 : 0xe9;
+            } else if(i==40 && j>=4) {
+                text[textLength++]=0x4e00;
+            }
+        }
+    }
+    checkASCIIRuns("ISO-2022-JP-2", text, textLength, NULL, NULL, 0);
+    checkASCIIRuns("ISO-2022-CN-EXT", text, textLength, NULL, NULL, 0);
+    checkASCIIRuns("HZ", text, textLength, NULL, NULL, 0);
+    checkASCIIRuns("SCSU", text, textLength, NULL, NULL, 0);
+
+    /* JIS7 shifts half-width Katakana with SO/SI; SCSU quotes most C0 controls */
+    textLength=0;
+    for(j=0; j<4; ++j) {
+        for(i=0; line[i]!=0; ++i) {
+            text[textLength++]=(UChar)(uint8_t)line[i];
+        }
+        text[textLength++]= j&1 ? 0xff71 : 1;
+        text[textLength++]=9;
+    }
+    checkASCIIRuns("ISO_2022,locale=ja,version=3", text, textLength-2, NULL, NULL, 0);
+    checkASCIIRuns("SCSU", text, textLength, NULL, NULL, 0);
+}
+
 static void
 TestLMBCS() {
     /* LMBCS-1 string */
@@ -34,12 +34,14 @@
 
 static void TestSelector(void);
 static void TestUPropsVector(void);
+static void TestSelectorStream(void);
 void addCnvSelTest(TestNode** root);  /* Declaration required to suppress compiler warnings. */
 
 void addCnvSelTest(TestNode** root)
 {
     addTest(root, &TestSelector, "tsconv/ucnvseltst/TestSelector");
     addTest(root, &TestUPropsVector, "tsconv/ucnvseltst/TestUPropsVector");
+    addTest(root, &TestSelectorStream, "tsconv/ucnvseltst/TestSelectorStream");
 }
 
 static const char **gAvailableNames = NULL;
@@ -348,6 +350,35 @@ static void verifyResult(UEnumeration* res, const UBool *resultsManually) {
   uenum_close(res);
 }
 
+/* passes the string to a stream in chunks of chunkLength units */
+static UEnumeration *
+selectForUTF8InChunks(const UConverterSelector *sel, const char *s, int32_t length,
+                      int32_t chunkLength, UErrorCode *status) {
+  UEnumeration *res = NULL;
+  UConverterSelectorStream *stream = ucnvsel_openStream(sel, status);
+  int32_t i;
+  for (i = 0; i < length; i += chunkLength) {
+    ucnvsel_streamUTF8(stream, s + i, length - i < chunkLength ? length - i : chunkLength, status);
+  }
+  res = ucnvsel_selectForStream(stream, status);
+  ucnvsel_closeStream(stream);
+  return res;
+}
+
+static UEnumeration *
+selectForStringInChunks(const UConverterSelector *sel, const UChar *s, int32_t length,
+                        int32_t chunkLength, UErrorCode *status) {
+  UEnumeration *res = NULL;
+  UConverterSelectorStream *stream = ucnvsel_openStream(sel, status);
+  int32_t i;
+  for (i = 0; i < length; i += chunkLength) {
+    ucnvsel_streamString(stream, s + i, length - i < chunkLength ? length - i : chunkLength, status);
+  }
+  res = ucnvsel_selectForStream(stream, status);
+  ucnvsel_closeStream(stream);
+  return res;
+}
+
 static UConverterSelector *
 serializeAndUnserialize(UConverterSelector *sel, char **buffer, UErrorCode *status) {
   char *new_buffer;
@@ -470,6 +501,9 @@ static void TestSelector()
         /* UTF-8 NUL-terminated */
         verifyResult(ucnvsel_selectForUTF8(sel_rt, s, -1, &status), manual_rt);
         verifyResult(ucnvsel_selectForUTF8(sel_fb, s, -1, &status), manual_fb);
+        /* UTF-8 in chunks that split multi-byte sequences */
+        verifyResult(selectForUTF8InChunks(sel_rt, s, length8, 1, &status), manual_rt);
+        verifyResult(selectForUTF8InChunks(sel_fb, s, length8, 3, &status), manual_fb);
 
         u_strFromUTF8(utf16, UPRV_LENGTHOF(utf16), &length16, s, length8, &status);
         if (U_FAILURE(status)) {
@@ -486,6 +520,9 @@ static void TestSelector()
             /* UTF-16 NUL-terminated */
             verifyResult(ucnvsel_selectForString(sel_rt, utf16, -1, &status), manual_rt);
             verifyResult(ucnvsel_selectForString(sel_fb, utf16, -1, &status), manual_fb);
+            /* UTF-16 in chunks that split surrogate pairs */
+            verifyResult(selectForStringInChunks(sel_rt, utf16, length16, 1, &status), manual_rt);
+            verifyResult(selectForStringInChunks(sel_fb, utf16, length16, 3, &status), manual_fb);
           }
         }
 
@@ -539,3 +576,85 @@ static void TestUPropsVector() {
 
     upvec_close(pv);
 }
+
+/* closes both enumerations */
+static void compareSelections(const char *name, UEnumeration *expected, UEnumeration *actual) {
+  UErrorCode status = U_ZERO_ERROR;
+  const char *e, *a;
+  do {
+    e = uenum_next(expected, NULL, &status);
+    a = uenum_next(actual, NULL, &status);
+    if (U_FAILURE(status) || (e == NULL) != (a == NULL) || (e != NULL && uprv_strcmp(e, a) != 0)) {
+      log_err("%s: stream selected %s but whole text %s - %s\n",
+              name, a == NULL ? "(end)" : a, e == NULL ? "(end)" : e, u_errorName(status));
+      break;
+    }
+  } while (e != NULL);
+  uenum_close(expected);
+  uenum_close(actual);
+}
+
+/* The stream must select the same as the whole text, wherever the text is split. */
+static void TestSelectorStream() {
+  static const char *const encodings[] = {
+    "US-ASCII", "ISO-8859-1", "windows-1252", "Shift_JIS", "EUC-KR", "GB18030", "UTF-8"
+  };
+  static const char *const utf8Strings[] = {
+    "abc",
+    "a\xc3\xa9" "b",                   /* U+00E9 */
+    "x\xe4\xbd\xa0\xe5\xa5\xbd",          /* U+4F60 U+597D */
+    "\xf0\x9f\x98\x80z",                /* U+1F600 */
+    "a\xe4\xbd",                         /* truncated at the end */
+    "\xe4\xbd\xe3\x81\x82",              /* truncated, then U+3042 */
+    "\xed\xa0\x80\xc3\xa9",              /* ill-formed surrogate, then U+00E9 */
+    "\xf0\x9f\xc3\xa9\x80\xf4\x90\x80\x80" /* ill-formed sequences */
+  };
+  static const UChar utf16Strings[][6] = {
+    { 0x61, 0xd83d, 0xde00, 0x62, 0 },    /* U+1F600 */
+    { 0x61, 0xe9, 0xd800, 0 },            /* lone lead surrogate at the end */
+    { 0xd800, 0x4f60, 0xdc00, 0x3042, 0 } /* lone surrogates */
+  };
+  UErrorCode status = U_ZERO_ERROR;
+  UConverterSelector *sel = ucnvsel_open(encodings, UPRV_LENGTHOF(encodings), NULL,
+                                         UCNV_ROUNDTRIP_SET, &status);
+  UConverterSelectorStream *stream;
+  int32_t i, split;
+  if (U_FAILURE(status)) {
+    log_data_err("ucnvsel_open() failed - %s\n", u_errorName(status));
+    return;
+  }
+  stream = ucnvsel_openStream(sel, &status);
+  for (i = 0; i < UPRV_LENGTHOF(utf8Strings) && U_SUCCESS(status); ++i) {
+    const char *s = utf8Strings[i];
+    int32_t length = (int32_t)uprv_strlen(s);
+    for (split = 0; split <= length; ++split) {
+      char name[40];
+      sprintf(name, "UTF-8 string %d split at %d", (int)i, (int)split);
+      ucnvsel_resetStream(stream);
+      ucnvsel_streamUTF8(stream, s, split, &status);
+      ucnvsel_streamUTF8(stream, s + split, -1, &status);
+      compareSelections(name, ucnvsel_selectForUTF8(sel, s, length, &status),
+                        ucnvsel_selectForStream(stream, &status));
+    }
+    compareSelections("UTF-8 in single bytes", ucnvsel_selectForUTF8(sel, s, length, &status),
+                      selectForUTF8InChunks(sel, s, length, 1, &status));
+  }
+  for (i = 0; i < UPRV_LENGTHOF(utf16Strings) && U_SUCCESS(status); ++i) {
+    const UChar *s = utf16Strings[i];
+    int32_t length = u_strlen(s);
+    for (split = 0; split <= length; ++split) {
+      char name[40];
+      sprintf(name, "UTF-16 string %d split at %d", (int)i, (int)split);
+      ucnvsel_resetStream(stream);
+      ucnvsel_streamString(stream, s, split, &status);
+      ucnvsel_streamString(stream, s + split, -1, &status);
+      compareSelections(name, ucnvsel_selectForString(sel, s, length, &status),
+                        ucnvsel_selectForStream(stream, &status));
+    }
+  }
+  if (U_FAILURE(status)) {
+    log_err("selecting for a stream failed - %s\n", u_errorName(status));
+  }
+  ucnvsel_closeStream(stream);
+  ucnvsel_close(sel);
+}
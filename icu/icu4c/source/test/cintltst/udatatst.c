@@ -31,6 +31,7 @@
 #include "cintltst.h"
 #include "ubrkimpl.h"
 #include "toolutil.h" /* for uprv_fileExists() */
+#include "pkg_gencmn.h" /* for buildTOCHash() */
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -68,6 +69,8 @@ static void TestUDataGetMemory(void);
 static void TestErrorConditions(void);
 static void TestAppData(void);
 static void TestSwapData(void);
+static void TestUDataPreload(void);
+static void TestTOCHash(void);
 #endif
 static void TestUDataSetAppData(void);
 static void TestICUDataName(void);
@@ -92,6 +95,8 @@ addUDataTest(TestNode** root)
     addTest(root, &TestErrorConditions, "udatatst/TestErrorConditions");
     addTest(root, &TestAppData, "udatatst/TestAppData" );
     addTest(root, &TestSwapData, "udatatst/TestSwapData" );
+    addTest(root, &TestUDataPreload, "udatatst/TestUDataPreload" );
+    addTest(root, &TestTOCHash, "udatatst/TestTOCHash" );
 #endif
     addTest(root, &TestUDataSetAppData, "udatatst/TestUDataSetAppData" );
     addTest(root, &TestICUDataName, "udatatst/TestICUDataName" );
@@ -644,6 +649,164 @@ isAcceptable3(void *context,
 }
 
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
+static void TestUDataPreload() {
+    static const char *const collPatterns[] = { "coll/" };
+    static const char *const rootPatterns[] = { "coll/root.res", "brkitr/*.brk" };
+    static const char *const nonePatterns[] = { "coll", "nosuchtree/", "coll/*.nosuch" };
+    UErrorCode status = U_ZERO_ERROR;
+    int64_t allBytes, collBytes, rootBytes, noneBytes;
+
+    allBytes = udata_preload(NULL, 0, 0, &status);
+    if (U_FAILURE(status) || allBytes <= 0) {
+        log_data_err("udata_preload(all ICU data) failed: %s, %ld bytes\n",
+                     u_errorName(status), (long)allBytes);
+        return;
+    }
+    collBytes = udata_preload(collPatterns, UPRV_LENGTHOF(collPatterns),
+                              UDATA_PRELOAD_HUGE_PAGES, &status);
+    rootBytes = udata_preload(rootPatterns, UPRV_LENGTHOF(rootPatterns), 0, &status);
+    noneBytes = udata_preload(nonePatterns, UPRV_LENGTHOF(nonePatterns), 0, &status);
+    if (U_FAILURE(status)) {
+        log_err("udata_preload() failed: %s\n", u_errorName(status));
+        return;
+    }
+    /* Collation data might not be included. */
+    if (collBytes < 0 || collBytes >= allBytes) {
+        log_err("udata_preload(coll/) touched %ld bytes, all data %ld\n",
+                (long)collBytes, (long)allBytes);
+    }
+    if (rootBytes < 0 || rootBytes > allBytes) {
+        log_err("udata_preload(coll/root.res, brkitr/*.brk) touched %ld bytes\n", (long)rootBytes);
+    }
+    if (noneBytes != 0) {
+        log_err("udata_preload() of no items touched %ld bytes\n", (long)noneBytes);
+    }
+
+    udata_preload(collPatterns, -1, 0, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("udata_preload(count=-1) returned %s instead of U_ILLEGAL_ARGUMENT_ERROR\n",
+                u_errorName(status));
+    }
+}
+
+#define TOC_TEST_ITEM_COUNT 300
+
+/* .dat packages in memory, see makeTOCTestPackage() */
+static uint32_t gTOCTestPackages[3][8192];
+
+/*
+ * Builds a .dat package named "tochash<hashMode>" with TOC_TEST_ITEM_COUNT
+ * minimal items "item000.tst".."item299.tst".
+ * hashMode 0: format version 1.0 without hash table
+ * hashMode 1: format version 1.1 with hash table
+ * hashMode 2: format version 1.1 with an unusable hash table
+ * Returns the start of the items, which are 32 bytes each.
+ */
+static const uint8_t *makeTOCTestPackage(int32_t hashMode, char *pkgName) {
+    static const UDataInfo itemInfo={
+        sizeof(UDataInfo),
+        0,
+        U_IS_BIG_ENDIAN,
+        U_CHARSET_FAMILY,
+        sizeof(UChar),
+        0,
+        {0x54, 0x65, 0x73, 0x74},   /* dataFormat="Test" */
+        {1, 0, 0, 0},               /* formatVersion */
+        {0, 0, 0, 0}                /* dataVersion */
+    };
+    char names[TOC_TEST_ITEM_COUNT][24];
+    const char *namePointers[TOC_TEST_ITEM_COUNT];
+    uint8_t *bytes=(uint8_t *)gTOCTestPackages[hashMode];
+    DataHeader *pHeader=(DataHeader *)bytes;
+    UDataOffsetTOC *toc=(UDataOffsetTOC *)(bytes+32);
+    uint8_t *items;
+    int32_t i, hashLength, offset;
+
+    sprintf(pkgName, "tochash%d", (int)hashMode);
+    uprv_memset(bytes, 0, sizeof(gTOCTestPackages[0]));
+    pHeader->dataHeader.headerSize=32;
+    pHeader->dataHeader.magic1=0xda;
+    pHeader->dataHeader.magic2=0x27;
+    pHeader->info=itemInfo;
+    uprv_memcpy(pHeader->info.dataFormat, "CmnD", 4);
+    pHeader->info.formatVersion[1]=hashMode==0 ? 0 : 1;
+
+    for(i=0; i<TOC_TEST_ITEM_COUNT; ++i) {
+        sprintf(names[i], "%s/item%03d.tst", pkgName, (int)i);
+        namePointers[i]=names[i];
+    }
+    toc->count=TOC_TEST_ITEM_COUNT;
+    offset=4+8*TOC_TEST_ITEM_COUNT;
+    if(hashMode!=0) {
+        uint32_t *hash=(uint32_t *)(toc->entry+TOC_TEST_ITEM_COUNT);
+        if(!buildTOCHash(namePointers, TOC_TEST_ITEM_COUNT, hash)) {
+            log_err("buildTOCHash() failed to find a perfect hash function\n");
+        }
+        if(hashMode==2) {
+            hash[1]=0;  /* bucketCount */
+        }
+        hashLength=getTOCHashLength(TOC_TEST_ITEM_COUNT);
+        offset+=hashLength;
+    }
+    for(i=0; i<TOC_TEST_ITEM_COUNT; ++i) {
+        toc->entry[i].nameOffset=offset;
+        uprv_strcpy((char *)toc+offset, names[i]);
+        offset+=(int32_t)uprv_strlen(names[i])+1;
+    }
+    offset=(offset+15)&~15;
+    items=(uint8_t *)toc+offset;
+    for(i=0; i<TOC_TEST_ITEM_COUNT; ++i) {
+        DataHeader *pItem=(DataHeader *)(items+32*i);
+        toc->entry[i].dataOffset=offset+32*i;
+        pItem->dataHeader.headerSize=32;
+        pItem->dataHeader.magic1=0xda;
+        pItem->dataHeader.magic2=0x27;
+        pItem->info=itemInfo;
+    }
+    return items;
+}
+
+static void TestTOCHash() {
+    int32_t hashMode, i;
+    for(hashMode=0; hashMode<=2; ++hashMode) {
+        char pkgName[16], name[16];
+        const uint8_t *items=makeTOCTestPackage(hashMode, pkgName);
+        UErrorCode status=U_ZERO_ERROR;
+        udata_setAppData(pkgName, gTOCTestPackages[hashMode], &status);
+        if(U_FAILURE(status)) {
+            log_err("udata_setAppData(%s) failed: %s\n", pkgName, u_errorName(status));
+            continue;
+        }
+        for(i=0; i<TOC_TEST_ITEM_COUNT; ++i) {
+            UDataMemory *data;
+            sprintf(name, "item%03d", (int)i);
+            status=U_ZERO_ERROR;
+            data=udata_open(pkgName, "tst", name, &status);
+            if(U_FAILURE(status)) {
+                log_err("udata_open(%s, tst, %s) failed: %s\n", pkgName, name, u_errorName(status));
+                continue;
+            }
+            /* the item's memory follows its 32-byte header */
+            if(udata_getMemory(data)!=(const void *)(items+32*i+32)) {
+                log_err("udata_open(%s, tst, %s) returned the wrong item\n", pkgName, name);
+            }
+            udata_close(data);
+        }
+        /* Item names that are not in the package. */
+        for(i=TOC_TEST_ITEM_COUNT; i<2*TOC_TEST_ITEM_COUNT; ++i) {
+            UDataMemory *data;
+            sprintf(name, i&1 ? "item%03d" : "item%d0", (int)i);
+            status=U_ZERO_ERROR;
+            data=udata_open(pkgName, "tst", name, &status);
+            if(U_SUCCESS(status)) {
+                log_err("udata_open(%s, tst, %s) found an item that is not in the package\n",
+                        pkgName, name);
+                udata_close(data);
+            }
+        }
+    }
+}
+
 static void TestUDataOpenChoiceDemo1() {
     UDataMemory *result;
     UErrorCode status=U_ZERO_ERROR;
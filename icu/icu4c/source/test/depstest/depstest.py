@@ -112,6 +112,10 @@ def _ReadLibrary(root_path, library_name):
   ("common/umutex.o", "__once_proxy"),
   ("common/umutex.o", "__tls_get_addr"),
   ("common/unifiedcache.o", "std::__throw_system_error(int)"),
+  # std::thread allocates its internal state with the global operator new.
+  ("common/ucnv_par.o", "operator new(unsigned long)"),
+  ("common/normalizer2par.o", "operator new(unsigned long)"),
+  ("i18n/uinitcatpool.o", "operator new(unsigned long)"),
 )
 
 def _Resolve(name, parents):
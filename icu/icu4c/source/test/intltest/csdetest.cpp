@@ -113,6 +113,14 @@ void CharsetDetectionTest::runIndexedTest( int32_t index, UBool exec, const char
             if (exec) Ticket21823Test();
             break;
 
+       case 11: name = "DetectThenDetectAllTest";
+            if (exec) DetectThenDetectAllTest();
+            break;
+
+       case 12: name = "AppendTextTest";
+            if (exec) AppendTextTest();
+            break;
+
         default: name = "";
             break; //needed to end loop
     }
@@ -862,3 +870,112 @@ void CharsetDetectionTest::Ticket21823Test() {
 
     ucsdet_close(csd);
 }
+
+// detect() may stop at the first certain match; a following detectAll()
+// on the same text must still return what a fresh detectAll() returns.
+void CharsetDetectionTest::DetectThenDetectAllTest() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString ss = "A mostly ASCII text with a few Greek letters "
+                       "\u0391\u0392\u0393\u0394\u0395\u0396\u0397\u0398\u0399\u039A\u039B"
+                       " so that the UTF-8 recognizer is certain.";
+    UnicodeString s = ss.unescape();
+    int32_t byteLength = 0;
+    std::unique_ptr<char []> bytes(extractBytes(s, "UTF-8", byteLength));
+    LocalUCharsetDetectorPointer csd1(ucsdet_open(&status));
+    LocalUCharsetDetectorPointer csd2(ucsdet_open(&status));
+    TEST_ASSERT_SUCCESS(status);
+
+    ucsdet_setText(csd1.getAlias(), bytes.get(), byteLength, &status);
+    ucsdet_setText(csd2.getAlias(), bytes.get(), byteLength, &status);
+    const UCharsetMatch *match = ucsdet_detect(csd1.getAlias(), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(match != NULL);
+    TEST_ASSERT(strcmp(ucsdet_getName(match, &status), "UTF-8") == 0);
+    TEST_ASSERT(ucsdet_getConfidence(match, &status) == 100);
+
+    int32_t count1 = 0, count2 = 0;
+    const UCharsetMatch **all1 = ucsdet_detectAll(csd1.getAlias(), &count1, &status);
+    const UCharsetMatch **all2 = ucsdet_detectAll(csd2.getAlias(), &count2, &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(count1 > 1 && count1 == count2);
+    if (count1 != count2) {
+        return;
+    }
+    TEST_ASSERT(all1[0] == match);
+    for (int32_t i = 0; i < count1; ++i) {
+        const char *name1 = ucsdet_getName(all1[i], &status);
+        const char *name2 = ucsdet_getName(all2[i], &status);
+        if (strcmp(name1, name2) != 0 ||
+                ucsdet_getConfidence(all1[i], &status) != ucsdet_getConfidence(all2[i], &status)) {
+            errln("detectAll() after detect() differs at match %d: %s vs. %s", (int)i, name1, name2);
+        }
+    }
+    TEST_ASSERT_SUCCESS(status);
+}
+
+// Text appended in chunks must give the same matches as the text so far
+// passed to setText() at once, also when chunks split characters.
+void CharsetDetectionTest::AppendTextTest() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString ss = "<html><p>\u3053\u308C\u306F\u3001\u6587\u5B57\u30B3\u30FC\u30C9\u306E"
+                       "\u691C\u51FA\u306E\u30C6\u30B9\u30C8\u3067\u3059\u3002</p>"
+                       "<p>Some ASCII text in between, \u65E5\u672C\u8A9E\u306E\u6587\u7AE0"
+                       "\u3092\u5C11\u3057\u305A\u3064\u8AAD\u307F\u8FBC\u307F\u307E\u3059"
+                       "\u3002</p></html>";
+    UnicodeString s = ss.unescape();
+    static const char *const encodings[] = {
+        "UTF-8", "UTF-16BE", "UTF-32LE",
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        "Shift_JIS", "EUC-JP", "ISO-2022-JP",
+#endif
+    };
+    LocalUCharsetDetectorPointer stream(ucsdet_open(&status));
+    LocalUCharsetDetectorPointer whole(ucsdet_open(&status));
+    TEST_ASSERT_SUCCESS(status);
+
+    for (int32_t e = 0; e < UPRV_LENGTHOF(encodings); ++e) {
+        int32_t byteLength = 0;
+        std::unique_ptr<char []> bytes(extractBytes(s, encodings[e], byteLength));
+
+        for (int32_t strip = 0; strip < 2; ++strip) {
+            ucsdet_setText(stream.getAlias(), "", 0, &status);
+            ucsdet_enableInputFilter(stream.getAlias(), strip);
+            ucsdet_enableInputFilter(whole.getAlias(), strip);
+
+            for (int32_t length = 0; length < byteLength;) {
+                int32_t chunkLength = 1 + length % 7;
+                if (chunkLength > byteLength - length) {
+                    chunkLength = byteLength - length;
+                }
+                ucsdet_appendText(stream.getAlias(), bytes.get() + length, chunkLength, &status);
+                length += chunkLength;
+                ucsdet_setText(whole.getAlias(), bytes.get(), length, &status);
+
+                int32_t count1 = 0, count2 = 0;
+                const UCharsetMatch **matches1 = ucsdet_detectAll(stream.getAlias(), &count1, &status);
+                const UCharsetMatch **matches2 = ucsdet_detectAll(whole.getAlias(), &count2, &status);
+                if (count1 != count2) {
+                    errln("%s strip=%d: %d matches after appending %d bytes, expected %d",
+                          encodings[e], (int)strip, (int)count1, (int)length, (int)count2);
+                    break;
+                }
+                status = U_ZERO_ERROR;  // U_INVALID_CHAR_FOUND if there are no matches
+                for (int32_t i = 0; i < count1; ++i) {
+                    const char *name1 = ucsdet_getName(matches1[i], &status);
+                    const char *name2 = ucsdet_getName(matches2[i], &status);
+                    if (strcmp(name1, name2) != 0 ||
+                            ucsdet_getConfidence(matches1[i], &status) !=
+                                ucsdet_getConfidence(matches2[i], &status)) {
+                        errln("%s strip=%d: match %d after appending %d bytes is %s, expected %s",
+                              encodings[e], (int)strip, (int)i, (int)length, name1, name2);
+                    }
+                }
+                TEST_ASSERT_SUCCESS(status);
+            }
+
+            const UCharsetMatch *match = ucsdet_detect(stream.getAlias(), &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT(match != NULL && strcmp(ucsdet_getName(match, &status), encodings[e]) == 0);
+        }
+    }
+}
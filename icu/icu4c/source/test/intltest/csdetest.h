@@ -34,6 +34,8 @@ class CharsetDetectionTest: public IntlTest {
     virtual void Ticket6394Test();
     virtual void Ticket6954Test();
     virtual void Ticket21823Test();
+    virtual void DetectThenDetectAllTest();
+    virtual void AppendTextTest();
 
 private:
     void checkEncoding(const UnicodeString &testString,
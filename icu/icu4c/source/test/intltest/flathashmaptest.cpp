@@ -0,0 +1,218 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*
+* File FLATHASHMAPTEST.CPP
+*
+*******************************************************************************
+*/
+#include "cstring.h"
+#include "flathashmap.h"
+#include "intltest.h"
+
+namespace {
+
+struct IntKeyTraits {
+    static inline uint32_t hash(int32_t key) { return (uint32_t)key; }
+    static inline UBool equals(int32_t a, int32_t b) { return a == b; }
+};
+
+// All keys collide, to exercise long probe sequences.
+struct CollidingIntKeyTraits {
+    static inline uint32_t hash(int32_t /*key*/) { return 0x1234; }
+    static inline UBool equals(int32_t a, int32_t b) { return a == b; }
+};
+
+}  // namespace
+
+class FlatHashMapTest : public IntlTest {
+public:
+    FlatHashMapTest() {
+    }
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=0) override;
+    void TestBasic();
+    void TestCharsKeys();
+    void TestGrowAndRemove();
+    void TestCollisions();
+    void TestTombstones();
+    void TestIterate();
+};
+
+void FlatHashMapTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestBasic);
+    TESTCASE_AUTO(TestCharsKeys);
+    TESTCASE_AUTO(TestGrowAndRemove);
+    TESTCASE_AUTO(TestCollisions);
+    TESTCASE_AUTO(TestTombstones);
+    TESTCASE_AUTO(TestIterate);
+    TESTCASE_AUTO_END;
+}
+
+void FlatHashMapTest::TestBasic() {
+    IcuTestErrorCode errorCode(*this, "TestBasic");
+    FlatHashMap<int32_t, int32_t, IntKeyTraits> map;
+    assertEquals("empty count", 0, map.count());
+    assertTrue("empty find", map.find(5) == nullptr);
+    assertEquals("empty get", 0, map.get(5));
+    assertFalse("empty remove", map.remove(5));
+    assertEquals("empty nextPosition", -1, map.nextPosition(-1));
+
+    map.put(5, 50, errorCode);
+    map.put(-7, 70, errorCode);
+    errorCode.assertSuccess();
+    assertEquals("count", 2, map.count());
+    assertEquals("get 5", 50, map.get(5));
+    assertEquals("get -7", 70, map.get(-7));
+    assertTrue("containsKey", map.containsKey(-7));
+    assertFalse("!containsKey", map.containsKey(7));
+
+    map.put(5, 55, errorCode);
+    assertEquals("count after replace", 2, map.count());
+    assertEquals("get 5 after replace", 55, map.get(5));
+    *map.find(5) = 56;
+    assertEquals("get 5 after find()=", 56, map.get(5));
+
+    assertTrue("remove 5", map.remove(5));
+    assertFalse("remove 5 again", map.remove(5));
+    assertEquals("count after remove", 1, map.count());
+    assertTrue("find 5 after remove", map.find(5) == nullptr);
+
+    map.removeAll();
+    assertEquals("count after removeAll", 0, map.count());
+    assertFalse("containsKey after removeAll", map.containsKey(-7));
+
+    // A failure on input leaves the map unchanged.
+    UErrorCode failure = U_ILLEGAL_ARGUMENT_ERROR;
+    map.put(1, 1, failure);
+    assertEquals("put with failure", 0, map.count());
+}
+
+void FlatHashMapTest::TestCharsKeys() {
+    IcuTestErrorCode errorCode(*this, "TestCharsKeys");
+    FlatHashMap<const char *, int32_t, CharsKeyTraits> map;
+    char key[8];
+    uprv_strcpy(key, "ibm-943");
+    map.put("ibm-943", 943, errorCode);
+    map.put("utf-8", 8, errorCode);
+    map.put("", 0, errorCode);
+    errorCode.assertSuccess();
+    // Keys compare by content, not by pointer.
+    assertEquals("get copy", 943, map.get(key));
+    assertTrue("empty string key", map.find("") != nullptr);
+    key[6] = '4';
+    assertTrue("different key", map.find(key) == nullptr);
+}
+
+void FlatHashMapTest::TestGrowAndRemove() {
+    IcuTestErrorCode errorCode(*this, "TestGrowAndRemove");
+    FlatHashMap<int32_t, int32_t, IntKeyTraits> map;
+    map.reserve(100, errorCode);
+    for (int32_t i = 0; i < 5000; ++i) {
+        map.put(i * 7, i, errorCode);
+    }
+    errorCode.assertSuccess();
+    assertEquals("count", 5000, map.count());
+    for (int32_t i = 0; i < 5000; i += 2) {
+        map.remove(i * 7);
+    }
+    assertEquals("count after removing half", 2500, map.count());
+    for (int32_t i = 0; i < 5000; ++i) {
+        const int32_t *value = map.find(i * 7);
+        if ((i & 1) == 0) {
+            if (value != nullptr) {
+                errln("key %d found after removal", (int)(i * 7));
+                return;
+            }
+        } else if (value == nullptr || *value != i) {
+            errln("key %d not found or wrong value", (int)(i * 7));
+            return;
+        }
+        if (map.find(i * 7 + 1) != nullptr) {
+            errln("key %d found but never added", (int)(i * 7 + 1));
+            return;
+        }
+    }
+}
+
+void FlatHashMapTest::TestCollisions() {
+    IcuTestErrorCode errorCode(*this, "TestCollisions");
+    FlatHashMap<int32_t, int32_t, CollidingIntKeyTraits> map;
+    for (int32_t i = 0; i < 300; ++i) {
+        map.put(i, -i, errorCode);
+    }
+    errorCode.assertSuccess();
+    for (int32_t i = 0; i < 300; ++i) {
+        if (map.get(i) != -i) {
+            errln("colliding key %d has a wrong value", (int)i);
+            return;
+        }
+    }
+    assertTrue("missing colliding key", map.find(300) == nullptr);
+    for (int32_t i = 0; i < 300; i += 3) {
+        map.remove(i);
+    }
+    assertEquals("count after removals", 200, map.count());
+    assertTrue("removed colliding key", map.find(3) == nullptr);
+    assertEquals("colliding key after removals", -299, map.get(299));
+}
+
+void FlatHashMapTest::TestTombstones() {
+    // Keep the number of entries small while adding and removing many keys.
+    // Lookups of missing keys must still terminate when no slot stays empty
+    // for long, and the map must not grow without bound.
+    IcuTestErrorCode errorCode(*this, "TestTombstones");
+    FlatHashMap<int32_t, int32_t, IntKeyTraits> map;
+    for (int32_t i = 0; i < 100000; ++i) {
+        map.put(i, i, errorCode);
+        if (i >= 10) {
+            map.remove(i - 10);
+        }
+        if (map.find(-1) != nullptr) {
+            errln("found a key that was never added");
+            return;
+        }
+    }
+    errorCode.assertSuccess();
+    assertEquals("count", 10, map.count());
+    for (int32_t i = 100000 - 10; i < 100000; ++i) {
+        assertEquals("remaining key", i, map.get(i));
+    }
+}
+
+void FlatHashMapTest::TestIterate() {
+    IcuTestErrorCode errorCode(*this, "TestIterate");
+    FlatHashMap<int32_t, int32_t, IntKeyTraits> map;
+    int32_t expectedSum = 0;
+    for (int32_t i = 1; i <= 100; ++i) {
+        map.put(i, i * 10, errorCode);
+        expectedSum += i;
+    }
+    int32_t keySum = 0, valueSum = 0, n = 0;
+    for (int32_t pos = map.nextPosition(-1); pos >= 0; pos = map.nextPosition(pos)) {
+        keySum += map.keyAt(pos);
+        valueSum += map.valueAt(pos);
+        ++n;
+    }
+    assertEquals("number of entries", 100, n);
+    assertEquals("sum of keys", expectedSum, keySum);
+    assertEquals("sum of values", expectedSum * 10, valueSum);
+
+    // Removing during iteration does not skip or repeat entries.
+    n = 0;
+    for (int32_t pos = map.nextPosition(-1); pos >= 0; pos = map.nextPosition(pos)) {
+        if ((map.keyAt(pos) & 1) != 0) {
+            map.removeAt(pos);
+        }
+        ++n;
+    }
+    assertEquals("entries visited while removing", 100, n);
+    assertEquals("count after removing odd keys", 50, map.count());
+    assertTrue("odd key removed", map.find(51) == nullptr);
+    assertEquals("even key kept", 520, map.get(52));
+}
+
+extern IntlTest *createFlatHashMapTest() {
+    return new FlatHashMapTest();
+}
@@ -46,6 +46,7 @@ extern IntlTest *createSimpleFormatterTest();
 extern IntlTest *createUnifiedCacheTest();
 extern IntlTest *createQuantityFormatterTest();
 extern IntlTest *createPluralMapTest();
+extern IntlTest *createFlatHashMapTest();
 #if !UCONFIG_NO_FORMATTING
 extern IntlTest *createStaticUnicodeSetsTest();
 #endif
@@ -81,6 +82,7 @@ void IntlTestUtilities::runIndexedTest( int32_t index, UBool exec, const char* &
     TESTCASE_AUTO_CREATE_CLASS(UnifiedCacheTest);
     TESTCASE_AUTO_CREATE_CLASS(QuantityFormatterTest);
     TESTCASE_AUTO_CREATE_CLASS(PluralMapTest);
+    TESTCASE_AUTO_CREATE_CLASS(FlatHashMapTest);
 #if !UCONFIG_NO_FORMATTING
     TESTCASE_AUTO_CREATE_CLASS(StaticUnicodeSetsTest);
 #endif
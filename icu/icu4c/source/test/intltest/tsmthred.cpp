@@ -23,8 +23,11 @@
 #include "putilimp.h"
 #include "intltest.h"
 #include "tsmthred.h"
+#include "unicode/normalizer2.h"
 #include "unicode/ushape.h"
 #include "unicode/translit.h"
+#include "unicode/uinitcat.h"
+#include "unicode/ucnvpool.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
 #include "uassert.h"
@@ -79,6 +82,10 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+    TESTCASE_AUTO(TestInitCategories);
+#if !UCONFIG_NO_CONVERSION
+    TESTCASE_AUTO(TestConverterPool);
+#endif
     TESTCASE_AUTO_END;
 }
 
@@ -1085,6 +1092,11 @@ U_NAMESPACE_BEGIN
 static std::mutex *gCTMutex = nullptr;
 static std::condition_variable *gCTConditionVar = nullptr;
 
+template<> U_EXPORT
+const char *CacheKey<UCTMultiThreadItem>::typeName() const {
+    return "UCTMultiThreadItem";
+}
+
 template<> U_EXPORT
 const UCTMultiThreadItem *LocaleCacheKey<UCTMultiThreadItem>::createObject(
         const void *context, UErrorCode &status) const {
@@ -1367,3 +1379,131 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+
+// Several threads initialize all categories of singletons while others
+// use the same services, the way a server would warm up ICU in its thread pool.
+
+class InitCategoriesThread : public SimpleThread {
+public:
+    InitCategoriesThread() : fErrorCode(U_ZERO_ERROR) {}
+    virtual void run() override;
+    UErrorCode fErrorCode;
+};
+
+void InitCategoriesThread::run() {
+    u_initCategories(U_INIT_ALL_CATEGORIES, &fErrorCode);
+}
+
+class InitCategoriesUserThread : public SimpleThread {
+public:
+    InitCategoriesUserThread() : fErrorCode(U_ZERO_ERROR) {}
+    virtual void run() override;
+    UErrorCode fErrorCode;
+};
+
+void InitCategoriesUserThread::run() {
+    const Normalizer2 *nfkc = Normalizer2::getNFKCInstance(fErrorCode);
+    if (U_SUCCESS(fErrorCode)) {
+        nfkc->normalize(u"\uFB01", fErrorCode);
+    }
+    char maximized[ULOC_FULLNAME_CAPACITY];
+    uloc_addLikelySubtags("sr", maximized, UPRV_LENGTHOF(maximized), &fErrorCode);
+#if !UCONFIG_NO_COLLATION
+    LocalPointer<Collator> coll(Collator::createInstance(Locale::getRoot(), fErrorCode));
+#endif
+}
+
+void MultithreadTest::TestInitCategories() {
+    static constexpr int NUM_THREADS = 4;
+    InitCategoriesThread threads[NUM_THREADS];
+    InitCategoriesUserThread users[NUM_THREADS];
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads[i].start();
+        users[i].start();
+    }
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads[i].join();
+        users[i].join();
+        if (U_FAILURE(threads[i].fErrorCode) || U_FAILURE(users[i].fErrorCode)) {
+            dataerrln("u_initCategories() or service use failed - %s, %s",
+                      u_errorName(threads[i].fErrorCode), u_errorName(users[i].fErrorCode));
+            return;
+        }
+    }
+    for (int32_t category = 0; category < U_INIT_CATEGORY_COUNT; ++category) {
+        int64_t nanos = u_getCategoryInitTime((UInitCategory)category);
+        assertTrue(WHERE, nanos >= 0);
+        logln("category %d initialized in %ld ns", (int)category, (long)nanos);
+    }
+}
+
+
+#if !UCONFIG_NO_CONVERSION
+
+// Threads acquire converters from one pool, convert with them and release them.
+// Each thread first releases a converter that the main thread acquired,
+// which tests returning converters across threads.
+
+class ConverterPoolThread : public SimpleThread {
+public:
+    ConverterPoolThread(UConverterPool *pool, UConverter *handoff)
+            : fPool(pool), fHandoff(handoff), fErrorCode(U_ZERO_ERROR), fMismatches(0) {}
+    virtual void run() override;
+    UConverterPool *fPool;
+    UConverter *fHandoff;
+    UErrorCode fErrorCode;
+    int32_t fMismatches;
+};
+
+void ConverterPoolThread::run() {
+    static const char *const names[] = { "Shift_JIS", "UTF-8", "ISO-8859-1", "GB18030" };
+    static const UChar text[] = u"abc\u00d7xyz\u00f7";
+    ucnvpool_release(fPool, fHandoff);
+    for (int32_t i = 0; i < 400 && U_SUCCESS(fErrorCode); ++i) {
+        UConverter *cnv = ucnvpool_acquire(fPool, names[i % UPRV_LENGTHOF(names)], &fErrorCode);
+        if (U_FAILURE(fErrorCode)) {
+            break;
+        }
+        char bytes[40];
+        UChar back[20];
+        int32_t length = ucnv_fromUChars(cnv, bytes, UPRV_LENGTHOF(bytes), text, -1, &fErrorCode);
+        length = ucnv_toUChars(cnv, back, UPRV_LENGTHOF(back), bytes, length, &fErrorCode);
+        if (U_SUCCESS(fErrorCode) && u_strcmp(back, text) != 0) {
+            ++fMismatches;
+        }
+        // Leave settings for the pool to reset.
+        ucnv_setFromUCallBack(cnv, UCNV_FROM_U_CALLBACK_STOP, nullptr, nullptr, nullptr, &fErrorCode);
+        ucnv_setFallback(cnv, true);
+        ucnvpool_release(fPool, cnv);
+    }
+}
+
+void MultithreadTest::TestConverterPool() {
+    static constexpr int NUM_THREADS = 8;
+    IcuTestErrorCode errorCode(*this, "TestConverterPool");
+    LocalUConverterPoolPointer pool(ucnvpool_open(errorCode));
+    if (errorCode.errIfFailureAndReset("ucnvpool_open()")) {
+        return;
+    }
+    LocalPointer<ConverterPoolThread> threads[NUM_THREADS];
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        UConverter *handoff = ucnvpool_acquire(pool.getAlias(), "Shift_JIS", errorCode);
+        if (errorCode.errDataIfFailureAndReset("ucnvpool_acquire(Shift_JIS)")) {
+            return;
+        }
+        threads[i].adoptInstead(new ConverterPoolThread(pool.getAlias(), handoff));
+    }
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->start();
+    }
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+        if (U_FAILURE(threads[i]->fErrorCode)) {
+            dataerrln("converter pool thread %d failed - %s", i, u_errorName(threads[i]->fErrorCode));
+        }
+        assertEquals(WHERE, 0, threads[i]->fMismatches);
+    }
+}
+
+#endif  // !UCONFIG_NO_CONVERSION
@@ -49,6 +49,8 @@ class MultithreadTest : public IntlTest
     void TestBreakTranslit();
     void TestIncDec();
     void Test20104();
+    void TestInitCategories();
+    void TestConverterPool();
 };
 
 #endif
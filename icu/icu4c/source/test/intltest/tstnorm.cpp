@@ -25,6 +25,12 @@
 #include "testutil.h"
 #include "tstnorm.h"
 
+#if NORM2_HARDCODE_NFC_DATA
+// For comparing the precomputed CanonicalIterator data with runtime-built data.
+#define INCLUDED_FROM_NORMALIZER2_CPP
+#include "norm2_nfc_data.h"
+#endif
+
 #define ARRAY_LENGTH(array) UPRV_LENGTHOF(array)
 
 void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
@@ -62,6 +68,10 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestNormalizeIllFormedText);
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
+    TESTCASE_AUTO(TestSkipBelowMinimum);
+    TESTCASE_AUTO(TestNormalizeParallel);
+    TESTCASE_AUTO(TestStreamingNormalizer);
+    TESTCASE_AUTO(TestCanonIterData);
     TESTCASE_AUTO_END;
 }
 
@@ -1873,4 +1883,276 @@ BasicNormalizerTest::TestComposeBoundaryAfter() {
     assertFalse("U+FB2C boundary-after", nfkc->hasBoundaryAfter(0xFB2C));
 }
 
+void
+BasicNormalizerTest::TestSkipBelowMinimum() {
+    IcuTestErrorCode errorCode(*this, "TestSkipBelowMinimum");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc = Normalizer2::getNFKCInstance(errorCode);
+    const Normalizer2 *fcd = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getInstance() call failed")) {
+        return;
+    }
+    // Runs of 16 or more code units below the minimum code point that needs
+    // normalization are skipped a block at a time.
+    // Each of these strings needs normalization, and starts with a character
+    // that is below the minimum for some normalizers, so that the skipped run
+    // includes it and it interacts with what follows.
+    static const char16_t *const specials[] = {
+        u"A\u0308",  // composes with the last character of the run
+        u"\u00C0\u0323",  // the trailing ccc of U+00C0 is 230: not FCD
+        u"\u00C4",
+        u"\u1E0A\u0323",
+        u"\uAC00\u11A8",
+        u"\uFB01"
+    };
+    // Normalization-inert ASCII, longer than three blocks.
+    const UnicodeString filler(u"The quick brown fox jumps over the lazy dog. 0123456789");
+    const Normalizer2 *norm2s[] = { nfc, nfd, nfkc, fcd };
+    const char *names[] = { "NFC", "NFD", "NFKC", "FCD" };
+    for(int32_t n = 0; n < UPRV_LENGTHOF(norm2s); ++n) {
+        const Normalizer2 *norm2 = norm2s[n];
+        for(const char16_t *special : specials) {
+            // Too short for skipping.
+            UnicodeString normalizedSpecial = norm2->normalize(special, errorCode);
+            for(int32_t offset = 0; offset <= 40; ++offset) {
+                for(int32_t suffixLength : { 0, filler.length() }) {
+                    UnicodeString prefix(filler, 0, offset);
+                    UnicodeString suffix(filler, 0, suffixLength);
+                    UnicodeString s = prefix + special + suffix;
+                    UnicodeString expected = prefix + normalizedSpecial + suffix;
+                    char message[64];
+                    snprintf(message, sizeof(message), "%s offset %d%s", names[n], (int)offset,
+                             suffixLength == 0 ? " at end" : "");
+                    assertEquals(message, expected, norm2->normalize(s, errorCode));
+                    assertEquals(message, (UBool)(s == expected), norm2->isNormalized(s, errorCode));
+                    assertTrue(message, norm2->isNormalized(expected, errorCode));
+
+                    std::string s8, expected8, result8;
+                    s.toUTF8String(s8);
+                    expected.toUTF8String(expected8);
+                    StringByteSink<std::string> sink(&result8);
+                    norm2->normalizeUTF8(0, s8, sink, nullptr, errorCode);
+                    assertEquals(message, expected8.c_str(), result8.c_str());
+                    assertEquals(message, (UBool)(s == expected), norm2->isNormalizedUTF8(s8, errorCode));
+                    assertSuccess(message, errorCode.get());
+                }
+            }
+        }
+    }
+}
+
+void
+BasicNormalizerTest::TestNormalizeParallel() {
+    IcuTestErrorCode errorCode(*this, "TestNormalizeParallel");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFKCCasefoldInstance() call failed")) {
+        return;
+    }
+    // Long enough to be split into several pieces,
+    // with text that interacts across most code point boundaries.
+    UnicodeString s(u"  AÄA\u0308A\u0308\u00ad\u0323Ä\u0323,\u00ad\u1100\u1161가\u11A8가\u3133  "
+                    u"\u1E0A\u0323\u0307\U0001D15E\U0001D165\u0F73\u0F71x");
+    // Unpaired surrogates.
+    s.append((UChar)0xd800).append(u'x').append((UChar)0xdc00);
+    while(s.length() < 0x50000) {
+        s.append(s);
+    }
+    std::string s8;
+    s.toUTF8String(s8);
+    // An ill-formed sequence in the middle.
+    s8[s8.length() / 2] = (char)0xe3;
+
+    const Normalizer2 *norm2s[] = { nfc, nfd, nfkc_cf };
+    for(const Normalizer2 *norm2 : norm2s) {
+        UnicodeString expected = norm2->normalize(s, errorCode);
+        UnicodeString result;
+        norm2->normalizeParallel(s, result, 4, errorCode);
+        assertSuccess("normalizeParallel", errorCode.get());
+        assertTrue("normalizeParallel == normalize", expected == result);
+
+        std::string expected8, result8;
+        StringByteSink<std::string> expectedSink(&expected8), resultSink(&result8);
+        Edits expectedEdits, edits;
+        norm2->normalizeUTF8(0, s8, expectedSink, &expectedEdits, errorCode);
+        norm2->normalizeUTF8Parallel(0, s8, resultSink, &edits, 4, errorCode);
+        assertSuccess("normalizeUTF8Parallel", errorCode.get());
+        assertTrue("normalizeUTF8Parallel == normalizeUTF8", expected8 == result8);
+        checkSameEdits("normalizeUTF8Parallel", expectedEdits, edits);
+    }
+
+    UnicodeString result;
+    nfc->normalizeParallel(s, result, 0, errorCode);
+    assertEquals("normalizeParallel(threadCount=0)",
+                 U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    nfc->normalizeParallel(result, result, 2, errorCode);
+    assertEquals("normalizeParallel(src=dest)",
+                 U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+/** Keeps the appended bytes until Flush(). */
+class BufferingByteSink : public ByteSink {
+public:
+    virtual void Append(const char *bytes, int32_t n) override { buffer.append(bytes, n); }
+    virtual void Flush() override {
+        flushed.append(buffer);
+        buffer.clear();
+        ++flushCount;
+    }
+
+    std::string buffer;
+    std::string flushed;
+    int32_t flushCount = 0;
+};
+
+void
+BasicNormalizerTest::TestStreamingNormalizer() {
+    IcuTestErrorCode errorCode(*this, "TestStreamingNormalizer");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfkd = Normalizer2::getNFKDInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFKCCasefoldInstance() call failed")) {
+        return;
+    }
+    UnicodeString s(u"  AÄA\u0308A\u0308\u00ad\u0323Ä\u0323,\u00ad\u1100\u1161가\u11A8가\u3133  "
+                    u"\u1E0A\u0323\u0307\U0001D15E\U0001D165\u0F73\u0F71x");
+    s.append((UChar)0xd800).append(u'x').append((UChar)0xdc00).append(u"\U0001D15E\U0001D165");
+    std::string s8;
+    s.toUTF8String(s8);
+    // A truncated sequence in the middle.
+    s8.insert(s8.length() / 2, "\xf0\x9d");
+
+    const Normalizer2 *norm2s[] = { nfc, nfkd, nfkc_cf };
+    for(const Normalizer2 *norm2 : norm2s) {
+        UnicodeString expected = norm2->normalize(s, errorCode);
+        std::string expected8;
+        StringByteSink<std::string> expectedSink(&expected8);
+        Edits expectedEdits;
+        norm2->normalizeUTF8(0, s8, expectedSink, &expectedEdits, errorCode);
+        StreamingNormalizer2 stream(*norm2);
+        // Chunk boundaries fall into surrogate pairs, UTF-8 sequences,
+        // and between characters that interact.
+        for(int32_t chunkLength = 1; chunkLength <= 7; ++chunkLength) {
+            UnicodeString result;
+            for(int32_t i = 0; i < s.length(); i += chunkLength) {
+                stream.normalizeChunk(s.tempSubString(i, chunkLength), result, errorCode);
+            }
+            stream.finish(result, errorCode);
+            assertSuccess("streaming normalize", errorCode.get());
+            assertTrue("streaming normalize == normalize", expected == result);
+
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            Edits edits;
+            StringPiece sp(s8);
+            for(int32_t i = 0; i < sp.length(); i += chunkLength) {
+                stream.normalizeUTF8Chunk(0, sp.substr(i, chunkLength), sink, &edits, errorCode);
+            }
+            stream.finishUTF8(0, sink, &edits, errorCode);
+            assertSuccess("streaming normalizeUTF8", errorCode.get());
+            assertTrue("streaming normalizeUTF8 == normalizeUTF8", expected8 == result8);
+            checkSameEdits("streaming normalizeUTF8", expectedEdits, edits);
+        }
+    }
+
+    // One stream cannot mix UTF-16 and UTF-8 chunks.
+    StreamingNormalizer2 stream(*nfc);
+    UnicodeString result;
+    stream.normalizeChunk(UnicodeString(u"a\u0308"), result, errorCode);
+    std::string result8;
+    StringByteSink<std::string> sink(&result8);
+    stream.normalizeUTF8Chunk(0, "a", sink, nullptr, errorCode);
+    assertEquals("normalizeUTF8Chunk() after normalizeChunk()",
+                 U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    stream.reset();
+    stream.normalizeUTF8Chunk(0, "a", sink, nullptr, errorCode);
+    stream.finishUTF8(0, sink, nullptr, errorCode);
+    assertSuccess("normalizeUTF8Chunk() after reset()", errorCode.get());
+    assertEquals("normalizeUTF8Chunk() after reset()", "a", result8.c_str());
+
+    // Every chunk flushes the sink, also one without a boundary
+    // where all of the text is held back.
+    BufferingByteSink buffering;
+    stream.normalizeUTF8Chunk(0, "ab", buffering, nullptr, errorCode);
+    assertTrue("chunk with boundaries: all flushed", buffering.buffer.empty());
+    assertEquals("chunk with boundaries: flushed", "a", buffering.flushed.c_str());
+    int32_t flushCount = buffering.flushCount;
+    stream.normalizeUTF8Chunk(0, u8"\u0308\u0323", buffering, nullptr, errorCode);
+    assertTrue("chunk without boundary: flushed", buffering.flushCount > flushCount);
+    assertEquals("chunk without boundary: held back", "a", buffering.flushed.c_str());
+    stream.normalizeUTF8Chunk(0, "c", buffering, nullptr, errorCode);
+    assertTrue("chunk after held-back text: all flushed", buffering.buffer.empty());
+    stream.finishUTF8(0, buffering, nullptr, errorCode);
+    assertSuccess("BufferingByteSink", errorCode.get());
+    assertTrue("BufferingByteSink: all flushed", buffering.buffer.empty());
+    assertEquals("BufferingByteSink: flushed", u8"a\u1E05\u0308c", buffering.flushed.c_str());
+}
+
+void
+BasicNormalizerTest::checkSameEdits(const char *message, const Edits &expected, const Edits &actual) {
+    IcuTestErrorCode errorCode(*this, "checkSameEdits");
+    assertEquals(UnicodeString(message) + u" numberOfChanges",
+                 expected.numberOfChanges(), actual.numberOfChanges());
+    Edits::Iterator expectedIter = expected.getFineIterator();
+    Edits::Iterator iter = actual.getFineIterator();
+    UBool hasNext;
+    do {
+        UBool expectedHasNext = expectedIter.next(errorCode);
+        hasNext = iter.next(errorCode);
+        if(expectedHasNext != hasNext ||
+                (hasNext && (expectedIter.hasChange() != iter.hasChange() ||
+                             expectedIter.oldLength() != iter.oldLength() ||
+                             expectedIter.newLength() != iter.newLength()))) {
+            errln("%s: edits differ from normalizeUTF8() edits at source index %d",
+                  message, (int)expectedIter.sourceIndex());
+            break;
+        }
+    } while(hasNext);
+}
+
+void
+BasicNormalizerTest::TestCanonIterData() {
+#if NORM2_HARDCODE_NFC_DATA
+    // The hardcoded NFC data includes CanonicalIterator data precomputed by gennorm2.
+    // It must work the same as the data that Normalizer2Impl builds at runtime.
+    IcuTestErrorCode errorCode(*this, "TestCanonIterData");
+    const Normalizer2Impl *nfcImpl = Normalizer2Factory::getNFCImpl(errorCode);
+    if (errorCode.errDataIfFailureAndReset("Normalizer2Factory::getNFCImpl()")) {
+        return;
+    }
+    Normalizer2Impl runtimeImpl;
+    runtimeImpl.init(norm2_nfc_data_indexes, &norm2_nfc_data_trie,
+                     norm2_nfc_data_extraData, norm2_nfc_data_smallFCD, nullptr, nullptr);
+    nfcImpl->ensureCanonIterData(errorCode);
+    runtimeImpl.ensureCanonIterData(errorCode);
+    if (errorCode.errIfFailureAndReset("ensureCanonIterData()")) {
+        return;
+    }
+    UnicodeSet expected, actual;
+    for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+        if (nfcImpl->isCanonSegmentStarter(c) != runtimeImpl.isCanonSegmentStarter(c)) {
+            errln("isCanonSegmentStarter(U+%04lX) differs from the runtime-built data", (long)c);
+            return;
+        }
+        expected.clear();
+        actual.clear();
+        UBool hasExpected = runtimeImpl.getCanonStartSet(c, expected);
+        UBool hasActual = nfcImpl->getCanonStartSet(c, actual);
+        if (hasActual != hasExpected || actual != expected) {
+            errln("getCanonStartSet(U+%04lX) differs from the runtime-built data", (long)c);
+            return;
+        }
+    }
+    // Spot-check: U+00C5 and U+01FA have 2-way mappings starting with A+ring,
+    // and U+212B has a one-way mapping to U+00C5.
+    if (!nfcImpl->getCanonStartSet(0x41, actual) ||
+            !actual.contains(0xc5) || !actual.contains(0x1fa) || !actual.contains(0x212b) ||
+            nfcImpl->isCanonSegmentStarter(0x30a)) {
+        errln("unexpected CanonicalIterator data for U+0041 or U+030A");
+    }
+#endif
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -54,6 +54,10 @@ class BasicNormalizerTest : public IntlTest {
     void TestNormalizeIllFormedText();
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
+    void TestSkipBelowMinimum();
+    void TestNormalizeParallel();
+    void TestStreamingNormalizer();
+    void TestCanonIterData();
 
 private:
     UnicodeString canonTests[24][3];
@@ -76,6 +80,8 @@ class BasicNormalizerTest : public IntlTest {
     //
     void backAndForth(Normalizer* iter, const UnicodeString& input);
 
+    void checkSameEdits(const char *message, const Edits &expected, const Edits &actual);
+
     void staticTest(UNormalizationMode mode, int options,
                     UnicodeString tests[][3], int length, int outCol);
 
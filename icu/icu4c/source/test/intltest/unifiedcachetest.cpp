@@ -14,6 +14,12 @@
 #include "intltest.h"
 #include "unifiedcache.h"
 #include "unicode/datefmt.h"
+#include "unicode/dcfmtsym.h"
+#include "unicode/numfmt.h"
+#include "unicode/plurrule.h"
+#include "unicode/ucache.h"
+#include "sharednumberformat.h"
+#include "sharedpluralrules.h"
 
 class UCTItem : public SharedObject {
   public:
@@ -29,8 +35,22 @@ class UCTItem : public SharedObject {
 class UCTItem2 : public SharedObject {
 };
 
+static int32_t gSizedItemsCreated = 0;
+
+class UCTSizedItem : public SharedObject {
+  public:
+    virtual int32_t getMemoryUsage() const override {
+        return 100;
+    }
+};
+
 U_NAMESPACE_BEGIN
 
+template<> U_EXPORT
+const char *CacheKey<UCTItem>::typeName() const {
+    return "UCTItem";
+}
+
 template<> U_EXPORT
 const UCTItem *LocaleCacheKey<UCTItem>::createObject(
         const void *context, UErrorCode &status) const {
@@ -56,12 +76,31 @@ const UCTItem *LocaleCacheKey<UCTItem>::createObject(
     return result;
 }
 
+template<> U_EXPORT
+const char *CacheKey<UCTItem2>::typeName() const {
+    return "UCTItem2";
+}
+
 template<> U_EXPORT
 const UCTItem2 *LocaleCacheKey<UCTItem2>::createObject(
         const void * /*unused*/, UErrorCode & /*status*/) const {
     return NULL;
 }
 
+template<> U_EXPORT
+const char *CacheKey<UCTSizedItem>::typeName() const {
+    return "UCTSizedItem";
+}
+
+template<> U_EXPORT
+const UCTSizedItem *LocaleCacheKey<UCTSizedItem>::createObject(
+        const void * /*unused*/, UErrorCode & /*status*/) const {
+    ++gSizedItemsCreated;
+    UCTSizedItem *result = new UCTSizedItem();
+    result->addRef();
+    return result;
+}
+
 U_NAMESPACE_END
 
 
@@ -77,6 +116,10 @@ class UnifiedCacheTest : public IntlTest {
     void TestError();
     void TestHashEquals();
     void TestEvictionUnderStress();
+    void TestMemoryLimit();
+    void TestMemoryUsageEstimates();
+    void TestStatistics();
+    void getSizedItem(const UnifiedCache &cache, const char *loc, UErrorCode &status);
 };
 
 void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
@@ -87,6 +130,9 @@ void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &na
   TESTCASE_AUTO(TestError);
   TESTCASE_AUTO(TestHashEquals);
   TESTCASE_AUTO(TestEvictionUnderStress);
+  TESTCASE_AUTO(TestMemoryLimit);
+  TESTCASE_AUTO(TestMemoryUsageEstimates);
+  TESTCASE_AUTO(TestStatistics);
   TESTCASE_AUTO_END;
 }
 
@@ -396,6 +442,168 @@ void UnifiedCacheTest::TestHashEquals() {
     assertTrue("", diffKey1 != diffKey2);
 }
 
+// Looks up a UCTSizedItem and immediately releases it, leaving an unused entry.
+void UnifiedCacheTest::getSizedItem(
+        const UnifiedCache &cache, const char *loc, UErrorCode &status) {
+    const UCTSizedItem *item = NULL;
+    cache.get(LocaleCacheKey<UCTSizedItem>(loc), &cache, item, status);
+    SharedObject::clearPtr(item);
+}
+
+void UnifiedCacheTest::TestMemoryLimit() {
+    UErrorCode status = U_ZERO_ERROR;
+
+    // See TestEvictionPolicy for why the global cache is initialized first.
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+
+    cache.setMemoryLimit(-1, status);
+    assertEquals("T1", U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    // Each UCTSizedItem uses 100 bytes, so at most 3 fit.
+    cache.setMemoryLimit(350, status);
+    assertEquals("T2", (int64_t)350, cache.memoryLimit());
+    gSizedItemsCreated = 0;
+    getSizedItem(cache, "1", status);
+    getSizedItem(cache, "2", status);
+    getSizedItem(cache, "3", status);
+    assertEquals("T3", (int64_t)300, cache.byteCount());
+    getSizedItem(cache, "4", status);
+    getSizedItem(cache, "5", status);
+    assertEquals("T4", (int64_t)300, cache.byteCount());
+    assertEquals("T5", 3, cache.keyCount());
+    assertEquals("T6", (int64_t)2, cache.autoEvictedCount());
+
+    // "3" is now the most recently used, so "4" is evicted next.
+    getSizedItem(cache, "3", status);
+    assertEquals("T7", 5, gSizedItemsCreated);
+    getSizedItem(cache, "6", status);
+    getSizedItem(cache, "3", status);
+    getSizedItem(cache, "5", status);
+    assertEquals("T8", 6, gSizedItemsCreated);
+    getSizedItem(cache, "4", status);
+    assertEquals("T9", 7, gSizedItemsCreated);
+
+    // Values in use are never evicted, even when over the limit.
+    const UCTSizedItem *held[4] = {NULL, NULL, NULL, NULL};
+    static const char *heldLocales[] = {"7", "8", "9", "10"};
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        cache.get(LocaleCacheKey<UCTSizedItem>(heldLocales[i]), &cache, held[i], status);
+    }
+    assertEquals("T10", (int64_t)400, cache.byteCount());
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        SharedObject::clearPtr(held[i]);
+    }
+    assertEquals("T11", (int64_t)300, cache.byteCount());
+
+    // Lowering the limit evicts immediately.
+    cache.setMemoryLimit(100, status);
+    assertEquals("T12", (int64_t)100, cache.byteCount());
+    assertEquals("T13", 1, cache.keyCount());
+
+    // Without a limit, nothing is evicted for memory.
+    cache.setMemoryLimit(0, status);
+    getSizedItem(cache, "1", status);
+    getSizedItem(cache, "2", status);
+    assertEquals("T14", (int64_t)300, cache.byteCount());
+    assertSuccess("T15", status);
+}
+
+void UnifiedCacheTest::TestMemoryUsageEstimates() {
+#if !UCONFIG_NO_FORMATTING
+    // Cached formatting objects count the heap memory they own,
+    // not just the size of a SharedObject.
+    UErrorCode status = U_ZERO_ERROR;
+    const SharedPluralRules *rules = PluralRules::createSharedInstance(
+            Locale("fr"), UPLURAL_TYPE_CARDINAL, status);
+    const SharedNumberFormat *format = NumberFormat::createSharedInstance(
+            Locale("fr"), UNUM_DECIMAL, status);
+    if (U_FAILURE(status)) {
+        dataerrln("Failure creating cached objects - %s", u_errorName(status));
+        SharedObject::clearPtr(rules);
+        SharedObject::clearPtr(format);
+        return;
+    }
+    assertTrue("plural rules",
+               rules->getMemoryUsage() > (int32_t)(sizeof(SharedObject) + sizeof(PluralRules)));
+    assertTrue("number format",
+               format->getMemoryUsage() > (int32_t)sizeof(DecimalFormatSymbols));
+    SharedObject::clearPtr(rules);
+    SharedObject::clearPtr(format);
+#endif
+}
+
+void UnifiedCacheTest::TestStatistics() {
+    UErrorCode status = U_ZERO_ERROR;
+
+    // See TestEvictionPolicy for why the global cache is initialized first.
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+    assertEquals("T1", 0, cache.keyTypeCount());
+
+    const UCTItem *en = NULL;
+    const UCTItem *enUs = NULL;
+    const UCTItem *zh = NULL;
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    // Creating en_US looks up en.
+    cache.get(LocaleCacheKey<UCTItem>("en_US"), &cache, enUs, status);
+    assertSuccess("T2", status);
+    getSizedItem(cache, "fr", status);
+    getSizedItem(cache, "fr", status);
+    assertSuccess("T3", status);
+    // Failures to create a value are cached, too.
+    cache.get(LocaleCacheKey<UCTItem>("zh"), &cache, zh, status);
+    status = U_ZERO_ERROR;
+    cache.get(LocaleCacheKey<UCTItem>("zh"), &cache, zh, status);
+    assertEquals("T4", U_MISSING_RESOURCE_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    assertEquals("T5", 2, cache.keyTypeCount());
+    assertEquals("T6", "UCTItem", cache.keyTypeName(0));
+    assertEquals("T7", "UCTSizedItem", cache.keyTypeName(1));
+    assertTrue("T8", cache.keyTypeName(2) == nullptr);
+
+    UnifiedCacheKeyTypeStats stats;
+    cache.keyTypeStats(0, stats);
+    assertEquals("T9", (int64_t)3, stats.hits);
+    assertEquals("T10", (int64_t)3, stats.misses);
+    assertEquals("T11", (int64_t)0, stats.waits);
+    assertTrue("T12", stats.maxCreationNanos >= 0);
+    assertTrue("T13", stats.creationNanos >= stats.maxCreationNanos);
+    cache.keyTypeStats(1, stats);
+    assertEquals("T14", (int64_t)1, stats.hits);
+    assertEquals("T15", (int64_t)1, stats.misses);
+
+    SharedObject::clearPtr(en);
+    SharedObject::clearPtr(enUs);
+    cache.setEvictionPolicy(0, 0, status);
+    getSizedItem(cache, "de", status);
+    cache.keyTypeStats(0, stats);
+    int64_t evictions = stats.evictions;
+    assertTrue("T16", evictions > 0);
+    cache.keyTypeStats(1, stats);
+    evictions += stats.evictions;
+    assertEquals("T17", cache.autoEvictedCount(), evictions);
+
+    cache.resetStats();
+    cache.keyTypeStats(0, stats);
+    assertEquals("T18", (int64_t)0, stats.hits);
+    assertEquals("T19", (int64_t)0, stats.evictions);
+    assertEquals("T20", 2, cache.keyTypeCount());
+
+    // The C API reports on the global cache.
+    assertTrue("T21", ucache_countKeyTypes(&status) >= 0);
+    ucache_getKeyTypeName(-1, &status);
+    assertEquals("T22", U_INDEX_OUTOFBOUNDS_ERROR, status);
+    status = U_ZERO_ERROR;
+    ucache_getKeyTypeStatistic(ucache_countKeyTypes(&status), UCACHE_HITS, &status);
+    assertEquals("T23", U_INDEX_OUTOFBOUNDS_ERROR, status);
+}
+
 extern IntlTest *createUnifiedCacheTest() {
     return new UnifiedCacheTest();
 }
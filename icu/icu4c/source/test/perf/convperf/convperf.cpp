@@ -116,6 +116,15 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_ASCII_ToUnicode);
+        TESTCASE(55,TestICU_ASCII_FromUnicode);
+
+        TESTCASE(56,TestICU_GB18030_ToUnicode);
+        TESTCASE(57,TestICU_GB18030_FromUnicode);
+
+        TESTCASE(58,TestICU_ISO2022JP_Mail_ToUnicode);
+        TESTCASE(59,TestICU_ISO2022JP_Mail_FromUnicode);
+
         default: 
             name = ""; 
             return NULL;
@@ -218,6 +227,25 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_Latin1_ToUnicode(){
 }
 
 
+// The Latin-1 sample text is all ASCII.
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCII_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("US-ASCII", (UChar *)latin1_uniSource, UPRV_LENGTHOF(latin1_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_ASCII_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("US-ASCII",(char*)latin1_encSource, UPRV_LENGTHOF(latin1_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_Latin1_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("iso-8859-1",latin1_uniSource, UPRV_LENGTHOF(latin1_uniSource), status);
@@ -507,6 +535,38 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_GB2312_ToUnicode(){
 }
 
 
+// Han characters with two-byte codes, mixed with characters from
+// the GB 18030 four-byte ranges: Hangul, Thai, a CJK Ext. B ideograph and emoji.
+static const UChar gb18030_uniSource[]={
+    0x4e2d, 0x6587, 0xd55c, 0xad6d, 0xc5b4, 0x0e20, 0x0e32, 0x0e29, 0x0e32, 0x0020,
+    0xd840, 0xdc0b, 0x4eba, 0x6c11, 0xd83d, 0xde00, 0xd83c, 0xdf0f, 0xb300, 0xd55c,
+    0xbbfc, 0xad6d, 0x3002, 0x0041, 0x0042, 0x0043, 0x5b57, 0x7b26, 0xd83d, 0xdc4d
+};
+
+static char gb18030_encSource[4*UPRV_LENGTHOF(gb18030_uniSource)];
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("gb18030", gb18030_uniSource, UPRV_LENGTHOF(gb18030_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_GB18030_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UConverter* conv = ucnv_open("gb18030", &status);
+    int32_t length = ucnv_fromUChars(conv, gb18030_encSource, UPRV_LENGTHOF(gb18030_encSource),
+                                     gb18030_uniSource, UPRV_LENGTHOF(gb18030_uniSource), &status);
+    ucnv_close(conv);
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("gb18030", gb18030_encSource, length, status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_GB2312_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("gb2312",gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), status);
@@ -622,6 +682,52 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_ISO2022JP_ToUnicode(){
 }
 
 
+// An e-mail message: mostly ASCII header and body lines, some with Japanese text.
+static const UChar iso2022jpMail_uniSource[] =
+    u"From: Tanaka Hiroshi <tanaka@example.co.jp>\r\n"
+    u"To: project-team@example.com\r\n"
+    u"Subject: Re: \u4F1A\u8B70\u306E\u4E88\u5B9A (meeting schedule)\r\n"
+    u"Date: Tue, 12 Mar 2024 09:41:07 +0900\r\n"
+    u"Message-ID: <20240312094107.4711@mail.example.co.jp>\r\n"
+    u"MIME-Version: 1.0\r\n"
+    u"Content-Type: text/plain; charset=ISO-2022-JP\r\n"
+    u"\r\n"
+    u"Hello everyone,\r\n"
+    u"\r\n"
+    u"The meeting is moved to Thursday at 10:00 in room 3B. Please bring the Q3 report\r\n"
+    u"and the draft of the release notes. The agenda is in the shared folder.\r\n"
+    u"\u3088\u308D\u3057\u304F\u304A\u9858\u3044\u3057\u307E\u3059\u3002\r\n"
+    u"\r\n"
+    u"> On Mon, 11 Mar 2024, Suzuki wrote:\r\n"
+    u"> Can we move the meeting? I am traveling on Wednesday.\r\n"
+    u"\r\n"
+    u"--\r\n"
+    u"Tanaka Hiroshi / Engineering\r\n";
+
+static char iso2022jpMail_encSource[2*UPRV_LENGTHOF(iso2022jpMail_uniSource)];
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022JP_Mail_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("iso-2022-jp", iso2022jpMail_uniSource, UPRV_LENGTHOF(iso2022jpMail_uniSource)-1, status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_ISO2022JP_Mail_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UConverter* conv = ucnv_open("iso-2022-jp", &status);
+    int32_t length = ucnv_fromUChars(conv, iso2022jpMail_encSource, UPRV_LENGTHOF(iso2022jpMail_encSource),
+                                     iso2022jpMail_uniSource, UPRV_LENGTHOF(iso2022jpMail_uniSource)-1, &status);
+    ucnv_close(conv);
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("iso-2022-jp", iso2022jpMail_encSource, length, status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_ISO2022JP_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("iso-2022-jp",iso2022jp_uniSource, UPRV_LENGTHOF(iso2022jp_uniSource), status);
@@ -515,6 +515,9 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_Latin1_ToUnicode();
     UPerfFunction* TestWinIML2_Latin1_FromUnicode();
 
+    UPerfFunction* TestICU_ASCII_ToUnicode();
+    UPerfFunction* TestICU_ASCII_FromUnicode();
+
     UPerfFunction* TestICU_EBCDIC_Arabic_ToUnicode();
     UPerfFunction* TestICU_EBCDIC_Arabic_FromUnicode();
     UPerfFunction* TestWinANSI_EBCDIC_Arabic_ToUnicode();
@@ -551,6 +554,12 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_GB2312_ToUnicode();
     UPerfFunction* TestWinIML2_GB2312_FromUnicode();
 
+    UPerfFunction* TestICU_GB18030_ToUnicode();
+    UPerfFunction* TestICU_GB18030_FromUnicode();
+
+    UPerfFunction* TestICU_ISO2022JP_Mail_ToUnicode();
+    UPerfFunction* TestICU_ISO2022JP_Mail_FromUnicode();
+
 
     UPerfFunction* TestICU_ISO2022KR_ToUnicode();
     UPerfFunction* TestICU_ISO2022KR_FromUnicode();
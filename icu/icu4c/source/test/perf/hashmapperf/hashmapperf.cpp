@@ -0,0 +1,148 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*
+* Lookups in a UHashtable vs. a FlatHashMap with the same char * keys,
+* like in the converter, data and resource bundle caches.
+* The keys are converter names, their aliases, and locale IDs.
+*/
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "unicode/ucnv.h"
+#include "unicode/uloc.h"
+#include "unicode/uperf.h"
+#include "flathashmap.h"
+#include "uhash.h"
+
+static std::vector<std::string> getKeys() {
+    std::vector<std::string> keys;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t count = ucnv_countAvailable();
+    for (int32_t i = 0; i < count; ++i) {
+        const char *name = ucnv_getAvailableName(i);
+        uint16_t aliasCount = ucnv_countAliases(name, &errorCode);
+        for (uint16_t j = 0; j < aliasCount && U_SUCCESS(errorCode); ++j) {
+            keys.push_back(ucnv_getAlias(name, j, &errorCode));
+        }
+    }
+    count = uloc_countAvailable();
+    for (int32_t i = 0; i < count; ++i) {
+        keys.push_back(uloc_getAvailable(i));
+    }
+    return keys;
+}
+
+/**
+ * Looks up each key. The table contains all keys,
+ * or, if missing is true, none of the keys that are looked up.
+ */
+class HashGet : public UPerfFunction {
+public:
+    HashGet(UBool flat, UBool missing, UErrorCode &status)
+            : fFlat(flat), fKeys(getKeys()), fLookupKeys(fKeys) {
+        if (missing) {
+            for (std::string &key : fLookupKeys) {
+                key.append("_ZZ");
+            }
+        }
+        fHash = uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &status);
+        if (U_FAILURE(status)) { return; }
+        for (size_t i = 0; i < fKeys.size(); ++i) {
+            void *value = (void *)(fKeys[i].c_str());
+            uhash_put(fHash, (void *)fKeys[i].c_str(), value, &status);
+            fMap.put(fKeys[i].c_str(), value, status);
+        }
+    }
+    virtual ~HashGet() {
+        uhash_close(fHash);
+    }
+    virtual void call(UErrorCode * /*status*/) override {
+        int32_t found = 0;
+        if (fFlat) {
+            for (const std::string &key : fLookupKeys) {
+                found += fMap.get(key.c_str()) != nullptr;
+            }
+        } else {
+            for (const std::string &key : fLookupKeys) {
+                found += uhash_get(fHash, key.c_str()) != nullptr;
+            }
+        }
+        // Keeps the compiler from optimizing away the lookups.
+        fFound = found;
+    }
+    virtual long getOperationsPerIteration() override {
+        return (long)fLookupKeys.size();
+    }
+private:
+    UBool fFlat;
+    std::vector<std::string> fKeys;
+    std::vector<std::string> fLookupKeys;
+    UHashtable *fHash = nullptr;
+    int32_t fFound = 0;
+    icu::FlatHashMap<const char *, void *, icu::CharsKeyTraits> fMap;
+};
+
+class HashMapPerfTest : public UPerfTest {
+public:
+    HashMapPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "hashmapperf", status) {}
+    virtual UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char *&name, char *par = nullptr) override;
+
+private:
+    UPerfFunction* TestUHashGet() { return newHashGet(false, false); }
+    UPerfFunction* TestFlatHashMapGet() { return newHashGet(true, false); }
+    UPerfFunction* TestUHashGetMissing() { return newHashGet(false, true); }
+    UPerfFunction* TestFlatHashMapGetMissing() { return newHashGet(true, true); }
+
+    UPerfFunction* newHashGet(UBool flat, UBool missing) {
+        UErrorCode status = U_ZERO_ERROR;
+        HashGet *f = new HashGet(flat, missing, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "HashGet setup failed: %s\n", u_errorName(status));
+            delete f;
+            return nullptr;
+        }
+        return f;
+    }
+};
+
+UPerfFunction*
+HashMapPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestUHashGet);
+    TESTCASE_AUTO(TestFlatHashMapGet);
+    TESTCASE_AUTO(TestUHashGetMissing);
+    TESTCASE_AUTO(TestFlatHashMapGetMissing);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    HashMapPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,9 @@
+#!/bin/sh
+# Copyright (C) 2016 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+# Compare lookups in a UHashtable and in a FlatHashMap.
+for t in TestUHashGet TestFlatHashMapGet TestUHashGetMissing TestFlatHashMapGetMissing; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./hashmapperf $t -p 5 -i 1000
+done
@@ -206,7 +206,7 @@ double measure(Operation &op, int32_t pieceLength) {
         double seconds = op.call(iterations, pieceLength);
         if (seconds >= 1) {
             if (iterations > 1) {
-                return seconds / (iterations * pieceLength);
+                return seconds / ((double)iterations * pieceLength);
             } else {
                 // Run it once more, to avoid measuring only the warm-up.
                 return op.call(1, pieceLength) / (iterations * pieceLength);
@@ -294,12 +294,79 @@ double NormalizeUTF8::call(int32_t iterations, int32_t pieceLength) {
         int32_t start8 = offsets[start];
         int32_t limit8 = offsets[start + pieceLength];
         icu::StringPiece piece(s + start8, limit8 - start8);
+        dest.clear();
         norm2.normalizeUTF8(0, piece, sink, nullptr, errorCode);
         start = (start + pieceLength) % limit;
     }
     return utimer_getElapsedSeconds(&startTime);
 }
 
+class IsNormalizedUTF16 : public Operation {
+public:
+    IsNormalizedUTF16(const Normalizer2 &n2, const UnicodeString &text) :
+            norm2(n2), src(text), s(src.getBuffer()) {}
+    virtual ~IsNormalizedUTF16();
+    virtual double call(int32_t iterations, int32_t pieceLength);
+
+private:
+    const Normalizer2 &norm2;
+    UnicodeString src;
+    const UChar *s;
+};
+
+IsNormalizedUTF16::~IsNormalizedUTF16() {}
+
+// Assumes all BMP characters.
+double IsNormalizedUTF16::call(int32_t iterations, int32_t pieceLength) {
+    int32_t start = 0;
+    int32_t limit = src.length() - pieceLength;
+    UnicodeString piece;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    utimer_getTime(&startTime);
+    for (int32_t i = 0; i < iterations; ++i) {
+        piece.setTo(false, s + start, pieceLength);
+        norm2.isNormalized(piece, errorCode);
+        start = (start + pieceLength) % limit;
+    }
+    return utimer_getElapsedSeconds(&startTime);
+}
+
+class IsNormalizedUTF8 : public Operation {
+public:
+    IsNormalizedUTF8(const Normalizer2 &n2, const UnicodeString &text) : norm2(n2) {
+        offsets = CommonChars::toUTF8WithOffsets(text, src, numCodePoints);
+        s = src.data();
+    }
+    virtual ~IsNormalizedUTF8();
+    virtual double call(int32_t iterations, int32_t pieceLength);
+
+private:
+    const Normalizer2 &norm2;
+    std::string src;
+    const char *s;
+    int32_t *offsets;
+    int32_t numCodePoints;
+};
+
+IsNormalizedUTF8::~IsNormalizedUTF8() {
+    delete[] offsets;
+}
+
+double IsNormalizedUTF8::call(int32_t iterations, int32_t pieceLength) {
+    int32_t start = 0;
+    int32_t limit = numCodePoints - pieceLength;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    utimer_getTime(&startTime);
+    for (int32_t i = 0; i < iterations; ++i) {
+        int32_t start8 = offsets[start];
+        int32_t limit8 = offsets[start + pieceLength];
+        icu::StringPiece piece(s + start8, limit8 - start8);
+        norm2.isNormalizedUTF8(piece, errorCode);
+        start = (start + pieceLength) % limit;
+    }
+    return utimer_getElapsedSeconds(&startTime);
+}
+
 }  // namespace
 
 extern int main(int /*argc*/, const char * /*argv*/[]) {
@@ -308,6 +375,7 @@ extern int main(int /*argc*/, const char * /*argv*/[]) {
     int32_t maxLength = getMaxLength() * 10;
     UErrorCode errorCode = U_ZERO_ERROR;
     const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfkc = Normalizer2::getNFKCInstance(errorCode);
     const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
     if (U_FAILURE(errorCode)) {
         fprintf(stderr,
@@ -324,6 +392,71 @@ extern int main(int /*argc*/, const char * /*argv*/[]) {
         NormalizeUTF8 op(*nfc, CommonChars::getJapanese(maxLength));
         benchmark("NFC/UTF-8/japanese", op);
     }
+    {
+        // Long runs below the minimum code points are skipped a block at a time.
+        NormalizeUTF16 op(*nfc, CommonChars::getASCII(maxLength));
+        benchmark("NFC/UTF-16/ascii", op);
+    }
+    {
+        NormalizeUTF8 op(*nfc, CommonChars::getASCII(maxLength));
+        benchmark("NFC/UTF-8/ascii", op);
+    }
+    {
+        NormalizeUTF16 op(*nfc, CommonChars::getMixed(maxLength));
+        benchmark("NFC/UTF-16/mixed", op);
+    }
+    {
+        NormalizeUTF8 op(*nfc, CommonChars::getMixed(maxLength));
+        benchmark("NFC/UTF-8/mixed", op);
+    }
+    {
+        IsNormalizedUTF16 op(*nfc, CommonChars::getASCII(maxLength));
+        benchmark("NFC/isNormalized/UTF-16/ascii", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfc, CommonChars::getASCII(maxLength));
+        benchmark("NFC/isNormalized/UTF-8/ascii", op);
+    }
+    {
+        IsNormalizedUTF16 op(*nfc, CommonChars::getMixed(maxLength));
+        benchmark("NFC/isNormalized/UTF-16/mixed", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfc, CommonChars::getMixed(maxLength));
+        benchmark("NFC/isNormalized/UTF-8/mixed", op);
+    }
+    {
+        NormalizeUTF16 op(*nfkc, CommonChars::getASCII(maxLength));
+        benchmark("NFKC/UTF-16/ascii", op);
+    }
+    {
+        NormalizeUTF8 op(*nfkc, CommonChars::getASCII(maxLength));
+        benchmark("NFKC/UTF-8/ascii", op);
+    }
+    {
+        NormalizeUTF16 op(*nfkc, CommonChars::getMixed(maxLength));
+        benchmark("NFKC/UTF-16/mixed", op);
+    }
+    {
+        NormalizeUTF8 op(*nfkc, CommonChars::getMixed(maxLength));
+        benchmark("NFKC/UTF-8/mixed", op);
+    }
+    {
+        IsNormalizedUTF16 op(*nfkc, CommonChars::getASCII(maxLength));
+        benchmark("NFKC/isNormalized/UTF-16/ascii", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfkc, CommonChars::getASCII(maxLength));
+        benchmark("NFKC/isNormalized/UTF-8/ascii", op);
+    }
+    {
+        IsNormalizedUTF16 op(*nfkc, CommonChars::getMixed(maxLength));
+        benchmark("NFKC/isNormalized/UTF-16/mixed", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfkc, CommonChars::getMixed(maxLength));
+        benchmark("NFKC/isNormalized/UTF-8/mixed", op);
+    }
     {
         NormalizeUTF16 op(*nfkc_cf, CommonChars::getMixed(maxLength));
         benchmark("NFKC_CF/UTF-16/mixed", op);
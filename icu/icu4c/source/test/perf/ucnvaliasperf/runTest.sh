@@ -0,0 +1,10 @@
+#!/bin/sh
+# Copyright (C) 2016 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+# Resolve converter names: all aliases, the IANA aliases,
+# and ucnv_open()/ucnv_close() by IANA alias.
+for t in TestAllAliases TestIANAAliases TestOpenIANAAliases; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./ucnvaliasperf $t -p 5 -i 10
+done
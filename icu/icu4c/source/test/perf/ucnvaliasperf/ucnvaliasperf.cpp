@@ -0,0 +1,128 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*
+* Resolving converter names to converters:
+* ucnv_countAliases() looks up a name in the alias table, for every alias
+* of every available converter, or for every IANA alias;
+* and ucnv_open()/ucnv_close() by IANA alias.
+*/
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "unicode/ucnv.h"
+#include "unicode/uenum.h"
+#include "unicode/uperf.h"
+
+class AliasLookup : public UPerfFunction {
+public:
+    AliasLookup(const char *standard, UBool open, UErrorCode &status)
+            : fOpen(open) {
+        int32_t count = ucnv_countAvailable();
+        for (int32_t i = 0; i < count && U_SUCCESS(status); ++i) {
+            const char *name = ucnv_getAvailableName(i);
+            if (standard == nullptr) {
+                uint16_t aliasCount = ucnv_countAliases(name, &status);
+                for (uint16_t j = 0; j < aliasCount && U_SUCCESS(status); ++j) {
+                    addName(ucnv_getAlias(name, j, &status), status);
+                }
+            } else {
+                UEnumeration *names = ucnv_openStandardNames(name, standard, &status);
+                const char *alias;
+                while ((alias = uenum_next(names, nullptr, &status)) != nullptr) {
+                    addName(alias, status);
+                }
+                uenum_close(names);
+            }
+        }
+    }
+    virtual void call(UErrorCode *status) override {
+        for (const std::string &s : fNames) {
+            const char *name = s.c_str();
+            UErrorCode localStatus = U_ZERO_ERROR;
+            if (fOpen) {
+                ucnv_close(ucnv_open(name, &localStatus));
+            } else {
+                fSum += ucnv_countAliases(name, &localStatus);
+            }
+            if (U_FAILURE(localStatus)) {
+                *status = localStatus;
+            }
+        }
+    }
+    virtual long getOperationsPerIteration() override {
+        return (long)fNames.size();
+    }
+private:
+    void addName(const char *name, UErrorCode &status) {
+        if (U_SUCCESS(status)) {
+            fNames.push_back(name);
+        }
+    }
+
+    std::vector<std::string> fNames;
+    UBool fOpen;
+    int32_t fSum = 0;
+};
+
+class AliasPerfTest : public UPerfTest {
+public:
+    AliasPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "ucnvaliasperf", status) {}
+    virtual UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char *&name, char *par = nullptr) override;
+
+private:
+    UPerfFunction* TestAllAliases() { return newAliasLookup(nullptr, false); }
+    UPerfFunction* TestIANAAliases() { return newAliasLookup("IANA", false); }
+    UPerfFunction* TestOpenIANAAliases() { return newAliasLookup("IANA", true); }
+
+    UPerfFunction* newAliasLookup(const char *standard, UBool open) {
+        UErrorCode status = U_ZERO_ERROR;
+        AliasLookup *f = new AliasLookup(standard, open, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "AliasLookup setup failed: %s\n", u_errorName(status));
+            delete f;
+            return nullptr;
+        }
+        return f;
+    }
+};
+
+UPerfFunction*
+AliasPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestAllAliases);
+    TESTCASE_AUTO(TestIANAAliases);
+    TESTCASE_AUTO(TestOpenIANAAliases);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    AliasPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,11 @@
+#!/bin/sh
+# Copyright (C) 2016 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+# Compare getting a converter for each small conversion:
+# ucnv_open()/ucnv_close(), ucnv_clone(), and a converter pool.
+for t in TestOpenClose TestClone TestPool \
+         TestOpenClose8Threads TestClone8Threads TestPool8Threads; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./ucnvpoolperf $t -p 5 -i 10
+done
@@ -0,0 +1,148 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*
+* Getting a converter for each short conversion, like a server that
+* converts one small request at a time: ucnv_open()/ucnv_close(),
+* ucnv_clone() of a template converter, and a converter pool.
+* Each operation gets a converter, converts a short string and
+* gives the converter back, on one or on several threads.
+*/
+
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "unicode/ucnv.h"
+#include "unicode/ucnvpool.h"
+#include "unicode/uperf.h"
+
+static const char *const CONVERTER_NAME = "Shift_JIS";
+static const UChar TEXT[] = u"GET /index.html こんにちは";
+static const int32_t OPS_PER_THREAD = 20000;
+
+enum GetMode { OPEN_CLOSE, CLONE, POOL };
+
+class GetConverter : public UPerfFunction {
+public:
+    GetConverter(GetMode mode, int32_t threadCount, UErrorCode &status)
+            : fMode(mode), fThreadCount(threadCount) {
+        fTemplate = ucnv_open(CONVERTER_NAME, &status);
+        fPool = ucnvpool_open(&status);
+    }
+    virtual ~GetConverter() {
+        ucnv_close(fTemplate);
+        ucnvpool_close(fPool);
+    }
+    virtual void call(UErrorCode *status) override {
+        std::vector<std::thread> threads;
+        for (int32_t i = 1; i < fThreadCount; ++i) {
+            threads.push_back(std::thread([this]() {
+                UErrorCode threadStatus = U_ZERO_ERROR;
+                convert(threadStatus);
+            }));
+        }
+        convert(*status);
+        for (std::thread &t : threads) {
+            t.join();
+        }
+    }
+    virtual long getOperationsPerIteration() override {
+        return (long)fThreadCount * OPS_PER_THREAD;
+    }
+private:
+    void convert(UErrorCode &status) {
+        char bytes[100];
+        for (int32_t i = 0; i < OPS_PER_THREAD && U_SUCCESS(status); ++i) {
+            UConverter *cnv;
+            switch (fMode) {
+            case OPEN_CLOSE:
+                cnv = ucnv_open(CONVERTER_NAME, &status);
+                break;
+            case CLONE:
+                cnv = ucnv_clone(fTemplate, &status);
+                break;
+            default:
+                cnv = ucnvpool_acquire(fPool, CONVERTER_NAME, &status);
+                break;
+            }
+            ucnv_fromUChars(cnv, bytes, (int32_t)sizeof(bytes), TEXT, -1, &status);
+            if (fMode == POOL) {
+                ucnvpool_release(fPool, cnv);
+            } else {
+                ucnv_close(cnv);
+            }
+        }
+    }
+
+    GetMode fMode;
+    int32_t fThreadCount;
+    UConverter *fTemplate = nullptr;
+    UConverterPool *fPool = nullptr;
+};
+
+class ConverterPoolPerfTest : public UPerfTest {
+public:
+    ConverterPoolPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "ucnvpoolperf", status) {}
+    virtual UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char *&name, char *par = nullptr) override;
+
+private:
+    UPerfFunction* TestOpenClose() { return newGetConverter(OPEN_CLOSE, 1); }
+    UPerfFunction* TestClone() { return newGetConverter(CLONE, 1); }
+    UPerfFunction* TestPool() { return newGetConverter(POOL, 1); }
+    UPerfFunction* TestOpenClose8Threads() { return newGetConverter(OPEN_CLOSE, 8); }
+    UPerfFunction* TestClone8Threads() { return newGetConverter(CLONE, 8); }
+    UPerfFunction* TestPool8Threads() { return newGetConverter(POOL, 8); }
+
+    UPerfFunction* newGetConverter(GetMode mode, int32_t threadCount) {
+        UErrorCode status = U_ZERO_ERROR;
+        GetConverter *f = new GetConverter(mode, threadCount, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "GetConverter setup failed: %s\n", u_errorName(status));
+            delete f;
+            return nullptr;
+        }
+        return f;
+    }
+};
+
+UPerfFunction*
+ConverterPoolPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestOpenClose);
+    TESTCASE_AUTO(TestClone);
+    TESTCASE_AUTO(TestPool);
+    TESTCASE_AUTO(TestOpenClose8Threads);
+    TESTCASE_AUTO(TestClone8Threads);
+    TESTCASE_AUTO(TestPool8Threads);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    ConverterPoolPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,10 @@
+#!/bin/sh
+# Copyright (C) 2016 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+# Select converters for a message with a selector for all converters:
+# ASCII and Japanese text, as UTF-8 and UTF-16, whole and in chunks.
+for t in TestUTF8ASCII TestUTF8Japanese TestUTF16Japanese TestStreamUTF8Japanese; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./ucnvselperf $t -p 5 -i 10
+done
@@ -0,0 +1,149 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*
+* Selecting the converters that can encode a message, like a mail system
+* choosing an outbound charset: a selector for all converters,
+* with ASCII and with Japanese text, as UTF-8 and UTF-16,
+* and with the text passed in chunks as if read from the network.
+*/
+
+#include <stdio.h>
+#include <string>
+
+#include "unicode/ucnvsel.h"
+#include "unicode/uenum.h"
+#include "unicode/uperf.h"
+#include "unicode/ustring.h"
+
+static const char ASCII_LINE[] =
+    "Dear customer, your order #12345 has shipped and will arrive on Tuesday.\r\n";
+static const char JAPANESE_LINE[] =
+    "お客様、ご注文 #12345 は発送されました。火曜日に到着予定です。Thank you!\r\n";
+static const int32_t LINE_COUNT = 40;
+static const int32_t CHUNK_LENGTH = 256;
+
+enum SelectMode { UTF8, UTF16, STREAM_UTF8 };
+
+class Select : public UPerfFunction {
+public:
+    Select(UConverterSelector *sel, const char *line, SelectMode mode, UErrorCode &status)
+            : fSel(sel), fMode(mode) {
+        for (int32_t i = 0; i < LINE_COUNT; ++i) {
+            fUTF8.append(line);
+        }
+        int32_t length16 = 0;
+        u_strFromUTF8(nullptr, 0, &length16, fUTF8.data(), (int32_t)fUTF8.length(), &status);
+        if (status == U_BUFFER_OVERFLOW_ERROR) {
+            status = U_ZERO_ERROR;
+        }
+        fUTF16.resize(length16);
+        u_strFromUTF8(&fUTF16[0], length16, nullptr,
+                      fUTF8.data(), (int32_t)fUTF8.length(), &status);
+        fStream = ucnvsel_openStream(sel, &status);
+    }
+    virtual ~Select() {
+        ucnvsel_closeStream(fStream);
+    }
+    virtual void call(UErrorCode *status) override {
+        UEnumeration *names;
+        int32_t length8 = (int32_t)fUTF8.length();
+        switch (fMode) {
+        case UTF8:
+            names = ucnvsel_selectForUTF8(fSel, fUTF8.data(), length8, status);
+            break;
+        case UTF16:
+            names = ucnvsel_selectForString(fSel, fUTF16.data(), (int32_t)fUTF16.length(), status);
+            break;
+        default:
+            ucnvsel_resetStream(fStream);
+            for (int32_t i = 0; i < length8; i += CHUNK_LENGTH) {
+                int32_t length = length8 - i < CHUNK_LENGTH ? length8 - i : CHUNK_LENGTH;
+                ucnvsel_streamUTF8(fStream, fUTF8.data() + i, length, status);
+            }
+            names = ucnvsel_selectForStream(fStream, status);
+            break;
+        }
+        uenum_close(names);
+    }
+    virtual long getOperationsPerIteration() override {
+        return (long)fUTF8.length();
+    }
+private:
+    UConverterSelector *fSel;
+    SelectMode fMode;
+    std::string fUTF8;
+    std::u16string fUTF16;
+    UConverterSelectorStream *fStream = nullptr;
+};
+
+class ConverterSelectorPerfTest : public UPerfTest {
+public:
+    ConverterSelectorPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "ucnvselperf", status) {
+        if (U_SUCCESS(status)) {
+            fSel = ucnvsel_open(nullptr, 0, nullptr, UCNV_ROUNDTRIP_SET, &status);
+        }
+    }
+    virtual ~ConverterSelectorPerfTest() {
+        ucnvsel_close(fSel);
+    }
+    virtual UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char *&name, char *par = nullptr) override;
+
+private:
+    UPerfFunction* TestUTF8ASCII() { return newSelect(ASCII_LINE, UTF8); }
+    UPerfFunction* TestUTF8Japanese() { return newSelect(JAPANESE_LINE, UTF8); }
+    UPerfFunction* TestUTF16Japanese() { return newSelect(JAPANESE_LINE, UTF16); }
+    UPerfFunction* TestStreamUTF8Japanese() { return newSelect(JAPANESE_LINE, STREAM_UTF8); }
+
+    UPerfFunction* newSelect(const char *line, SelectMode mode) {
+        UErrorCode status = U_ZERO_ERROR;
+        Select *f = new Select(fSel, line, mode, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Select setup failed: %s\n", u_errorName(status));
+            delete f;
+            return nullptr;
+        }
+        return f;
+    }
+
+    UConverterSelector *fSel = nullptr;
+};
+
+UPerfFunction*
+ConverterSelectorPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestUTF8ASCII);
+    TESTCASE_AUTO(TestUTF8Japanese);
+    TESTCASE_AUTO(TestUTF16Japanese);
+    TESTCASE_AUTO(TestStreamUTF8Japanese);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    ConverterSelectorPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
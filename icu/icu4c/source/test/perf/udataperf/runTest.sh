@@ -0,0 +1,11 @@
+#!/bin/sh
+# Copyright (C) 2016 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+# Time lookups in the ICU common data package. Run once with the built
+# data and once with ICU_DATA pointing to an older .dat package
+# (and the data library replaced by the stub) to compare with binary search.
+for t in TestResourceBundleOpenCold TestDataOpen TestDataOpenMissing; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./udataperf $t -p 5 -i 10
+done
@@ -0,0 +1,130 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*
+* Lookups of data items in the ICU common data package.
+* Only the package is searched, not individual files in the data
+* directory, so that the timings are dominated by the lookups in the
+* package's table of contents rather than by file system probing.
+* Compare a .dat package with a hashed table of contents (format
+* version 1.1) with one that only supports binary search.
+*/
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "unicode/uclean.h"
+#include "unicode/udata.h"
+#include "unicode/uloc.h"
+#include "unicode/ures.h"
+#include "unicode/uperf.h"
+#include "cmemory.h"
+
+static std::vector<std::string> getLocaleIDs() {
+    std::vector<std::string> localeIDs;
+    localeIDs.push_back("root");
+    int32_t count = uloc_countAvailable();
+    for (int32_t i = 0; i < count; ++i) {
+        localeIDs.push_back(uloc_getAvailable(i));
+    }
+    return localeIDs;
+}
+
+class ResourceBundleOpenCold : public UPerfFunction {
+public:
+    ResourceBundleOpenCold() : fLocaleIDs(getLocaleIDs()) {}
+    // Opens each locale's bundle once, after u_cleanup() emptied
+    // the resource bundle cache and closed the common data.
+    virtual void call(UErrorCode *status) override {
+        u_cleanup();
+        for (const std::string &id : fLocaleIDs) {
+            UResourceBundle *rb = ures_openDirect(nullptr, id.c_str(), status);
+            ures_close(rb);
+        }
+    }
+    virtual long getOperationsPerIteration() override {
+        return (long)fLocaleIDs.size();
+    }
+private:
+    std::vector<std::string> fLocaleIDs;
+};
+
+class DataOpen : public UPerfFunction {
+public:
+    // If missing is true, then all lookups are for items that are not in the package.
+    DataOpen(UBool missing) : fLocaleIDs(getLocaleIDs()) {
+        if (missing) {
+            for (std::string &id : fLocaleIDs) {
+                id.append("_ZZ");
+            }
+        }
+    }
+    virtual void call(UErrorCode *status) override {
+        for (const std::string &id : fLocaleIDs) {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            UDataMemory *data = udata_open(nullptr, "res", id.c_str(), &errorCode);
+            if (U_SUCCESS(errorCode)) {
+                udata_close(data);
+            } else if (errorCode != U_FILE_ACCESS_ERROR) {
+                *status = errorCode;
+            }
+        }
+    }
+    virtual long getOperationsPerIteration() override {
+        return (long)fLocaleIDs.size();
+    }
+private:
+    std::vector<std::string> fLocaleIDs;
+};
+
+class UDataPerfTest : public UPerfTest {
+public:
+    UDataPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "udataperf", status) {
+        udata_setFileAccess(UDATA_ONLY_PACKAGES, &status);
+    }
+    virtual UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char *&name, char *par = nullptr) override;
+
+private:
+    UPerfFunction* TestResourceBundleOpenCold() { return new ResourceBundleOpenCold(); }
+    UPerfFunction* TestDataOpen() { return new DataOpen(false); }
+    UPerfFunction* TestDataOpenMissing() { return new DataOpen(true); }
+};
+
+UPerfFunction*
+UDataPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestResourceBundleOpenCold);
+    TESTCASE_AUTO(TestDataOpen);
+    TESTCASE_AUTO(TestDataOpenMissing);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UDataPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,11 @@
+#!/bin/sh
+# Copyright (C) 2016 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+# Compare lookup throughput (ops/sec) of the unified cache across thread counts.
+for t in TestGet1Thread TestGet2Threads TestGet4Threads TestGet8Threads \
+         TestGet16Threads TestGet32Threads TestGet64Threads \
+         TestGetSameKey8Threads TestGetSameKey64Threads; do
+  LD_LIBRARY_PATH=lib:stubdata:tools/ctestfw:../../lib:../../stubdata:../../tools/ctestfw:$LD_LIBRARY_PATH:../../../lib:../../../stubdata:../../../tools/ctestfw:$LD_LIBRARY_PATH \
+    ./unifiedcacheperf $t -p 5 -i 10
+done
@@ -0,0 +1,170 @@
+/*
+***********************************************************************
+* © 2016 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*
+* Multi-threaded lookup throughput of the UnifiedCache.
+* Each test case runs a fixed number of cache lookups on every thread,
+* so that ops/sec across the thread-count variants shows how lookups
+* scale with the number of cores.
+*/
+
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "unicode/locid.h"
+#include "unicode/uperf.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "unifiedcache.h"
+
+class UCPerfItem : public SharedObject {
+public:
+    UCPerfItem(const char *name) {
+        uprv_strncpy(fName, name, sizeof(fName));
+        fName[sizeof(fName) - 1] = 0;
+    }
+    char fName[32];
+};
+
+U_NAMESPACE_BEGIN
+
+template<> U_EXPORT
+const char *CacheKey<UCPerfItem>::typeName() const {
+    return "UCPerfItem";
+}
+
+template<> U_EXPORT
+const UCPerfItem *LocaleCacheKey<UCPerfItem>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    UCPerfItem *result = new UCPerfItem(fLoc.getName());
+    if (result == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    result->addRef();
+    return result;
+}
+
+U_NAMESPACE_END
+
+static const char *const gLocaleIDs[] = {
+    "en", "en_US", "en_GB", "fr", "fr_FR", "fr_CA", "de", "de_CH",
+    "es", "es_MX", "it", "pt_BR", "ru", "ja", "ko", "zh_Hans",
+    "zh_Hant", "ar", "he", "hi", "th", "tr", "pl", "nl",
+    "sv", "da", "fi", "nb", "cs", "el", "hu", "uk"
+};
+
+static const int32_t LOOKUPS_PER_THREAD = 20000;
+
+class UnifiedCacheGet : public UPerfFunction {
+public:
+    // If sameKey is true, all threads look up the same key and contend for
+    // one cache shard; otherwise every thread cycles through all locales.
+    UnifiedCacheGet(int32_t threadCount, UBool sameKey)
+            : fThreadCount(threadCount), fSameKey(sameKey) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(gLocaleIDs); ++i) {
+            fLocales.push_back(Locale(gLocaleIDs[i]));
+        }
+        // Populate the cache so that the timed loops measure hits only.
+        UErrorCode status = U_ZERO_ERROR;
+        lookup(0, 1, status);
+    }
+    virtual void call(UErrorCode *status) override {
+        std::vector<std::thread> threads;
+        for (int32_t i = 1; i < fThreadCount; ++i) {
+            threads.push_back(std::thread([this, i]() {
+                UErrorCode threadStatus = U_ZERO_ERROR;
+                lookup(i, LOOKUPS_PER_THREAD, threadStatus);
+            }));
+        }
+        lookup(0, LOOKUPS_PER_THREAD, *status);
+        for (std::thread &t : threads) {
+            t.join();
+        }
+    }
+    virtual long getOperationsPerIteration() override {
+        return (long)fThreadCount * LOOKUPS_PER_THREAD;
+    }
+private:
+    void lookup(int32_t threadIndex, int32_t count, UErrorCode &status) {
+        const UnifiedCache *cache = UnifiedCache::getInstance(status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        int32_t localeCount = (int32_t)fLocales.size();
+        const UCPerfItem *item = nullptr;
+        for (int32_t i = 0; i < count; ++i) {
+            const Locale &loc =
+                    fSameKey ? fLocales[0] : fLocales[(threadIndex + i) % localeCount];
+            cache->get(LocaleCacheKey<UCPerfItem>(loc), item, status);
+        }
+        SharedObject::clearPtr(item);
+    }
+
+    int32_t fThreadCount;
+    UBool fSameKey;
+    std::vector<Locale> fLocales;
+};
+
+class UnifiedCachePerfTest : public UPerfTest {
+public:
+    UnifiedCachePerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "unifiedcacheperf", status) {
+    }
+    virtual UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char *&name, char *par = nullptr) override;
+
+private:
+    UPerfFunction* TestGet1Thread() { return new UnifiedCacheGet(1, false); }
+    UPerfFunction* TestGet2Threads() { return new UnifiedCacheGet(2, false); }
+    UPerfFunction* TestGet4Threads() { return new UnifiedCacheGet(4, false); }
+    UPerfFunction* TestGet8Threads() { return new UnifiedCacheGet(8, false); }
+    UPerfFunction* TestGet16Threads() { return new UnifiedCacheGet(16, false); }
+    UPerfFunction* TestGet32Threads() { return new UnifiedCacheGet(32, false); }
+    UPerfFunction* TestGet64Threads() { return new UnifiedCacheGet(64, false); }
+    UPerfFunction* TestGetSameKey8Threads() { return new UnifiedCacheGet(8, true); }
+    UPerfFunction* TestGetSameKey64Threads() { return new UnifiedCacheGet(64, true); }
+};
+
+UPerfFunction*
+UnifiedCachePerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestGet1Thread);
+    TESTCASE_AUTO(TestGet2Threads);
+    TESTCASE_AUTO(TestGet4Threads);
+    TESTCASE_AUTO(TestGet8Threads);
+    TESTCASE_AUTO(TestGet16Threads);
+    TESTCASE_AUTO(TestGet32Threads);
+    TESTCASE_AUTO(TestGet64Threads);
+    TESTCASE_AUTO(TestGetSameKey8Threads);
+    TESTCASE_AUTO(TestGetSameKey64Threads);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCachePerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
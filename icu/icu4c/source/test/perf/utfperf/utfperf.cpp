@@ -22,7 +22,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "unicode/uperf.h"
+#include "unicode/ustring.h"
 #include "cmemory.h" // for UPRV_LENGTHOF
+#include "cstring.h"
 #include "uoptions.h"
 
 /* definitions and text buffers */
@@ -50,13 +52,15 @@ enum {
     CHARSET,
     CHUNK_LENGTH,
     PIVOT_LENGTH,
+    TEXT_MIX,
     UTFPERF_OPTIONS_COUNT
 };
 
 static UOption options[UTFPERF_OPTIONS_COUNT]={
     UOPTION_DEF("charset",  '\x01', UOPT_REQUIRES_ARG),
     UOPTION_DEF("chunk",    '\x01', UOPT_REQUIRES_ARG),
-    UOPTION_DEF("pivot",    '\x01', UOPT_REQUIRES_ARG)
+    UOPTION_DEF("pivot",    '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("mix",      '\x01', UOPT_REQUIRES_ARG)
 };
 
 static const char *const utfperf_usage =
@@ -64,7 +68,25 @@ static const char *const utfperf_usage =
     "\t            Default: UTF-8\n"
     "\t--chunk     Length (in bytes) of charset output chunks. [4096]\n"
     "\t--pivot     Length (in UChars) of the UTF-16 pivot buffer, if applicable.\n"
-    "\t            [1024]\n";
+    "\t            [1024]\n"
+    "\t--mix       Use generated text instead of an input file:\n"
+    "\t            ascii, latin, cyrillic, greek, cjk or emoji.\n";
+
+// Sample sentences for generated text, repeated to fill the input.
+static const struct {
+    const char *name;
+    const UChar *text;
+} textMixes[] = {
+    { "ascii", u"The quick brown fox jumps over the lazy dog; {\"id\": 12345, \"ok\": true}\n" },
+    { "latin", u"Größere Übungen für Äpfel, déjà vu à la crème brûlée; ¿Qué pasó, señor Núñez?\n" },
+    { "cyrillic", u"Съешь же ещё этих мягких французских булок, да выпей чаю. 12345\n" },
+    { "greek", u"Ξεσκεπάζω την ψυχοφθόρα βδελυγμία, <b>id=42</b>\n" },
+    { "cjk", u"統一碼為每個字符提供了唯一的數字，不論是什麼平台、程式或語言。ユニコードは全ての文字に番号を付与します。\n" },
+    { "emoji", u"Launch 🚀 done 🎉 thanks 👍🏽 and see you 😀 at 🏔️ camp 🔥🔥 ok\n" }
+};
+
+// Number of UChars of generated text. Fits into the UTF-8 buffer for any mix.
+static const int32_t GENERATED_LENGTH = 64 * 1024;
 
 // Test object.
 class  UtfPerformanceTest : public UPerfTest{
@@ -86,8 +108,12 @@ class  UtfPerformanceTest : public UPerfTest{
                 status = U_ILLEGAL_ARGUMENT_ERROR;
             }
 
-            int32_t inputLength;
-            UPerfTest::getBuffer(inputLength, status);
+            if (options[TEXT_MIX].doesOccur) {
+                generateText(options[TEXT_MIX].value, status);
+            } else {
+                int32_t inputLength;
+                UPerfTest::getBuffer(inputLength, status);
+            }
             countInputCodePoints = u_countChar32(buffer, bufferLen);
             u_strToUTF8(utf8, (int32_t)sizeof(utf8), &utf8Length, buffer, bufferLen, &status);
         }
@@ -95,6 +121,28 @@ class  UtfPerformanceTest : public UPerfTest{
 
     virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
 
+    // Fills the buffer with repetitions of the sentence for the named mix.
+    void generateText(const char *mix, UErrorCode &status) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(textMixes); ++i) {
+            if (uprv_strcmp(mix, textMixes[i].name) == 0) {
+                const UChar *text = textMixes[i].text;
+                int32_t textLength = u_strlen(text);
+                buffer = (UChar *)uprv_malloc(U_SIZEOF_UCHAR * (GENERATED_LENGTH + 1));
+                if (buffer == NULL) {
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    return;
+                }
+                for (bufferLen = 0; (bufferLen + textLength) <= GENERATED_LENGTH; bufferLen += textLength) {
+                    u_memcpy(buffer + bufferLen, text, textLength);
+                }
+                buffer[bufferLen] = 0;
+                return;
+            }
+        }
+        fprintf(stderr, "error: unknown text mix \"%s\"\n", mix);
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+
     const UChar *getBuffer() const { return buffer; }
     int32_t getBufferLen() const { return bufferLen; }
 
@@ -328,11 +376,58 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test u_strToUTF8WithSub() on the whole input.
+class StrToUTF8 : public UPerfFunction {
+public:
+    StrToUTF8(const UtfPerformanceTest &testcase)
+            : input(testcase.getBuffer()), inputLength(testcase.getBufferLen()) {}
+    virtual void call(UErrorCode* pErrorCode){
+        int32_t length;
+        u_strToUTF8WithSub(intermediate, OUTPUT_CAPACITY, &length,
+                           input, inputLength, 0xfffd, NULL, pErrorCode);
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+private:
+    const UChar *input;
+    int32_t inputLength;
+};
+
+// Test u_strFromUTF8WithSub() on the whole input.
+class StrFromUTF8 : public UPerfFunction {
+public:
+    StrFromUTF8(const UtfPerformanceTest & /*testcase*/) {}
+    virtual void call(UErrorCode* pErrorCode){
+        int32_t length;
+        u_strFromUTF8WithSub(output, OUTPUT_CAPACITY, &length,
+                             utf8, utf8Length, 0xfffd, NULL, pErrorCode);
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+};
+
+class ValidateUTF8 : public UPerfFunction {
+public:
+    ValidateUTF8(const UtfPerformanceTest & /*testcase*/) {}
+    virtual void call(UErrorCode* pErrorCode){
+        int32_t numCodePoints;
+        u_validateUTF8(utf8, utf8Length, &numCodePoints, pErrorCode);
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "StrToUTF8";     if (exec) return new StrToUTF8(*this); break;
+        case 4: name = "StrFromUTF8";   if (exec) return new StrFromUTF8(*this); break;
+        case 5: name = "ValidateUTF8";  if (exec) return new ValidateUTF8(*this); break;
         default: name = ""; break;
     }
     return NULL;
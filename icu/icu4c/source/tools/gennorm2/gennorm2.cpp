@@ -62,7 +62,8 @@ enum {
     UNICODE_VERSION,
     WRITE_C_SOURCE,
     WRITE_COMBINED_DATA,
-    OPT_FAST
+    OPT_FAST,
+    CANON_ITER
 };
 
 static UOption options[]={
@@ -75,7 +76,8 @@ static UOption options[]={
     UOPTION_DEF("unicode", 'u', UOPT_REQUIRES_ARG),
     UOPTION_DEF("csource", '\1', UOPT_NO_ARG),
     UOPTION_DEF("combined", '\1', UOPT_NO_ARG),
-    UOPTION_DEF("fast", '\1', UOPT_NO_ARG)
+    UOPTION_DEF("fast", '\1', UOPT_NO_ARG),
+    UOPTION_DEF("canoniter", '\1', UOPT_NO_ARG)
 };
 
 extern "C" int
@@ -131,7 +133,9 @@ main(int argc, char* argv[]) {
             "\t                    which might increase its size  (Writes fully decomposed\n"
             "\t                    regular mappings instead of delta mappings.\n"
             "\t                    You should measure the runtime speed to make sure that\n"
-            "\t                    this is a good trade-off.)\n");
+            "\t                    this is a good trade-off.)\n"
+            "\t      --canoniter   also write precomputed CanonicalIterator data\n"
+            "\t                    (always included with --csource)\n");
         return argc<0 ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
 
@@ -167,6 +171,10 @@ main(int argc, char* argv[]) {
         builder->setOptimization(Normalizer2DataBuilder::OPTIMIZE_FAST);
     }
 
+    if(options[CANON_ITER].doesOccur) {
+        builder->setCanonIterData(true);
+    }
+
     // prepare the filename beginning with the source dir
     CharString filename(options[SOURCEDIR].value, errorCode);
     int32_t pathLength=filename.length();
@@ -95,7 +95,9 @@ const HangulIterator::Range HangulIterator::ranges[4]={
 Normalizer2DataBuilder::Normalizer2DataBuilder(UErrorCode &errorCode) :
         norms(errorCode),
         phase(0), overrideHandling(OVERRIDE_PREVIOUS), optimization(OPTIMIZE_NORMAL),
-        norm16TrieBytes(nullptr), norm16TrieLength(0) {
+        canonIterData(false),
+        norm16TrieBytes(nullptr), norm16TrieLength(0),
+        canonIterTrieBytes(nullptr), canonIterTrieLength(0) {
     memset(unicodeVersion, 0, sizeof(unicodeVersion));
     memset(indexes, 0, sizeof(indexes));
     memset(smallFCD, 0, sizeof(smallFCD));
@@ -103,6 +105,7 @@ Normalizer2DataBuilder::Normalizer2DataBuilder(UErrorCode &errorCode) :
 
 Normalizer2DataBuilder::~Normalizer2DataBuilder() {
     delete[] norm16TrieBytes;
+    delete[] canonIterTrieBytes;
 }
 
 void
@@ -554,6 +557,184 @@ void Normalizer2DataBuilder::setHangulData(UMutableCPTrie *norm16Trie) {
     errorCode.assertSuccess();
 }
 
+/**
+ * Builds the CanonicalIterator data like Normalizer2Impl::makeCanonIterDataFromNorm16()
+ * does at runtime, but from the Norm types rather than from norm16 values.
+ */
+class CanonIterDataWriter : public Norms::Enumerator {
+public:
+    CanonIterDataWriter(UMutableCPTrie *trie, Norms &n) :
+            Norms::Enumerator(n), canonIterTrie(trie) {}
+    void rangeHandler(UChar32 start, UChar32 end, Norm &norm) U_OVERRIDE;
+
+    void addBits(UChar32 start, UChar32 end, uint32_t bits);
+    void addToStartSet(UChar32 origin, UChar32 decompLead);
+    void addOneWayMapping(UChar32 c, const Norm &norm);
+
+    UMutableCPTrie *canonIterTrie;
+    std::vector<UnicodeSet> startSets;
+};
+
+void CanonIterDataWriter::rangeHandler(UChar32 start, UChar32 end, Norm &norm) {
+    switch(norm.type) {
+    case Norm::YES_YES_COMBINES_FWD:
+        addBits(start, end, CANON_HAS_COMPOSITIONS);
+        break;
+    case Norm::NO_NO_COMP_YES:
+    case Norm::NO_NO_COMP_BOUNDARY_BEFORE:
+    case Norm::NO_NO_COMP_NO_MAYBE_CC:
+    case Norm::NO_NO_EMPTY:
+    case Norm::NO_NO_DELTA:
+        for(UChar32 c=start; c<=end; ++c) {
+            addOneWayMapping(c, norm);
+        }
+        break;
+    case Norm::MAYBE_YES_COMBINES_FWD:
+        addBits(start, end, CANON_NOT_SEGMENT_STARTER|CANON_HAS_COMPOSITIONS);
+        break;
+    case Norm::MAYBE_YES_SIMPLE:
+    case Norm::YES_YES_WITH_CC:
+        // not a segment starter if it occurs in a decomposition or has cc!=0
+        addBits(start, end, CANON_NOT_SEGMENT_STARTER);
+        break;
+    default:
+        // Inert, or 2-way mapping.
+        // Composites from 2-way mappings are added at runtime from the
+        // starter's compositions list, and the other characters in
+        // 2-way mappings get CANON_NOT_SEGMENT_STARTER set because they are
+        // "maybe" characters.
+        break;
+    }
+}
+
+void CanonIterDataWriter::addBits(UChar32 start, UChar32 end, uint32_t bits) {
+    IcuToolErrorCode errorCode("gennorm2/CanonIterDataWriter::addBits()");
+    for(UChar32 c=start; c<=end; ++c) {
+        uint32_t value=umutablecptrie_get(canonIterTrie, c);
+        if((value&bits)!=bits) {
+            umutablecptrie_set(canonIterTrie, c, value|bits, errorCode);
+        }
+    }
+}
+
+void CanonIterDataWriter::addToStartSet(UChar32 origin, UChar32 decompLead) {
+    IcuToolErrorCode errorCode("gennorm2/CanonIterDataWriter::addToStartSet()");
+    uint32_t value=umutablecptrie_get(canonIterTrie, decompLead);
+    if((value&(CANON_HAS_SET|CANON_VALUE_MASK))==0 && origin!=0) {
+        // origin is the first character whose decomposition starts with decompLead.
+        umutablecptrie_set(canonIterTrie, decompLead, value|origin, errorCode);
+    } else if((value&CANON_HAS_SET)==0) {
+        // Temporarily store the index of the new set; processCanonIterData()
+        // replaces it with the offset of the serialized set.
+        UChar32 firstOrigin=(UChar32)(value&CANON_VALUE_MASK);
+        value=(value&~CANON_VALUE_MASK)|CANON_HAS_SET|(uint32_t)startSets.size();
+        umutablecptrie_set(canonIterTrie, decompLead, value, errorCode);
+        startSets.emplace_back();
+        if(firstOrigin!=0) {
+            startSets.back().add(firstOrigin);
+        }
+        startSets.back().add(origin);
+    } else {
+        startSets[value&CANON_VALUE_MASK].add(origin);
+    }
+}
+
+void CanonIterDataWriter::addOneWayMapping(UChar32 c, const Norm &norm) {
+    const UnicodeString *mapping=norm.mapping;
+    UBool isOneWay=true;
+    if(norm.type==Norm::NO_NO_DELTA) {
+        // Maps algorithmically to a compYesAndZeroCC character.
+        const Norm &norm2=norms.getNormRef(norm.mappingCP);
+        if(norm2.type==Norm::YES_NO_COMBINES_FWD || norm2.type==Norm::YES_NO_MAPPING_ONLY) {
+            // Use its 2-way decomposition.
+            mapping=norm2.mapping;
+            isOneWay=false;
+        } else {
+            addToStartSet(c, norm.mappingCP);
+            return;
+        }
+    } else if(norm.cc!=0) {
+        addBits(c, c, CANON_NOT_SEGMENT_STARTER);
+    }
+    // Skip empty mappings (no characters in the decomposition).
+    if(mapping->isEmpty()) {
+        return;
+    }
+    // Add c to the first code point's start set.
+    UChar32 lead=mapping->char32At(0);
+    addToStartSet(c, lead);
+    // Set CANON_NOT_SEGMENT_STARTER for each remaining code point of a one-way mapping.
+    if(isOneWay) {
+        for(int32_t i=U16_LENGTH(lead); i<mapping->length();) {
+            UChar32 c2=mapping->char32At(i);
+            addBits(c2, c2, CANON_NOT_SEGMENT_STARTER);
+            i+=U16_LENGTH(c2);
+        }
+    }
+}
+
+void Normalizer2DataBuilder::processCanonIterData() {
+    IcuToolErrorCode errorCode("gennorm2/processCanonIterData()");
+    LocalUMutableCPTriePointer mutableTrie(umutablecptrie_open(0, 0, errorCode));
+    errorCode.assertSuccess();
+    CanonIterDataWriter writer(mutableTrie.getAlias(), norms);
+    norms.enumRanges(writer);
+
+    // Hangul: Jamo L combine forward, Jamo V/T are "maybe" characters.
+    // The Hangul syllables have 2-way mappings.
+    writer.addBits(Hangul::JAMO_L_BASE, Hangul::JAMO_L_END, CANON_HAS_COMPOSITIONS);
+    writer.addBits(Hangul::JAMO_V_BASE, Hangul::JAMO_V_END, CANON_NOT_SEGMENT_STARTER);
+    writer.addBits(Hangul::JAMO_T_BASE+1, Hangul::JAMO_T_END, CANON_NOT_SEGMENT_STARTER);
+
+    // Serialize the start sets in code point order
+    // and replace the set indexes with the offsets of the serialized sets.
+    canonStartSets.remove();
+    UChar32 start=0, end;
+    uint32_t value;
+    while((end=umutablecptrie_getRange(mutableTrie.getAlias(), start, UCPMAP_RANGE_NORMAL, 0,
+                                       nullptr, nullptr, &value))>=0) {
+        if((value&CANON_HAS_SET)!=0) {
+            // Each set belongs to a single code point.
+            U_ASSERT(start==end);
+            const UnicodeSet &set=writer.startSets[value&CANON_VALUE_MASK];
+            int32_t offset=canonStartSets.length();
+            if(offset>CANON_VALUE_MASK) {
+                fprintf(stderr,
+                        "gennorm2 error: "
+                        "data structure overflow, too much CanonicalIterator start set data\n");
+                exit(U_BUFFER_OVERFLOW_ERROR);
+            }
+            int32_t length=set.serialize(nullptr, 0, errorCode);
+            errorCode.reset();  // U_BUFFER_OVERFLOW_ERROR
+            UChar *buffer=canonStartSets.getBuffer(offset+length);
+            set.serialize(reinterpret_cast<uint16_t *>(buffer)+offset, length, errorCode);
+            canonStartSets.releaseBuffer(offset+length);
+            errorCode.assertSuccess();
+            umutablecptrie_set(mutableTrie.getAlias(), start,
+                               (value&~CANON_VALUE_MASK)|(uint32_t)offset, errorCode);
+        }
+        start=end+1;
+    }
+    // Pad to even length for 4-byte alignment of following data.
+    if(canonStartSets.length()&1) {
+        canonStartSets.append((UChar)0);
+    }
+
+    LocalUCPTriePointer builtTrie(
+        umutablecptrie_buildImmutable(mutableTrie.getAlias(), UCPTRIE_TYPE_SMALL,
+                                      UCPTRIE_VALUE_BITS_32, errorCode));
+    canonIterTrieLength=ucptrie_toBinary(builtTrie.getAlias(), nullptr, 0, errorCode);
+    if(errorCode.get()!=U_BUFFER_OVERFLOW_ERROR) {
+        fprintf(stderr, "gennorm2 error: unable to build/serialize the CanonicalIterator trie - %s\n",
+                errorCode.errorName());
+        exit(errorCode.reset());
+    }
+    errorCode.reset();
+    canonIterTrieBytes=new uint8_t[canonIterTrieLength];
+    ucptrie_toBinary(builtTrie.getAlias(), canonIterTrieBytes, canonIterTrieLength, errorCode);
+    errorCode.assertSuccess();
+}
+
 LocalUCPTriePointer Normalizer2DataBuilder::processData() {
     // Build composition lists before recursive decomposition,
     // so that we still have the raw, pair-wise mappings.
@@ -736,6 +917,11 @@ LocalUCPTriePointer Normalizer2DataBuilder::processData() {
     ucptrie_toBinary(builtTrie.getAlias(), norm16TrieBytes, norm16TrieLength, errorCode);
     errorCode.assertSuccess();
 
+    if(canonIterData) {
+        processCanonIterData();
+        dataInfo.formatVersion[1]=1;
+    }
+
     int32_t offset=(int32_t)sizeof(indexes);
     indexes[Normalizer2Impl::IX_NORM_TRIE_OFFSET]=offset;
     offset+=norm16TrieLength;
@@ -743,8 +929,16 @@ LocalUCPTriePointer Normalizer2DataBuilder::processData() {
     offset+=extraData.length()*2;
     indexes[Normalizer2Impl::IX_SMALL_FCD_OFFSET]=offset;
     offset+=sizeof(smallFCD);
+    if(canonIterTrieLength>0) {
+        // Pad the smallFCD part for 4-byte alignment of the trie.
+        offset=(offset+3)&~3;
+    }
+    indexes[Normalizer2Impl::IX_CANON_ITER_TRIE_OFFSET]=offset;
+    offset+=canonIterTrieLength;
+    indexes[Normalizer2Impl::IX_CANON_START_SETS_OFFSET]=offset;
+    offset+=canonStartSets.length()*2;
     int32_t totalSize=offset;
-    for(int32_t i=Normalizer2Impl::IX_RESERVED3_OFFSET; i<=Normalizer2Impl::IX_TOTAL_SIZE; ++i) {
+    for(int32_t i=Normalizer2Impl::IX_RESERVED5_OFFSET; i<=Normalizer2Impl::IX_TOTAL_SIZE; ++i) {
         indexes[i]=totalSize;
     }
 
@@ -752,6 +946,8 @@ LocalUCPTriePointer Normalizer2DataBuilder::processData() {
         printf("size of normalization trie:         %5ld bytes\n", (long)norm16TrieLength);
         printf("size of 16-bit extra data:          %5ld uint16_t\n", (long)extraData.length());
         printf("size of small-FCD data:             %5ld bytes\n", (long)sizeof(smallFCD));
+        printf("size of CanonicalIterator trie:     %5ld bytes\n", (long)canonIterTrieLength);
+        printf("size of CanonicalIterator sets:     %5ld uint16_t\n", (long)canonStartSets.length());
         printf("size of binary data file contents:  %5ld bytes\n", (long)totalSize);
         printf("minDecompNoCodePoint:              U+%04lX\n", (long)indexes[Normalizer2Impl::IX_MIN_DECOMP_NO_CP]);
         printf("minCompNoMaybeCodePoint:           U+%04lX\n", (long)indexes[Normalizer2Impl::IX_MIN_COMP_NO_MAYBE_CP]);
@@ -791,6 +987,13 @@ void Normalizer2DataBuilder::writeBinaryFile(const char *filename) {
     udata_writeBlock(pData, norm16TrieBytes, norm16TrieLength);
     udata_writeUString(pData, toUCharPtr(extraData.getBuffer()), extraData.length());
     udata_writeBlock(pData, smallFCD, sizeof(smallFCD));
+    if(canonIterTrieLength>0) {
+        udata_writePadding(pData,
+                           indexes[Normalizer2Impl::IX_CANON_ITER_TRIE_OFFSET]-
+                           indexes[Normalizer2Impl::IX_SMALL_FCD_OFFSET]-(int32_t)sizeof(smallFCD));
+        udata_writeBlock(pData, canonIterTrieBytes, canonIterTrieLength);
+        udata_writeUString(pData, toUCharPtr(canonStartSets.getBuffer()), canonStartSets.length());
+    }
     int32_t writtenSize=udata_finish(pData, errorCode);
     if(errorCode.isFailure()) {
         fprintf(stderr, "gennorm2: error %s writing the output file\n", errorCode.errorName());
@@ -806,6 +1009,8 @@ void Normalizer2DataBuilder::writeBinaryFile(const char *filename) {
 
 void
 Normalizer2DataBuilder::writeCSourceFile(const char *filename) {
+    // The hardcoded NFC data always includes the CanonicalIterator data.
+    canonIterData=true;
     LocalUCPTriePointer norm16Trie = processData();
 
     IcuToolErrorCode errorCode("gennorm2/writeCSourceFile()");
@@ -842,6 +1047,16 @@ Normalizer2DataBuilder::writeCSourceFile(const char *filename) {
     snprintf(line, sizeof(line), "static const uint8_t %s_smallFCD[%%ld]={\n", name);
     usrc_writeArray(f, line, smallFCD, 8, sizeof(smallFCD), "", "\n};\n\n");
 
+    LocalUCPTriePointer canonIterTrie(
+        ucptrie_openFromBinary(UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32,
+                               canonIterTrieBytes, canonIterTrieLength, nullptr, errorCode));
+    errorCode.assertSuccess();
+    snprintf(line, sizeof(line), "%s_canonIter", name);
+    usrc_writeUCPTrie(f, line, canonIterTrie.getAlias(), UPRV_TARGET_SYNTAX_CCODE);
+
+    snprintf(line, sizeof(line), "static const uint16_t %s_canonStartSets[%%ld]={\n", name);
+    usrc_writeArray(f, line, canonStartSets.getBuffer(), 16, canonStartSets.length(), "", "\n};\n\n");
+
     fputs("#endif  // INCLUDED_FROM_NORMALIZER2_CPP\n", f);
     fclose(f);
 }
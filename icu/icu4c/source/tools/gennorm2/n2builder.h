@@ -54,6 +54,9 @@ class Normalizer2DataBuilder {
 
     void setOptimization(Optimization opt) { optimization=opt; }
 
+    /** Also write precomputed data for the CanonicalIterator. */
+    void setCanonIterData(UBool write) { canonIterData=write; }
+
     void setCC(UChar32 c, uint8_t cc);
     void setOneWayMapping(UChar32 c, const UnicodeString &m);
     void setRoundTripMapping(UChar32 c, const UnicodeString &m);
@@ -97,6 +100,7 @@ class Normalizer2DataBuilder {
     }
     void writeNorm16(UMutableCPTrie *norm16Trie, UChar32 start, UChar32 end, Norm &norm);
     void setHangulData(UMutableCPTrie *norm16Trie);
+    void processCanonIterData();
     LocalUCPTriePointer processData();
 
     Norms norms;
@@ -105,12 +109,16 @@ class Normalizer2DataBuilder {
     OverrideHandling overrideHandling;
 
     Optimization optimization;
+    UBool canonIterData;
 
     int32_t indexes[Normalizer2Impl::IX_COUNT];
     uint8_t *norm16TrieBytes;
     int32_t norm16TrieLength;
     UnicodeString extraData;
     uint8_t smallFCD[0x100];
+    uint8_t *canonIterTrieBytes;
+    int32_t canonIterTrieLength;
+    UnicodeString canonStartSets;
 
     UVersionInfo unicodeVersion;
 };
@@ -35,6 +35,7 @@
 #include "udataswp.h"
 #include "swapimpl.h"
 #include "toolutil.h"
+#include "pkg_gencmn.h"
 #include "uoptions.h"
 
 #include <stdio.h>
@@ -343,8 +344,9 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
     const uint8_t *inBytes;
     uint8_t *outBytes;
 
-    uint32_t itemCount, offset, i;
+    uint32_t itemCount, offset, hashLength, i;
     int32_t itemLength;
+    UBool hasTOCHash;
 
     const UDataOffsetTOCEntry *inEntries;
     UDataOffsetTOCEntry *outEntries;
@@ -376,6 +378,7 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
         *pErrorCode=U_UNSUPPORTED_ERROR;
         return 0;
     }
+    hasTOCHash=pInfo->formatVersion[1]>=1;
 
     /*
      * We need to change the ToC name entries so that they have the correct
@@ -437,7 +440,7 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
             itemCount=ds->readUInt32(*(const uint32_t *)inBytes);
             if(itemCount==0) {
                 offset=4;
-            } else if((uint32_t)length<(4+8*itemCount)) {
+            } else if((uint32_t)length<(4+8*itemCount+(hasTOCHash ? 4 : 0))) {
                 /* ToC table does not fit */
                 offset=0xffffffff;
             } else {
@@ -462,8 +465,12 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
             return headerSize+4;
         }
 
-        /* swap the item name strings */
+        /* skip the ToC hash table, it is rebuilt for the output names below */
         offset=4+8*itemCount;
+        hashLength=hasTOCHash ? ds->readUInt32(*(const uint32_t *)(inBytes+offset)) : 0;
+        offset+=hashLength;
+
+        /* swap the item name strings */
         itemLength=(int32_t)(ds->readUInt32(inEntries[0].dataOffset)-offset);
         udata_swapInvStringBlock(ds, inBytes+offset, itemLength, outBytes+offset, pErrorCode);
         if(U_FAILURE(*pErrorCode)) {
@@ -601,6 +608,40 @@ udata_swapPackage(const char *inFilename, const char *outFilename,
             ds->writeUInt32(&outEntries[i].dataOffset, table[i].outOffset);
         }
 
+        /*
+         * Rebuild the ToC hash table because its hash values depend on
+         * the package name and on the charset family.
+         * It has the same length since it only depends on the itemCount.
+         */
+        if(hasTOCHash) {
+            if((uint32_t)getTOCHashLength((int32_t)itemCount)!=hashLength) {
+                udata_printError(ds, "udata_swapPackage(): unexpected ToC hash table length %u\n",
+                                 hashLength);
+                uprv_free(table);
+                *pErrorCode=U_INVALID_FORMAT_ERROR;
+                return 0;
+            }
+            const char **names=(const char **)uprv_malloc(itemCount*sizeof(const char *));
+            uint32_t *hash=(uint32_t *)uprv_malloc(hashLength);
+            if(names==NULL || hash==NULL) {
+                udata_printError(ds, "udata_swapPackage(): out of memory rebuilding the ToC hash table\n");
+                uprv_free(names);
+                uprv_free(hash);
+                uprv_free(table);
+                *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+                return 0;
+            }
+            for(i=0; i<itemCount; ++i) {
+                names[i]=(const char *)outBytes+table[i].nameOffset;
+            }
+            buildTOCHash(names, (int32_t)itemCount, hash);
+            for(i=0; i<hashLength/4; ++i) {
+                ds->writeUInt32((uint32_t *)(outBytes+4+8*itemCount)+i, hash[i]);
+            }
+            uprv_free(names);
+            uprv_free(hash);
+        }
+
         /* swap each data item */
         for(i=0; i<itemCount; ++i) {
             /* first copy the item bytes to make sure that unreachable bytes are copied */ 
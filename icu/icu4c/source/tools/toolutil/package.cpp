@@ -33,6 +33,7 @@
 #include "swapimpl.h"
 #include "toolutil.h"
 #include "package.h"
+#include "pkg_gencmn.h"
 #include "cmemory.h"
 
 #include <stdio.h>
@@ -55,7 +56,7 @@ static const UDataInfo dataInfo={
     0,
 
     {0x43, 0x6d, 0x6e, 0x44},     /* dataFormat="CmnD" */
-    {1, 0, 0, 0},                 /* formatVersion */
+    {1, 1, 0, 0},                 /* formatVersion */
     {3, 0, 0, 0}                  /* dataVersion */
 };
 
@@ -449,8 +450,9 @@ Package::readPackage(const char *filename) {
     const uint8_t *inBytes;
 
     int32_t length, offset, i;
-    int32_t itemLength, typeEnum;
+    int32_t itemLength, typeEnum, stringsOffset;
     char type;
+    UBool hasTOCHash;
 
     const UDataOffsetTOCEntry *inEntries;
 
@@ -502,6 +504,7 @@ Package::readPackage(const char *filename) {
     }
     inIsBigEndian=(UBool)pInfo->isBigEndian;
     inCharset=pInfo->charsetFamily;
+    hasTOCHash=pInfo->formatVersion[1]>=1;
 
     inBytes=(const uint8_t *)inData+headerLength;
     inEntries=(const UDataOffsetTOCEntry *)(inBytes+4);
@@ -516,7 +519,7 @@ Package::readPackage(const char *filename) {
         setItemCapacity(itemCount); /* resize so there's space */
         if(itemCount==0) {
             offset=4;
-        } else if(length<(4+8*itemCount)) {
+        } else if(length<(4+8*itemCount+(hasTOCHash ? 4 : 0))) {
             /* ToC table does not fit */
             offset=0x7fffffff;
         } else {
@@ -545,8 +548,13 @@ Package::readPackage(const char *filename) {
             exit(U_BUFFER_OVERFLOW_ERROR);
         }
 
+        /* skip the ToC hash table, it is rebuilt when writing the package */
+        stringsOffset=4+8*itemCount;
+        if(hasTOCHash) {
+            stringsOffset+=(int32_t)ds->readUInt32(*(const uint32_t *)(inBytes+stringsOffset));
+        }
+
         /* swap the item name strings */
-        int32_t stringsOffset=4+8*itemCount;
         itemLength=(int32_t)(ds->readUInt32(inEntries[0].dataOffset))-stringsOffset;
 
         // don't include padding bytes at the end of the item names
@@ -690,8 +698,10 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
     FILE *file;
     Item *pItem;
     char *name;
+    const char **names;
+    uint32_t *hash;
     UErrorCode errorCode;
-    int32_t i, length, prefixLength, maxItemLength, basenameOffset, offset, outInt32;
+    int32_t i, length, prefixLength, maxItemLength, basenameOffset, offset, outInt32, hashLength;
     uint8_t outCharset;
     UBool outIsBigEndian;
 
@@ -721,6 +731,11 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         pHeader->dataHeader.headerSize=(uint16_t)headerLength;
     }
 
+    // the package is written with a ToC hash table
+    ((DataHeader *)header)->info.formatVersion[1]=1;
+    ((DataHeader *)header)->info.formatVersion[2]=0;
+    ((DataHeader *)header)->info.formatVersion[3]=0;
+
     makeTypeProps(outType, outCharset, outIsBigEndian);
 
     // open (TYPE_COUNT-2) swappers
@@ -804,9 +819,23 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         items[i].name=name;
     }
 
+    // build the ToC hash table for the output item names
+    hashLength=getTOCHashLength(itemCount);
+    hash=(uint32_t *)uprv_malloc(hashLength);
+    names=(const char **)uprv_malloc((itemCount+1)*sizeof(const char *));
+    if(hash==NULL || names==NULL) {
+        fprintf(stderr, "icupkg: unable to allocate memory for the ToC hash table\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    for(i=0; i<itemCount; ++i) {
+        names[i]=items[i].name;
+    }
+    buildTOCHash(names, itemCount, hash);
+    uprv_free(names);
+
     // calculate offsets for item names and items, pad to 16-align items
     // align only the first item; each item's length is a multiple of 16
-    basenameOffset=4+8*itemCount;
+    basenameOffset=4+8*itemCount+hashLength;
     offset=basenameOffset+outStringTop;
     if((length=(offset&15))!=0) {
         length=16-length;
@@ -855,6 +884,21 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         offset+=length;
     }
 
+    // then write the ToC hash table
+    if(dsLocalToOut!=NULL) {
+        dsLocalToOut->swapArray32(dsLocalToOut, hash, hashLength, hash, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            fprintf(stderr, "icupkg: swapArray32(ToC hash table) failed - %s\n", u_errorName(errorCode));
+            exit(errorCode);
+        }
+    }
+    length=(int32_t)fwrite(hash, 1, hashLength, file);
+    if(length!=hashLength) {
+        fprintf(stderr, "icupkg: unable to write complete ToC hash table to file \"%s\"\n", filename);
+        exit(U_FILE_ACCESS_ERROR);
+    }
+    uprv_free(hash);
+
     // write the item names
     length=(int32_t)fwrite(outStrings, 1, outStringTop, file);
     if(length!=outStringTop) {
@@ -18,6 +18,8 @@
 #include "unicode/uclean.h"
 #include "unewdata.h"
 #include "putilimp.h"
+#include "uarrsort.h"
+#include "ucmndata.h"
 #include "pkg_gencmn.h"
 
 #define STRING_STORE_SIZE 200000
@@ -65,6 +67,20 @@ the length of the last item is the difference between its offset and
 the .dat file length, and the length of all previous items is the difference
 between its offset and the next one.
 
+Format version 1.1
+
+Adds a hash table between the ToC table and the item name strings,
+for lookups without binary search. See UDataOffsetTOCHash in ucmndata.h.
+Readers of format version 1.0 find the item names and items via their offsets
+and ignore the hash table.
+
+UDataOffsetTOCHash hash;
+    uint32_t length; - length of the hash table in bytes
+    uint32_t bucketCount; - 0 if the hash table is not usable
+    uint32_t slotCount;
+    uint32_t seeds[bucketCount];
+    uint32_t slots[slotCount]; - ToC entry indexes
+
 ----------------------------------------------------------------------------- */
 
 /* UDataInfo cf. udata.h */
@@ -78,7 +94,7 @@ static const UDataInfo dataInfo={
     0,
 
     {0x43, 0x6d, 0x6e, 0x44},     /* dataFormat="CmnD" */
-    {1, 0, 0, 0},                 /* formatVersion */
+    {1, 1, 0, 0},                 /* formatVersion */
     {3, 0, 0, 0}                  /* dataVersion */
 };
 
@@ -229,9 +245,27 @@ createCommonDataFile(const char *destDir, const char *name, const char *entrypoi
 
     if(!sourceTOC) {
         UNewDataMemory *out;
+        uint32_t *hash;
+        const char **names;
+        int32_t hashLength=getTOCHashLength((int32_t)fileCount);
+
+        /* build the ToC hash table for the sorted basenames */
+        hash=(uint32_t *)uprv_malloc(hashLength);
+        names=(const char **)uprv_malloc(fileCount*sizeof(const char *));
+        if(hash==NULL || names==NULL) {
+            fprintf(stderr, "gencmn: unable to allocate memory for the ToC hash table\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        for(i=0; i<fileCount; ++i) {
+            names[i]=files[i].basename;
+        }
+        if(!buildTOCHash(names, (int32_t)fileCount, hash) && verbose) {
+            printf("no ToC hash function found, lookups will use binary search\n");
+        }
+        uprv_free(names);
 
         /* determine the offsets of all basenames and files in this common one */
-        basenameOffset=4+8*fileCount;
+        basenameOffset=4+8*fileCount+hashLength;
         fileOffset=(basenameOffset+(basenameTotal+15))&~0xf;
         for(i=0; i<fileCount; ++i) {
             files[i].fileOffset=fileOffset;
@@ -258,12 +292,14 @@ createCommonDataFile(const char *destDir, const char *name, const char *entrypoi
             udata_write32(out, files[i].basenameOffset);
             udata_write32(out, files[i].fileOffset);
         }
+        udata_writeBlock(out, hash, hashLength);
+        uprv_free(hash);
 
         /* write the basenames */
         for(i=0; i<fileCount; ++i) {
             udata_writeString(out, files[i].basename, files[i].basenameLength);
         }
-        length=4+8*fileCount+basenameTotal;
+        length=4+8*fileCount+hashLength+basenameTotal;
 
         /* copy the files */
         for(i=0; i<fileCount; ++i) {
@@ -582,3 +618,131 @@ fixDirToTreePath(char *s)
     }
 #endif
 }
+
+/* ToC hash table ----------------------------------------------------------- */
+
+/*
+ * There is one bucket per TOC_HASH_BUCKET_SIZE items, and 1/8 more slots
+ * than items, so that the search for the bucket seeds finishes quickly.
+ */
+#define TOC_HASH_BUCKET_SIZE 4
+#define TOC_HASH_MAX_SEED 0x100000
+
+static void
+getTOCHashCounts(int32_t count, int32_t &bucketCount, int32_t &slotCount) {
+    bucketCount=(count+TOC_HASH_BUCKET_SIZE-1)/TOC_HASH_BUCKET_SIZE;
+    slotCount=count+count/8;
+}
+
+typedef struct {
+    const int32_t *bucketOf, *bucketSizes;
+} TOCHashSortContext;
+
+U_CDECL_BEGIN
+static int32_t U_CALLCONV
+compareTOCHashItems(const void *context, const void *left, const void *right) {
+    /* sort by descending bucket size, then by bucket, then by item index */
+    const TOCHashSortContext *c=(const TOCHashSortContext *)context;
+    int32_t l=*(const int32_t *)left, r=*(const int32_t *)right;
+    int32_t lb=c->bucketOf[l], rb=c->bucketOf[r];
+    if(c->bucketSizes[lb]!=c->bucketSizes[rb]) {
+        return c->bucketSizes[rb]-c->bucketSizes[lb];
+    } else if(lb!=rb) {
+        return lb-rb;
+    } else {
+        return l-r;
+    }
+}
+U_CDECL_END
+
+U_CAPI int32_t U_EXPORT2
+getTOCHashLength(int32_t count) {
+    int32_t bucketCount, slotCount;
+    getTOCHashCounts(count, bucketCount, slotCount);
+    return 4*(3+bucketCount+slotCount);
+}
+
+U_CAPI UBool U_EXPORT2
+buildTOCHash(const char *const names[], int32_t count, uint32_t *hash) {
+    int32_t bucketCount, slotCount;
+    int32_t i, j, k, start, limit;
+    getTOCHashCounts(count, bucketCount, slotCount);
+
+    /* see UDataOffsetTOCHash */
+    uint32_t *seeds=hash+3;
+    uint32_t *slots=seeds+bucketCount;
+    hash[0]=(uint32_t)getTOCHashLength(count);
+    hash[1]=0;  /* not usable until all bucket seeds have been found */
+    hash[2]=(uint32_t)slotCount;
+    uprv_memset(seeds, 0, bucketCount*4);
+    for(i=0; i<slotCount; ++i) {
+        slots[i]=UDATA_TOC_HASH_NO_ENTRY;
+    }
+    if(count==0) {
+        return false;
+    }
+
+    uint64_t *hashes=(uint64_t *)uprv_malloc(count*8);
+    int32_t *bucketOf=(int32_t *)uprv_malloc(count*4);
+    int32_t *bucketSizes=(int32_t *)uprv_malloc(bucketCount*4);
+    int32_t *order=(int32_t *)uprv_malloc(count*4);
+    int32_t *itemSlots=(int32_t *)uprv_malloc(count*4);
+    if(hashes==NULL || bucketOf==NULL || bucketSizes==NULL || order==NULL || itemSlots==NULL) {
+        fprintf(stderr, "gencmn: unable to allocate memory for the ToC hash table\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+
+    /* Distribute the items into buckets, and place the largest buckets first. */
+    uprv_memset(bucketSizes, 0, bucketCount*4);
+    for(i=0; i<count; ++i) {
+        hashes[i]=udata_hashTOCEntryName(names[i]);
+        bucketOf[i]=(int32_t)(udata_mixTOCHash(hashes[i], 0)%(uint32_t)bucketCount);
+        ++bucketSizes[bucketOf[i]];
+        order[i]=i;
+    }
+    UErrorCode errorCode=U_ZERO_ERROR;
+    TOCHashSortContext context={ bucketOf, bucketSizes };
+    uprv_sortArray(order, count, 4, compareTOCHashItems, &context, false, &errorCode);
+
+    /* For each bucket, find a seed that maps its items to distinct free slots. */
+    UBool isUsable=U_SUCCESS(errorCode);
+    for(start=0; isUsable && start<count; start=limit) {
+        int32_t bucket=bucketOf[order[start]];
+        uint32_t seed;
+        limit=start+bucketSizes[bucket];
+        for(seed=1; seed<TOC_HASH_MAX_SEED; ++seed) {
+            for(j=start; j<limit; ++j) {
+                int32_t slot=(int32_t)(udata_mixTOCHash(hashes[order[j]], seed)%(uint32_t)slotCount);
+                if(slots[slot]!=UDATA_TOC_HASH_NO_ENTRY) {
+                    break;
+                }
+                for(k=start; k<j && itemSlots[k]!=slot; ++k) {}
+                if(k<j) {
+                    break;  /* collision within this bucket */
+                }
+                itemSlots[j]=slot;
+            }
+            if(j==limit) {
+                break;
+            }
+        }
+        if(seed==TOC_HASH_MAX_SEED) {
+            isUsable=false;
+            break;
+        }
+        seeds[bucket]=seed;
+        for(j=start; j<limit; ++j) {
+            slots[itemSlots[j]]=(uint32_t)order[j];
+        }
+    }
+    if(isUsable) {
+        hash[1]=(uint32_t)bucketCount;
+    }
+
+    uprv_free(hashes);
+    uprv_free(bucketOf);
+    uprv_free(bucketSizes);
+    uprv_free(order);
+    uprv_free(itemSlots);
+    return isUsable;
+}
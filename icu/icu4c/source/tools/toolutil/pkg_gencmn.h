@@ -15,4 +15,25 @@ U_CAPI void U_EXPORT2
 createCommonDataFile(const char *destDir, const char *name, const char *entrypointName, const char *type, const char *source, const char *copyRight,
                      const char *dataFile, uint32_t max_size, UBool sourceTOC, UBool verbose, char *gencmnFileName);
 
+/**
+ * Returns the length in bytes of the ToC hash table (UDataOffsetTOCHash)
+ * of a .dat package with count items.
+ */
+U_CAPI int32_t U_EXPORT2
+getTOCHashLength(int32_t count);
+
+/**
+ * Builds the ToC hash table (UDataOffsetTOCHash) of a .dat package
+ * with the given item names in ToC order, including the package name prefix,
+ * and in the package's charset family.
+ * Writes getTOCHashLength(count) bytes of platform-endian uint32_t values.
+ *
+ * If no perfect hash function is found, then the hash table is written
+ * with bucketCount=0 so that lookups fall back to binary search.
+ *
+ * @return true if the hash table is usable
+ */
+U_CAPI UBool U_EXPORT2
+buildTOCHash(const char *const names[], int32_t count, uint32_t *hash);
+
 #endif